@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_PROFILER_H_
+#define ZEPHYR_INCLUDE_DEBUG_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup profiler Sampling profiler
+ *  @brief Statistical profiler sampling the interrupted code on timer
+ *  interrupts
+ *
+ *  While the profiler runs, every system timer interrupt records the
+ *  program counter interrupted on its CPU, and optionally the return
+ *  addresses of its callers. Samples are aggregated in a histogram which
+ *  is printed with the addresses, to be symbolized on the host with
+ *  scripts/profiler/profiler_report.py.
+ *  @{
+ */
+
+/** Number of addresses of a sample: program counter and return addresses */
+#define PROFILER_SAMPLE_DEPTH (1 + CONFIG_PROFILER_BACKTRACE_DEPTH)
+
+/**
+ * @typedef profiler_cb_t
+ * @brief Callback called for each entry of the profiler histogram.
+ *
+ * @param pcs Program counter of the entry, followed by the return addresses
+ *	      of its callers, @ref PROFILER_SAMPLE_DEPTH addresses in total
+ *	      padded with 0. A program counter of 0 stands for samples taken
+ *	      in a nested interrupt.
+ * @param count Number of samples of the entry.
+ * @param user_data User data.
+ */
+typedef void (*profiler_cb_t)(const uintptr_t *pcs, uint32_t count,
+			      void *user_data);
+
+/**
+ * @brief Start sampling.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if the profiler is already running.
+ */
+int profiler_start(void);
+
+/**
+ * @brief Stop sampling.
+ *
+ * The samples taken so far are kept until profiler_reset() is called.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if the profiler is not running.
+ */
+int profiler_stop(void);
+
+/**
+ * @brief Discard all the samples.
+ */
+void profiler_reset(void);
+
+/**
+ * @brief Call a function for each entry of the histogram.
+ *
+ * Pending samples are added to the histogram first.
+ *
+ * @param cb Callback.
+ * @param user_data User data passed to the callback.
+ */
+void profiler_foreach(profiler_cb_t cb, void *user_data);
+
+/**
+ * @brief Print the histogram and the profiler overhead.
+ *
+ * The output goes through the logging subsystem, or printk() with
+ * CONFIG_PROFILER_USE_PRINTK.
+ */
+void profiler_print(void);
+
+/** @cond INTERNAL_HIDDEN */
+void z_profiler_sample(void);
+/** @endcond */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_PROFILER_H_ */
@@ -760,6 +760,45 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
  *
  */
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
+
+#if defined(CONFIG_SCHED_DEADLINE_CBS) || defined(__DOXYGEN__)
+/**
+ * @brief Set the runtime budget of a deadline scheduled thread
+ *
+ * The thread may run for @p runtime cycles in each @p period, and is
+ * given a deadline of @p period from now. It is served as a constant
+ * bandwidth server: when it exhausts its budget, the budget is
+ * replenished and its deadline postponed by @p period, so that threads
+ * of the same priority with earlier deadlines preempt it. When it is made
+ * ready with more budget left than its bandwidth allows until its
+ * deadline, it gets a full budget and a deadline of @p period from then.
+ *
+ * The budget of a thread running on another CPU is enforced from the next
+ * time it is scheduled. k_thread_deadline_set() may still be used to set
+ * the deadline directly.
+ *
+ * @note You should enable @kconfig{CONFIG_SCHED_DEADLINE_CBS} in your
+ * project configuration.
+ *
+ * @param thread A thread on which to set the budget
+ * @param runtime Budget per period, in cycle units, 0 to remove it
+ * @param period Period, in cycle units, less than 2^31
+ *
+ * @retval 0 Budget set
+ * @retval -EINVAL Invalid runtime or period
+ */
+__syscall int k_thread_deadline_budget_set(k_tid_t thread, uint32_t runtime,
+					   uint32_t period);
+
+/**
+ * @brief Get the number of budget overruns of a thread
+ *
+ * @param thread A thread with a budget
+ *
+ * @return Number of times the thread exhausted its budget
+ */
+__syscall uint32_t k_thread_deadline_overruns_get(k_tid_t thread);
+#endif
 #endif
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -1574,6 +1613,42 @@ static inline void *z_impl_k_timer_user_data_get(const struct k_timer *timer)
 	return timer->user_data;
 }
 
+#if defined(CONFIG_TIMEOUT_SLACK) || defined(__DOXYGEN__)
+/**
+ * @brief Set the slack of a timer.
+ *
+ * This routine allows the expiry of @a timer to be delayed by up to
+ * @a slack, so that it can be handled in the same system timer interrupt
+ * as other timeouts expiring shortly after it. The slack applies from the
+ * next time the timer is started, and to each of its periods.
+ *
+ * @param timer Address of timer.
+ * @param slack Maximum delay of the expiry, K_NO_WAIT for none.
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, k_timeout_t slack);
+
+/**
+ * @brief Timeout slack statistics
+ */
+struct k_timeout_slack_stats {
+	/** Number of system timer announcements expiring timeouts */
+	uint32_t wakeups;
+	/** Number of wakeups saved by handling timeouts due at different
+	 * ticks in the same announcement
+	 */
+	uint32_t saved;
+};
+
+/**
+ * @brief Get the timeout slack statistics
+ *
+ * @param stats Statistics filled in.
+ * @param reset Reset the statistics after reading them.
+ */
+void k_timeout_slack_stats_get(struct k_timeout_slack_stats *stats,
+			       bool reset);
+#endif
+
 /** @} */
 
 /**
@@ -2678,6 +2753,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 struct k_delayed_work;
 extern struct k_work_q k_sys_work_q;
@@ -2799,6 +2875,30 @@ __syscall int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
  */
 __syscall int k_mutex_unlock(struct k_mutex *mutex);
 
+#if defined(CONFIG_MUTEX_SPIN_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Mutex spinning statistics
+ *
+ * Counts shared by all mutexes, see @kconfig{CONFIG_MUTEX_ADAPTIVE_SPIN}.
+ */
+struct k_mutex_spin_stats {
+	/** Number of times a thread spun on a mutex */
+	uint32_t spins;
+	/** Number of times the mutex was acquired while spinning */
+	uint32_t acquired;
+	/** Total time spent spinning, in cycles */
+	uint64_t cycles;
+};
+
+/**
+ * @brief Get the mutex spinning statistics
+ *
+ * @param stats Statistics filled in.
+ * @param reset Reset the statistics after reading them.
+ */
+void k_mutex_spin_stats_get(struct k_mutex_spin_stats *stats, bool reset);
+#endif
+
 /**
  * @}
  */
@@ -3243,6 +3343,49 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/** @brief Initialize a work queue served by a pool of threads.
+ *
+ * This configures @p num_workers threads that process the items of a
+ * single work queue, and starts them running.  The queue is used with the
+ * same API as a queue started with k_work_queue_start().
+ *
+ * Each worker owns a pending list.  Items are appended to the list of the
+ * worker associated with the CPU doing the submission, and idle workers
+ * steal items from the lists of other workers.  A work item is never
+ * processed by two workers at the same time: an item submitted while it
+ * is running is queued to the worker running it.
+ *
+ * Distinct items may be processed concurrently and complete out of
+ * submission order.  k_work_queue_thread_get() does not apply to a pool.
+ *
+ * @param queue pointer to the queue structure. It must be initialized
+ *        in zeroed/bss memory or with @ref k_work_queue_init before
+ *        use.
+ *
+ * @param workers array of @p num_workers worker structures.  The array
+ *        must persist as long as the queue is used.
+ *
+ * @param num_workers number of threads serving the queue.
+ *
+ * @param stacks first element of an array of @p num_workers stacks
+ *        defined with K_THREAD_STACK_ARRAY_DEFINE() using @p stack_size.
+ *
+ * @param stack_size size of each worker stack, in bytes.
+ *
+ * @param prio initial priority of the worker threads
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.
+ */
+void k_work_queue_pool_start(struct k_work_q *queue,
+			     struct k_work_q_worker *workers,
+			     size_t num_workers, k_thread_stack_t *stacks,
+			     size_t stack_size, int prio,
+			     const struct k_work_queue_config *cfg);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -3310,6 +3453,24 @@ int k_work_queue_unplug(struct k_work_q *queue);
 void k_work_init_delayable(struct k_work_delayable *dwork,
 			   k_work_handler_t handler);
 
+#if defined(CONFIG_TIMEOUT_SLACK) || defined(__DOXYGEN__)
+/** @brief Set the slack of a delayable work item.
+ *
+ * Allows the submission of @p dwork to be delayed by up to @p slack after
+ * its delay, so that its timeout is handled in the same system timer
+ * interrupt as other timeouts expiring shortly after it. The slack applies
+ * from the next time the work item is scheduled.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dwork the delayable work structure.
+ *
+ * @param slack maximum additional delay, K_NO_WAIT for none.
+ */
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack);
+#endif
+
 /**
  * @brief Get the parent delayable work structure from a work pointer.
  *
@@ -3719,6 +3880,14 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* The item being flushed.  In a pool the flusher must not be
+	 * processed by another worker while the item is running.  Only
+	 * compared with the items being run, as it may be released once
+	 * it completes.
+	 */
+	struct k_work *target;
+#endif
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -3783,6 +3952,39 @@ struct k_work_queue_config {
 	 * control.
 	 */
 	bool no_yield;
+
+	/** Control whether the workers of a pool are pinned to a CPU.
+	 *
+	 * When set, worker @c i of a queue started with
+	 * k_work_queue_pool_start() only runs on CPU
+	 * <tt>i % CONFIG_MP_NUM_CPUS</tt>.  Requires
+	 * @kconfig{CONFIG_SCHED_CPU_MASK}; ignored for single threaded
+	 * queues.
+	 */
+	bool pin_workers;
+};
+
+/** @brief A thread serving a work queue pool.
+ *
+ * Instances are provided to k_work_queue_pool_start() and must not be
+ * accessed by the application.
+ */
+struct k_work_q_worker {
+	/* The thread that animates the work. */
+	struct k_thread thread;
+
+	/* All the following fields must be accessed only while the
+	 * work module spinlock is held.
+	 */
+
+	/* The queue served by the worker. */
+	struct k_work_q *queue;
+
+	/* List of k_work items submitted on the CPU of the worker. */
+	sys_slist_t pending;
+
+	/* The work item being processed, or NULL if idle. */
+	struct k_work *current;
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -3805,6 +4007,17 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Workers of a pool, NULL if the queue is served by thread. */
+	struct k_work_q_worker *workers;
+
+	/* Number of entries in workers. */
+	uint16_t num_workers;
+
+	/* Number of workers processing an item. */
+	uint16_t num_busy;
+#endif
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4336,6 +4549,10 @@ struct k_msgq {
 	char *write_ptr;
 	/** Number of used messages */
 	uint32_t used_msgs;
+	/** Number of slots reserved with k_msgq_reserve() */
+	uint32_t reserved_msgs;
+	/** Number of messages peeked with k_msgq_peek_slots() */
+	uint32_t peeked_msgs;
 
 	_POLL_EVENT;
 
@@ -4482,6 +4699,7 @@ int k_msgq_cleanup(struct k_msgq *msgq);
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Slots are reserved with k_msgq_reserve().
  */
 __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 
@@ -4504,9 +4722,160 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  * @retval 0 Message received.
  * @retval -ENOMSG Returned without waiting.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Messages are peeked with k_msgq_peek_slots().
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a count consecutive messages from @a data to
+ * message queue @a msgq, taking the queue lock once.  Messages are handed
+ * to waiting receivers first, and the others are copied to the ring
+ * buffer in as few copies as possible.
+ *
+ * The routine only waits when no message can be sent, and returns as soon
+ * as the first message is sent.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to an array of @a count messages.
+ * @param count Number of messages to send.
+ * @param timeout Non-negative waiting period to add a message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages sent, which is smaller than @a count if the
+ *         queue became full.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Slots are reserved with k_msgq_reserve().
+ */
+__syscall int k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			      uint32_t count, k_timeout_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a count messages from message queue
+ * @a msgq in a "first in, first out" manner, taking the queue lock once.
+ *
+ * The routine only waits when no message is available, and returns as
+ * soon as the first message is received.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold @a count messages.
+ * @param count Maximum number of messages to receive.
+ * @param timeout Waiting period to receive a message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Messages are peeked with k_msgq_peek_slots().
+ */
+__syscall int k_msgq_get_many(struct k_msgq *msgq, void *data,
+			      uint32_t count, k_timeout_t timeout);
+
+/**
+ * @brief Reserve slots of a message queue to write messages in place.
+ *
+ * This routine reserves up to @a max_msgs free consecutive slots of the
+ * ring buffer of @a msgq, which the caller writes directly before sending
+ * them with k_msgq_commit().  This avoids copying the messages.
+ *
+ * Only one reservation may be outstanding.  While it is, other send
+ * operations fail with -EBUSY.  The slots are not accessible from user
+ * mode.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slots Address of a pointer set to the first reserved slot.
+ * @param max_msgs Maximum number of slots to reserve, at least 1.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of consecutive slots reserved.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY A reservation is already outstanding.
+ */
+int k_msgq_reserve(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+		   k_timeout_t timeout);
+
+/**
+ * @brief Send messages written in reserved slots.
+ *
+ * This routine sends the first @a count slots reserved with
+ * k_msgq_reserve() and ends the reservation.  The remaining reserved
+ * slots are released unsent.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param count Number of messages to send, 0 to cancel the reservation.
+ *
+ * @retval 0 Messages sent.
+ * @retval -EINVAL @a count exceeds the number of reserved slots.
+ */
+int k_msgq_commit(struct k_msgq *msgq, uint32_t count);
+
+/**
+ * @brief Access messages of a message queue in place.
+ *
+ * This routine gives access to up to @a max_msgs consecutive messages at
+ * the head of @a msgq, which stay in the queue until they are removed with
+ * k_msgq_release().  This avoids copying the messages.
+ *
+ * Only one such access may be outstanding.  While it is, other receive
+ * operations fail with -EBUSY.  Purging the queue discards the messages.
+ * The slots are not accessible from user mode.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slots Address of a pointer set to the first message.
+ * @param max_msgs Maximum number of messages to access, at least 1.
+ * @param timeout Waiting period for a message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of consecutive messages accessible.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Messages are already being accessed in place.
+ */
+int k_msgq_peek_slots(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+		      k_timeout_t timeout);
+
+/**
+ * @brief Remove messages accessed in place from a message queue.
+ *
+ * This routine removes the first @a count messages obtained with
+ * k_msgq_peek_slots() from the queue and ends the in place access.  The
+ * remaining messages stay at the head of the queue.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param count Number of messages to remove.
+ *
+ * @retval 0 Messages removed.
+ * @retval -EINVAL @a count exceeds the number of messages accessed, or
+ *         the queue was purged.
+ */
+int k_msgq_release(struct k_msgq *msgq, uint32_t count);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4538,7 +4907,7 @@ __syscall void k_msgq_purge(struct k_msgq *msgq);
  * @brief Get the amount of free space in a message queue.
  *
  * This routine returns the number of unused entries in a message queue's
- * ring buffer.
+ * ring buffer.  Entries reserved with k_msgq_reserve() are not unused.
  *
  * @param msgq Address of the message queue.
  *
@@ -4560,7 +4929,7 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	return msgq->max_msgs - msgq->used_msgs - msgq->reserved_msgs;
 }
 
 /**
@@ -4946,6 +5315,14 @@ __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+struct k_mem_slab_cache {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t num_free;
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -4953,10 +5330,15 @@ struct k_mem_slab {
 	size_t block_size;
 	char *buffer;
 	char *free_list;
+	/* With per-CPU caches, also counts the blocks they hold */
 	uint32_t num_used;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
 #endif
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	struct k_mem_slab_cache cache[CONFIG_MP_NUM_CPUS];
+	uint32_t num_waiting;
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 };
@@ -5109,7 +5491,18 @@ extern void k_mem_slab_free(struct k_mem_slab *slab, void **mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	uint32_t cached = 0U;
+
+	for (unsigned int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		cached += slab->cache[i].num_free;
+	}
+
+	/* The counts are read without locking, and may be out of sync */
+	return (slab->num_used > cached) ? (slab->num_used - cached) : 0U;
+#else
 	return slab->num_used;
+#endif
 }
 
 /**
@@ -5144,7 +5537,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->num_blocks - slab->num_used;
+	return slab->num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /** @} */
@@ -5906,6 +6299,17 @@ int k_thread_runtime_stats_get(k_tid_t thread,
  */
 int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats);
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL) || defined(__DOXYGEN__)
+/**
+ * @brief Get the runtime statistics of a CPU
+ *
+ * @param cpu Index of the CPU.
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if null pointers or invalid CPU, otherwise 0
+ */
+int k_thread_runtime_stats_cpu_get(int cpu, k_thread_runtime_stats_t *stats);
+#endif
+
 /**
  * @brief Enable gathering of runtime statistics for specified thread
  *
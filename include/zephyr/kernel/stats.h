@@ -14,12 +14,31 @@
  * and CPU usage.
  */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+/*
+ * Log-scale histogram of times in cycles: count[0] counts the times shorter
+ * than 2^SHIFT cycles, count[i] those shorter than 2^(SHIFT + i) cycles,
+ * and the last bucket all the longer ones.
+ */
+struct k_cycle_hist {
+	uint32_t  count[CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS];
+};
+#endif
+
 struct k_cycle_stats {
 	uint64_t  total;        /* total usage in cycles */
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	uint64_t  current;      /* # of cycles in current usage window */
 	uint64_t  longest;      /* # of cycles in longest usage window */
 	uint32_t  num_windows;  /* # of usage windows */
+#endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	struct k_cycle_hist ready_latency;  /* ready to running */
+	struct k_cycle_hist run_length;     /* running to switched out */
+	struct k_cycle_hist isr_latency;    /* made ready by an ISR to running */
+	/* Threads: when made ready, CPUs: when the current thread started */
+	uint32_t  stamp;
+	bool      ready_from_isr;
 #endif
 	bool      track_usage;  /* true if gathering usage stats */
 };
@@ -90,6 +90,19 @@ struct _thread_base {
 	int prio_deadline;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	/* Constant bandwidth server, times in cycles */
+	struct {
+		uint32_t runtime;	/* budget per period, 0 if none */
+		uint32_t period;
+		uint32_t budget;	/* left in the current period */
+		uint32_t start;		/* when it last started running */
+		uint32_t overruns;	/* budgets exhausted */
+		bool running;
+		struct _timeout timeout; /* budget exhaustion */
+	} cbs;
+#endif
+
 	uint32_t order_key;
 
 #ifdef CONFIG_SMP
@@ -199,6 +212,19 @@ typedef struct k_thread_runtime_stats {
 	uint64_t average_cycles;      /* average # of non-idle cycles */
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	/*
+	 * Histograms of the time from being made ready to running, of the
+	 * time run before being switched out, and of the time from being
+	 * made ready by an ISR to running. For CPUs, they cover the threads
+	 * which ran on the CPU, the idle thread excepted.
+	 */
+
+	struct k_cycle_hist ready_latency;
+	struct k_cycle_hist run_length;
+	struct k_cycle_hist isr_latency;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	/*
 	 * This field is always zero for individual threads. It only comes
@@ -47,6 +47,7 @@ struct log_backend_api {
 
 	/* Functions used by v1 and v2 */
 	void (*dropped)(const struct log_backend *const backend, uint32_t cnt);
+	void (*flush)(const struct log_backend *const backend);
 	void (*panic)(const struct log_backend *const backend);
 	void (*init)(const struct log_backend *const backend);
 	int (*is_ready)(const struct log_backend *const backend);
@@ -245,6 +246,23 @@ static inline void log_backend_dropped(const struct log_backend *const backend,
 	}
 }
 
+/**
+ * @brief Notify backend that no more log messages are pending.
+ *
+ * Backends gathering messages to output them in batches write them out.
+ * Function is optional, and only called with CONFIG_LOG_OUTPUT_BATCH.
+ *
+ * @param[in] backend  Pointer to the backend instance.
+ */
+static inline void log_backend_flush(const struct log_backend *const backend)
+{
+	__ASSERT_NO_MSG(backend != NULL);
+
+	if (backend->api->flush != NULL) {
+		backend->api->flush(backend);
+	}
+}
+
 /**
  * @brief Reconfigure backend to panic mode.
  *
@@ -65,6 +65,18 @@ log_backend_std_panic(const struct log_output *const output)
 	log_output_flush(output);
 }
 
+/** @brief Write the messages gathered by a standard logger backend.
+ *
+ * @param output	Log output instance.
+ */
+static inline void
+log_backend_std_flush(const struct log_output *const output)
+{
+	if (atomic_get(&output->control_block->offset) != 0) {
+		log_output_flush(output);
+	}
+}
+
 /** @brief Report dropped messages to a standard logger backend.
  *
  * @param output	Log output instance.
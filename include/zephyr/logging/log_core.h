@@ -340,6 +340,10 @@ static inline char z_log_minimal_level_to_char(int level)
 	    !is_user_context && _level > Z_LOG_RUNTIME_FILTER(filters)) { \
 		break; \
 	} \
+	if (IS_ENABLED(CONFIG_LOG_RATE_LIMIT) && !is_user_context && \
+	    !z_log_rate_limit_check(_dsource)) { \
+		break; \
+	} \
 	if (IS_ENABLED(CONFIG_LOG2)) { \
 		int _mode; \
 		void *_src = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? \
@@ -420,6 +424,10 @@ static inline char z_log_minimal_level_to_char(int level)
 	    !is_user_context && _level > Z_LOG_RUNTIME_FILTER(filters)) { \
 		break; \
 	} \
+	if (IS_ENABLED(CONFIG_LOG_RATE_LIMIT) && !is_user_context && \
+	    !z_log_rate_limit_check(_dsource)) { \
+		break; \
+	} \
 	if (IS_ENABLED(CONFIG_LOG2)) { \
 		int mode; \
 		void *_src = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? \
@@ -581,6 +589,39 @@ static inline uint32_t log_dynamic_source_id(struct log_source_dynamic_data *dat
 			sizeof(struct log_source_dynamic_data);
 }
 
+/** @internal
+ * @brief Apply the rate limit and sampling of a source to a new message.
+ *
+ * @param data Address of the dynamic data of the source.
+ *
+ * @return True if the message is to be logged, false if it is suppressed.
+ */
+bool z_log_rate_limit(struct log_source_dynamic_data *data);
+
+/** @internal
+ * @brief Check if a new message of a source is to be logged.
+ *
+ * Only sources with a rate limit or sampling set take the slow path.
+ *
+ * @param data Address of the dynamic data of the source.
+ *
+ * @return True if the message is to be logged, false if it is suppressed.
+ */
+static inline bool z_log_rate_limit_check(struct log_source_dynamic_data *data)
+{
+#ifdef CONFIG_LOG_RATE_LIMIT
+	if (data->rate_limit.rate == 0U && data->rate_limit.sample <= 1U) {
+		return true;
+	}
+
+	return z_log_rate_limit(data);
+#else
+	ARG_UNUSED(data);
+
+	return true;
+#endif
+}
+
 /** @brief Dummy function to trigger log messages arguments type checking. */
 static inline __printf_like(1, 2)
 void z_log_printf_arg_checker(const char *fmt, ...)
@@ -801,6 +842,10 @@ __syscall void z_log_hexdump_from_user(uint32_t src_level_val,
 	    _level > Z_LOG_RUNTIME_FILTER(filters)) { \
 		break; \
 	} \
+	if (IS_ENABLED(CONFIG_LOG_RATE_LIMIT) && !is_user_context && \
+	    !z_log_rate_limit_check(_dsource)) { \
+		break; \
+	} \
 	if (IS_ENABLED(CONFIG_LOG2)) { \
 		void *_src = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? \
 			(void *)_dsource : (void *)_source; \
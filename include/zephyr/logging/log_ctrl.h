@@ -263,6 +263,69 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage);
  */
 int log_mem_get_max_usage(uint32_t *max);
 
+/**
+ * @brief Limit the rate of messages of a source.
+ *
+ * Messages are let through by a token bucket, holding up to @p burst
+ * messages and refilled with @p rate messages per second. Requires
+ * CONFIG_LOG_RATE_LIMIT.
+ *
+ * @param domain_id	ID of the domain.
+ * @param source_id	Source (module or instance) ID.
+ * @param rate		Messages per second, 0 to remove the limit.
+ * @param burst		Messages which may be logged at once, at least 1.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the source, rate or burst is invalid.
+ * @retval -ENOTSUP if rate limiting is not enabled.
+ */
+int log_rate_limit_set(uint32_t domain_id, int16_t source_id,
+		       uint32_t rate, uint32_t burst);
+
+/**
+ * @brief Keep one message in N of a source.
+ *
+ * Sampling applies before the rate limit. Requires CONFIG_LOG_RATE_LIMIT.
+ *
+ * @param domain_id	ID of the domain.
+ * @param source_id	Source (module or instance) ID.
+ * @param n		Keep one message in @p n, 0 or 1 to keep all.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the source or @p n is invalid.
+ * @retval -ENOTSUP if rate limiting is not enabled.
+ */
+int log_sample_set(uint32_t domain_id, int16_t source_id, uint32_t n);
+
+/**
+ * @brief Get the rate limit and sampling of a source.
+ *
+ * @param domain_id	ID of the domain.
+ * @param source_id	Source (module or instance) ID.
+ * @param[out] rate	Messages per second, 0 for no limit. May be NULL.
+ * @param[out] burst	Messages which may be logged at once. May be NULL.
+ * @param[out] n	One message in @p n is kept. May be NULL.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the source is invalid.
+ * @retval -ENOTSUP if rate limiting is not enabled.
+ */
+int log_rate_limit_get(uint32_t domain_id, int16_t source_id,
+		       uint32_t *rate, uint32_t *burst, uint32_t *n);
+
+/**
+ * @brief Get the number of messages of a source suppressed by its rate
+ *	  limit or sampling.
+ *
+ * @param domain_id	ID of the domain.
+ * @param source_id	Source (module or instance) ID.
+ * @param clear		True to reset the count.
+ *
+ * @return Number of suppressed messages, 0 if rate limiting is not enabled.
+ */
+uint32_t log_rate_limit_suppressed_get(uint32_t domain_id, int16_t source_id,
+				       bool clear);
+
 #if defined(CONFIG_LOG) && !defined(CONFIG_LOG_MODE_MINIMAL)
 #define LOG_CORE_INIT() log_core_init()
 #define LOG_PANIC() log_panic()
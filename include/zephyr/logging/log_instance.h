@@ -25,9 +25,27 @@ struct log_source_const_data {
 #endif
 };
 
+/** @brief Rate limiting state of a source of log messages. */
+struct log_source_rate_limit {
+	/* Thousandths of a message which may be logged */
+	uint32_t tokens;
+	/* Uptime of the last refill, in milliseconds */
+	uint32_t last;
+	uint32_t suppressed;
+	/* Messages per second, 0 for no limit */
+	uint16_t rate;
+	uint16_t burst;
+	/* Keep one message in sample, 0 or 1 to keep all */
+	uint16_t sample;
+	uint16_t count;
+};
+
 /** @brief Dynamic data associated with the source of log messages. */
 struct log_source_dynamic_data {
 	uint32_t filters;
+#ifdef CONFIG_LOG_RATE_LIMIT
+	struct log_source_rate_limit rate_limit;
+#endif
 #ifdef CONFIG_NIOS2
 	/* Workaround alert! Dummy data to ensure that structure is >8 bytes.
 	 * Nios2 uses global pointer register for structures <=8 bytes and
@@ -36,9 +54,15 @@ struct log_source_dynamic_data {
 	uint32_t dummy[2];
 #endif
 #if defined(CONFIG_RISCV) && defined(CONFIG_64BIT)
-	/* Workaround: RV64 needs to ensure that structure is just 8 bytes. */
+	/* Workaround: RV64 needs to ensure that structure is a multiple of
+	 * 8 bytes.
+	 */
+#ifdef CONFIG_LOG_RATE_LIMIT
+	uint32_t dummy[2];
+#else
 	uint32_t dummy;
 #endif
+#endif
 };
 
 /** @internal
@@ -51,6 +51,11 @@ extern "C" {
  */
 #define LOG_OUTPUT_FLAG_FORMAT_SYST		BIT(7)
 
+/** @brief Flag keeping the message in the output buffer, to be written
+ * together with the following ones. Effective with CONFIG_LOG_OUTPUT_BATCH.
+ */
+#define LOG_OUTPUT_FLAG_BATCH			BIT(8)
+
 /** @brief Supported backend logging format types for use
  * with log_format_set() API to switch log format at runtime.
  */
@@ -80,6 +85,10 @@ struct log_output_control_block {
 	atomic_t offset;
 	void *ctx;
 	const char *hostname;
+#ifdef CONFIG_LOG_OUTPUT_BATCH
+	/* End of the last whole message in the buffer */
+	size_t batch_end;
+#endif
 };
 
 /** @brief Log_output instance structure. */
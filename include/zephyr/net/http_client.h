@@ -220,6 +220,9 @@ struct http_client_internal_data {
 
 	/** Request timeout */
 	k_timeout_t timeout;
+
+	/** Request is sent over a persistent (keep-alive) connection */
+	bool persistent;
 };
 
 /**
@@ -329,6 +332,84 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+/**
+ * @brief Send one chunk of a chunked request body. This is meant to be
+ * called from a http_payload_cb_t callback of a request that has
+ * payload_len set to 0 and a "Transfer-Encoding: chunked" header field.
+ * The body must be terminated by sending a chunk of zero length.
+ *
+ * @param sock Socket id of the connection.
+ * @param data Chunk data.
+ * @param len Length of the chunk data, 0 for the last chunk.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_send_chunk(int sock, const void *data, size_t len);
+
+#if defined(CONFIG_HTTP_CLIENT_POOL)
+/**
+ * HTTP server endpoint, used as the key of a pooled connection.
+ */
+struct http_client_endpoint {
+	/** Host name or address of the server */
+	const char *host;
+
+	/** Port number of the server */
+	const char *port;
+
+	/** TLS security tag used for the connection, or a negative value
+	 * for a plain TCP connection.
+	 */
+	int sec_tag;
+};
+
+/**
+ * @brief Do a HTTP request over a pooled keep-alive connection.
+ *
+ * An idle connection to the same endpoint is reused if there is one,
+ * otherwise a new connection is opened. The connection is returned to
+ * the pool after the response unless the server asked to close it.
+ * The Host header field defaults to the endpoint host if req->host is
+ * not set.
+ *
+ * @param ep Server endpoint.
+ * @param req HTTP request information
+ * @param timeout Max timeout to wait for the data, in milliseconds.
+ * @param user_data User specified data that is passed to the callback.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_pool_req(const struct http_client_endpoint *ep,
+			 struct http_request *req,
+			 int32_t timeout, void *user_data);
+
+/**
+ * @brief Send several HTTP requests back to back over one pooled
+ * connection and then receive their responses in order (pipelining).
+ *
+ * Only idempotent methods (GET, HEAD, OPTIONS, PUT, DELETE) can be
+ * pipelined. If the connection is lost or closed by the server before
+ * all responses are received, the remaining requests are not retried.
+ *
+ * @param ep Server endpoint.
+ * @param reqs Array of HTTP requests.
+ * @param count Number of requests in the array.
+ * @param timeout Max timeout to wait for the data of each response,
+ *        in milliseconds.
+ * @param user_data User specified data that is passed to the callbacks.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_pool_req_pipelined(const struct http_client_endpoint *ep,
+				   struct http_request **reqs, size_t count,
+				   int32_t timeout, void *user_data);
+
+/**
+ * @brief Close all idle connections of the pool.
+ */
+void http_client_pool_flush(void);
+#endif /* CONFIG_HTTP_CLIENT_POOL */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,219 @@
+/** @file
+ * @brief HTTP server API
+ *
+ * An API for applications to serve static and dynamic HTTP resources
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_
+#define ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_
+
+/**
+ * @brief HTTP server API
+ * @defgroup http_server HTTP server API
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/http_parser.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Type of a HTTP server resource */
+enum http_resource_type {
+	/** Constant data linked into the image, sent without copying */
+	HTTP_RESOURCE_TYPE_STATIC,
+	/** File on a mounted file system */
+	HTTP_RESOURCE_TYPE_FS,
+	/** Content generated by a callback, sent with chunked encoding */
+	HTTP_RESOURCE_TYPE_DYNAMIC,
+};
+
+/**
+ * HTTP request being served. Passed to the callback of a dynamic resource.
+ */
+struct http_server_req {
+	/** Socket of the client connection */
+	int sock;
+
+	/** Request method */
+	enum http_method method;
+
+	/** Request URL, including any query string */
+	const char *url;
+
+	/** Request body, if the request had one */
+	const uint8_t *body;
+
+	/** Length of the request body */
+	size_t body_len;
+};
+
+/**
+ * @typedef http_resource_dynamic_cb_t
+ * @brief Callback generating the content of a dynamic resource.
+ *
+ * The response status line and headers are already sent when the callback
+ * is called. The content is sent with http_server_send_chunk(), the server
+ * terminates the response after the callback returns.
+ *
+ * @param req Request being served.
+ * @param user_data User data given in the resource definition.
+ *
+ * @return 0 if ok, <0 on error. The connection is closed on error.
+ */
+typedef int (*http_resource_dynamic_cb_t)(struct http_server_req *req,
+					  void *user_data);
+
+/**
+ * HTTP server resource. Resources are defined at build time with the
+ * HTTP_RESOURCE_*_DEFINE() macros and are kept in ROM.
+ */
+struct http_resource {
+	/** Absolute URL path of the resource, for example "/index.html" */
+	const char *url;
+
+	/** Value of the Content-Type header field */
+	const char *content_type;
+
+	/** Value of the Content-Encoding header field, may be NULL. Set it
+	 * for example to "gzip" for content that is stored compressed.
+	 */
+	const char *content_encoding;
+
+	/** Resource type */
+	enum http_resource_type type;
+
+	union {
+		/** HTTP_RESOURCE_TYPE_STATIC */
+		struct {
+			const uint8_t *data;
+			size_t len;
+		} static_data;
+
+		/** HTTP_RESOURCE_TYPE_FS */
+		const char *fs_path;
+
+		/** HTTP_RESOURCE_TYPE_DYNAMIC */
+		struct {
+			http_resource_dynamic_cb_t cb;
+			void *user_data;
+		} dynamic;
+	};
+};
+
+/**
+ * @brief Define a resource served from constant data.
+ *
+ * @param _name Name of the resource.
+ * @param _url URL path of the resource.
+ * @param _content_type Content type of the data.
+ * @param _content_encoding Content encoding of the data, or NULL.
+ * @param _data Pointer to the constant data.
+ * @param _len Length of the data.
+ */
+#define HTTP_RESOURCE_STATIC_DEFINE(_name, _url, _content_type,		\
+				    _content_encoding, _data, _len)	\
+	const STRUCT_SECTION_ITERABLE(http_resource, _name) = {		\
+		.url = _url,						\
+		.content_type = _content_type,				\
+		.content_encoding = _content_encoding,			\
+		.type = HTTP_RESOURCE_TYPE_STATIC,			\
+		.static_data = {					\
+			.data = _data,					\
+			.len = _len,					\
+		},							\
+	}
+
+/**
+ * @brief Define a resource served from a file.
+ *
+ * @param _name Name of the resource.
+ * @param _url URL path of the resource.
+ * @param _content_type Content type of the file.
+ * @param _content_encoding Content encoding of the file, or NULL.
+ * @param _path Path of the file.
+ */
+#define HTTP_RESOURCE_FS_DEFINE(_name, _url, _content_type,		\
+				_content_encoding, _path)		\
+	const STRUCT_SECTION_ITERABLE(http_resource, _name) = {		\
+		.url = _url,						\
+		.content_type = _content_type,				\
+		.content_encoding = _content_encoding,			\
+		.type = HTTP_RESOURCE_TYPE_FS,				\
+		.fs_path = _path,					\
+	}
+
+/**
+ * @brief Define a resource generated by a callback.
+ *
+ * @param _name Name of the resource.
+ * @param _url URL path of the resource.
+ * @param _content_type Content type of the generated content.
+ * @param _cb Callback generating the content.
+ * @param _user_data User data passed to the callback.
+ */
+#define HTTP_RESOURCE_DYNAMIC_DEFINE(_name, _url, _content_type,	\
+				     _cb, _user_data)			\
+	const STRUCT_SECTION_ITERABLE(http_resource, _name) = {		\
+		.url = _url,						\
+		.content_type = _content_type,				\
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,			\
+		.dynamic = {						\
+			.cb = _cb,					\
+			.user_data = _user_data,			\
+		},							\
+	}
+
+/**
+ * @brief Send one chunk of a dynamic resource.
+ *
+ * @param req Request being served.
+ * @param data Chunk data.
+ * @param len Length of the chunk data. Zero length chunks are ignored.
+ *
+ * @return <0 if error, >=0 amount of data sent to the client
+ */
+int http_server_send_chunk(struct http_server_req *req, const void *data,
+			   size_t len);
+
+/**
+ * @brief Start the HTTP server.
+ *
+ * The server listens on the given port on all enabled IP families and
+ * serves the connections with CONFIG_HTTP_SERVER_WORKERS worker threads.
+ *
+ * @param port Port number to listen on.
+ *
+ * @return 0 if ok, <0 if error
+ */
+int http_server_start(uint16_t port);
+
+/**
+ * @brief Stop the HTTP server.
+ *
+ * Stops accepting new connections, closes the existing ones and waits
+ * for the worker threads to finish.
+ *
+ * @return 0 if ok, <0 if error
+ */
+int http_server_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_ */
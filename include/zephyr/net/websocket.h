@@ -151,6 +151,51 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout);
 
+/**
+ * @brief Start streaming a websocket frame to peer.
+ *
+ * @details The function sends the websocket header of a frame whose payload
+ * is then given with one or more websocket_send_frame_data() calls. This
+ * allows sending large frames without having the whole payload in one
+ * buffer. Only one frame can be streamed at a time per websocket.
+ *
+ * @param ws_sock Websocket id returned by websocket_connect().
+ * @param payload_len Total length of the frame payload.
+ * @param opcode Operation code (text, binary, ping, pong, close)
+ * @param mask Mask the data, see RFC 6455 for details
+ * @param final Is this final frame of the message, see websocket_send_msg().
+ * @param timeout How long to try to send the header. The value is in
+ *        milliseconds. Value SYS_FOREVER_MS means to wait forever.
+ *
+ * @return 0 if ok, <0 if error. -EALREADY if the payload of the previous
+ *         frame is not fully sent yet.
+ */
+int websocket_send_frame_begin(int ws_sock, uint64_t payload_len,
+			       enum websocket_opcode opcode, bool mask,
+			       bool final, int32_t timeout);
+
+/**
+ * @brief Send payload of a frame started with websocket_send_frame_begin().
+ *
+ * @details The data is passed to the socket as is, without copying it. If
+ * the frame is masked, the data is masked in place, so the buffers must be
+ * writable and their content is not valid after the call. The iovec array
+ * is also modified while the data is sent.
+ *
+ * @param ws_sock Websocket id returned by websocket_connect().
+ * @param iov Buffers holding the next part of the payload.
+ * @param iovcnt Number of buffers.
+ * @param timeout How long to try to send the data. The value is in
+ *        milliseconds. Value SYS_FOREVER_MS means to wait forever.
+ *
+ * @return <0 if error, >=0 amount of payload bytes sent. -EMSGSIZE if the
+ *         data does not fit in the payload length given when the frame was
+ *         started. On other errors the frame is aborted and the connection
+ *         should be closed.
+ */
+int websocket_send_frame_data(int ws_sock, struct iovec *iov, size_t iovcnt,
+			      int32_t timeout);
+
 /**
  * @brief Receive websocket msg from peer.
  *
@@ -71,6 +71,10 @@ struct stats_hdr {
 #ifdef CONFIG_STATS_NAMES
 	const struct stats_name_map *s_map;
 	int s_map_cnt;
+#endif
+#ifdef CONFIG_STATS_PERF
+	/* Updates the entries of computed groups before they are walked */
+	void (*s_refresh)(struct stats_hdr *hdr);
 #endif
 	struct stats_hdr *s_next;
 };
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Performance counters.
+ *
+ * Performance counters record the duration of a code path, in cycles, into a
+ * logarithmic histogram.  Each CPU accumulates into its own histogram, so
+ * concurrent recordings do not contend with each other.
+ *
+ * Each counter is exported as a statistics group named after its variable,
+ * by convention prefixed with "perf_".  The group has the following 32-bit
+ * entries, in nanoseconds except for the count:
+ *
+ * - count: number of recorded durations.
+ * - min, max, mean: smallest, largest and average duration.
+ * - p50, p90, p99: percentiles of the durations.
+ *
+ * The entries are computed from the histograms when the group is walked,
+ * e.g. by the "stats list" shell command or the mcumgr statistics group.
+ * Percentiles are upper bounds of the histogram buckets, whose width is set
+ * by CONFIG_STATS_PERF_PRECISION.
+ */
+
+#ifndef ZEPHYR_INCLUDE_STATS_STATS_PERF_H_
+#define ZEPHYR_INCLUDE_STATS_STATS_PERF_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/stats/stats.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CONFIG_STATS_PERF
+
+/** @cond INTERNAL_HIDDEN */
+
+#define STATS_PERF_SUB_BUCKETS BIT(CONFIG_STATS_PERF_PRECISION)
+#define STATS_PERF_BUCKETS \
+	((33 - CONFIG_STATS_PERF_PRECISION) * STATS_PERF_SUB_BUCKETS)
+
+STATS_SECT_START(perf_counter)
+STATS_SECT_ENTRY32(count)
+STATS_SECT_ENTRY32(min)
+STATS_SECT_ENTRY32(max)
+STATS_SECT_ENTRY32(mean)
+STATS_SECT_ENTRY32(p50)
+STATS_SECT_ENTRY32(p90)
+STATS_SECT_ENTRY32(p99)
+STATS_SECT_END;
+
+struct stats_perf_cpu {
+	struct k_spinlock lock;
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+	uint32_t buckets[STATS_PERF_BUCKETS];
+};
+
+/** @endcond */
+
+/** Performance counter. */
+struct stats_perf {
+	/** @cond INTERNAL_HIDDEN */
+	STATS_SECT_DECL(perf_counter) group;
+	const char *name;
+	struct stats_perf_cpu cpus[CONFIG_MP_NUM_CPUS];
+	/** @endcond */
+};
+
+/**
+ * @brief Statically define a performance counter.
+ *
+ * The counter is registered as the statistics group @p name during system
+ * initialization.  It can record durations before that.
+ *
+ * @param name Name of the counter variable.
+ */
+#define STATS_PERF_DEFINE(name)				\
+	STRUCT_SECTION_ITERABLE(stats_perf, name) = {	\
+		.name = #name,				\
+	}
+
+/**
+ * @brief Declare a performance counter defined in another file.
+ *
+ * @param name Name of the counter variable.
+ */
+#define STATS_PERF_DECLARE(name) extern struct stats_perf name
+
+/**
+ * @brief Record a duration in a performance counter.
+ *
+ * Can be called from any context, except user mode where it does nothing.
+ *
+ * @param perf Performance counter.
+ * @param cycles Duration, in cycles of k_cycle_get_32().
+ */
+void stats_perf_record(struct stats_perf *perf, uint32_t cycles);
+
+/**
+ * @brief Clear a performance counter.
+ *
+ * @param perf Performance counter.
+ */
+void stats_perf_reset(struct stats_perf *perf);
+
+/**
+ * @brief Get the duration recorded at a percentile.
+ *
+ * @param perf Performance counter.
+ * @param permille Percentile, in tenths of percent (e.g. 990 for p99).
+ *
+ * @return Upper bound of the durations at this percentile, in cycles;
+ *         0 if nothing was recorded.
+ */
+uint32_t stats_perf_percentile(struct stats_perf *perf, uint32_t permille);
+
+/** @cond INTERNAL_HIDDEN */
+static inline uint32_t z_stats_perf_now(void)
+{
+#ifdef CONFIG_USERSPACE
+	/* The cycle counter might not be readable in user mode */
+	if (k_is_user_context()) {
+		return 0;
+	}
+#endif
+	return k_cycle_get_32();
+}
+/** @endcond */
+
+/**
+ * @brief Start measuring a hot path.
+ *
+ * @return Start of the measurement, to pass to STATS_PERF_END().
+ */
+#define STATS_PERF_START() z_stats_perf_now()
+
+/**
+ * @brief End measuring a hot path, and record its duration.
+ *
+ * @param name Name of the counter variable.
+ * @param start Value returned by STATS_PERF_START().
+ */
+#define STATS_PERF_END(name, start) \
+	stats_perf_record(&(name), z_stats_perf_now() - (start))
+
+#else /* CONFIG_STATS_PERF */
+
+#define STATS_PERF_DEFINE(name)
+#define STATS_PERF_DECLARE(name)
+#define STATS_PERF_START() 0U
+#define STATS_PERF_END(name, start) ((void)(start))
+
+#endif /* !CONFIG_STATS_PERF */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_STATS_STATS_PERF_H_ */
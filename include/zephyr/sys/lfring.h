@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Lock-free ring buffer APIs.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_LFRING_H_
+#define ZEPHYR_INCLUDE_SYS_LFRING_H_
+
+/*
+ * sys_lfring lives in user memory. Elements are passed without taking
+ * any lock or masking interrupts, so non-blocking operations may be
+ * used from ISRs and, when user mode is enabled, from user threads
+ * without a system call. The kernel is only entered to block when the
+ * ring is empty or full, through a futex when user mode is enabled and
+ * through a k_event otherwise.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup lfring_apis Lock-free ring buffer APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Lock-free ring buffer
+ *
+ * The ring holds a power of two number of fixed size elements. The single
+ * producer, single consumer (SPSC) variant is two free running indices.
+ * The multiple producer, multiple consumer (MPMC) variant additionally
+ * keeps a sequence number per slot, through which producers and consumers
+ * claim slots with a compare and swap.
+ */
+struct sys_lfring {
+	/** Index of the next element to write */
+	atomic_t tail;
+	/** Index of the next element to read */
+	atomic_t head;
+	/** Per slot sequence numbers relative to the slot index, NULL for
+	 * a SPSC ring
+	 */
+	atomic_t *seq;
+	/** Element storage */
+	uint8_t *buf;
+	/** Number of elements minus one */
+	uint32_t mask;
+	/** Size of one element, in bytes */
+	size_t elem_size;
+	/** Directions in which threads are blocked */
+	atomic_t waiters;
+#ifdef CONFIG_USERSPACE
+	struct k_futex not_empty;
+	struct k_futex not_full;
+#else
+	struct k_event not_empty;
+	struct k_event not_full;
+#endif
+};
+
+/** @cond INTERNAL_HIDDEN */
+
+#ifdef CONFIG_USERSPACE
+#define Z_LFRING_WAIT_INITIALIZER(_obj) { 0 }
+#else
+#define Z_LFRING_WAIT_INITIALIZER(_obj) Z_EVENT_INITIALIZER(_obj)
+#endif
+
+#define Z_LFRING_LEN_VALID(_len) \
+	(((_len) != 0) && (((_len) & ((_len) - 1)) == 0))
+
+/* With a single element, the sequence number of an element put in a lap
+ * would be the one of a free element in the next lap
+ */
+#define Z_LFRING_MPMC_LEN_VALID(_len) \
+	(Z_LFRING_LEN_VALID(_len) && ((_len) >= 2))
+
+#define Z_LFRING_INITIALIZER(_name, _buf, _seq, _type, _len) \
+	{ \
+		.seq = _seq, \
+		.buf = (uint8_t *)_buf, \
+		.mask = (_len) - 1, \
+		.elem_size = sizeof(_type), \
+		.not_empty = Z_LFRING_WAIT_INITIALIZER(_name.not_empty), \
+		.not_full = Z_LFRING_WAIT_INITIALIZER(_name.not_full), \
+	}
+
+/** @endcond */
+
+/**
+ * @brief Statically define and initialize a SPSC lock-free ring
+ *
+ * At most one thread or ISR may put elements into the ring, and at most
+ * one may get elements from it. The ring can be accessed outside the
+ * module where it is defined using:
+ *
+ * @code extern struct sys_lfring <name>; @endcode
+ *
+ * Route the ring to memory domains using K_APP_DMEM(), along with its
+ * element storage named <name>_buf.
+ *
+ * @param _name Name of the ring.
+ * @param _type Type of the elements.
+ * @param _len Maximum number of elements, a power of two.
+ */
+#define SYS_LFRING_SPSC_DEFINE(_name, _type, _len) \
+	_type _name##_buf[_len]; \
+	struct sys_lfring _name = \
+		Z_LFRING_INITIALIZER(_name, _name##_buf, NULL, _type, _len); \
+	BUILD_ASSERT(Z_LFRING_LEN_VALID(_len), \
+		     "length must be a power of two")
+
+/**
+ * @brief Statically define and initialize a MPMC lock-free ring
+ *
+ * Any number of threads and ISRs may put elements into the ring and get
+ * elements from it. The ring can be accessed outside the module where it
+ * is defined using:
+ *
+ * @code extern struct sys_lfring <name>; @endcode
+ *
+ * Route the ring to memory domains using K_APP_DMEM(), along with its
+ * element storage named <name>_buf and its sequence numbers named
+ * <name>_seq.
+ *
+ * @param _name Name of the ring.
+ * @param _type Type of the elements.
+ * @param _len Maximum number of elements, a power of two, at least 2.
+ */
+#define SYS_LFRING_MPMC_DEFINE(_name, _type, _len) \
+	_type _name##_buf[_len]; \
+	atomic_t _name##_seq[_len]; \
+	struct sys_lfring _name = \
+		Z_LFRING_INITIALIZER(_name, _name##_buf, _name##_seq, _type, \
+				     _len); \
+	BUILD_ASSERT(Z_LFRING_MPMC_LEN_VALID(_len), \
+		     "length must be a power of two, at least 2")
+
+/**
+ * @brief Initialize a lock-free ring
+ *
+ * The ring is a SPSC ring if @a seq is NULL, and a MPMC ring otherwise.
+ *
+ * @param ring Address of the ring.
+ * @param buf Storage for @a len elements of @a elem_size bytes.
+ * @param seq Storage for @a len sequence numbers, or NULL.
+ * @param elem_size Size of one element, in bytes.
+ * @param len Maximum number of elements, a power of two, at least 2 for a
+ *	      MPMC ring.
+ *
+ * @retval 0 Ring initialized.
+ * @retval -EINVAL Invalid parameters.
+ */
+int sys_lfring_init(struct sys_lfring *ring, void *buf, atomic_t *seq,
+		    size_t elem_size, uint32_t len);
+
+/**
+ * @brief Put an element into a lock-free ring
+ *
+ * The element is copied into the ring. Threads waiting for an element
+ * are woken only if the ring was found empty by one of them.
+ *
+ * @funcprops \isr_ok if @a timeout is K_NO_WAIT
+ *
+ * @param ring Address of the ring.
+ * @param elem Address of the element to copy.
+ * @param timeout Non-negative waiting period to wait for free space,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Element put into the ring.
+ * @retval -ENOMSG Returned without waiting, the ring is full.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int sys_lfring_put(struct sys_lfring *ring, const void *elem,
+		   k_timeout_t timeout);
+
+/**
+ * @brief Get an element from a lock-free ring
+ *
+ * The element is copied out of the ring. Threads waiting for free space
+ * are woken only if the ring was found full by one of them.
+ *
+ * @funcprops \isr_ok if @a timeout is K_NO_WAIT
+ *
+ * @param ring Address of the ring.
+ * @param elem Address of the area receiving the element.
+ * @param timeout Non-negative waiting period to wait for an element,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Element copied out of the ring.
+ * @retval -ENOMSG Returned without waiting, the ring is empty.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int sys_lfring_get(struct sys_lfring *ring, void *elem, k_timeout_t timeout);
+
+/**
+ * @brief Get the number of elements in a lock-free ring
+ *
+ * For a MPMC ring, the value includes slots claimed by producers or
+ * consumers which are still being copied.
+ *
+ * @param ring Address of the ring.
+ *
+ * @return Number of elements.
+ */
+static inline uint32_t sys_lfring_num_used_get(struct sys_lfring *ring)
+{
+	return (uint32_t)(atomic_get(&ring->tail) - atomic_get(&ring->head));
+}
+
+/**
+ * @brief Get the capacity of a lock-free ring
+ *
+ * @param ring Address of the ring.
+ *
+ * @return Maximum number of elements.
+ */
+static inline uint32_t sys_lfring_capacity_get(struct sys_lfring *ring)
+{
+	return ring->mask + 1U;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_LFRING_H_ */
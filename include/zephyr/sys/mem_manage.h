@@ -113,6 +113,17 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+	struct {
+		/** Number of pages paged in ahead of page faults */
+		unsigned long			cnt;
+
+		/** Number of pages paged in ahead which were accessed */
+		unsigned long			hits;
+
+		/** Number of pages paged in ahead evicted without access */
+		unsigned long			misses;
+	} fault_ahead;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -507,6 +518,19 @@ __syscall void k_mem_paging_histogram_backing_store_page_in_get(
 __syscall void k_mem_paging_histogram_backing_store_page_out_get(
 	struct k_mem_paging_histogram_t *hist);
 
+/**
+ * Get the page fault timing histogram
+ *
+ * This populates the timing histogram struct being passed in
+ * as argument, with the time taken to service page faults, including
+ * evicting a page and paging in pages ahead of the fault. It uses the
+ * bounds of the backing store histograms.
+ *
+ * @param[in,out] hist Timing histogram struct to be filled.
+ */
+__syscall void k_mem_paging_histogram_page_fault_get(
+	struct k_mem_paging_histogram_t *hist);
+
 #include <syscalls/mem_manage.h>
 
 /** @} */
@@ -11,9 +11,11 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * With CONFIG_SYS_MUTEX_FAST_PATH, uncontended sys_mutexes are locked and
+ * unlocked with simple atomic ops instead of syscalls, similar to Linux's
+ * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI. The kernel is only entered the first
+ * time a thread locks a mutex, when a thread has to wait for the mutex, and
+ * by the owner to release a mutex other threads are waiting for.
  */
 
 #ifdef __cplusplus
@@ -24,15 +26,69 @@ extern "C" {
 #include <zephyr/sys/atomic.h>
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+#include <zephyr/kernel.h>
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Tag of the owner in sys_mutex::val while the backing k_mutex is held on
+ * behalf of the owner, because other threads wait for the mutex
+ */
+#define Z_SYS_MUTEX_CONTENDED BIT(0)
+
+/** @endcond */
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* With CONFIG_SYS_MUTEX_FAST_PATH, the owner thread, possibly tagged
+	 * with Z_SYS_MUTEX_CONTENDED, or 0 if the mutex is not locked.
+	 * Unused otherwise.
 	 */
 	atomic_t val;
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	/* Number of times the owner locked the mutex, only accessed by the
+	 * owner
+	 */
+	uint32_t lock_count;
+#endif
 };
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/** @cond INTERNAL_HIDDEN */
+
+/* Mutexes the kernel locked for the current thread. Only these are
+ * accessed in user mode, so that a mutex outside of the memory domain of
+ * the thread, or an object which is not a mutex, is reported by the kernel
+ * instead of faulting or being corrupted.
+ */
+#define Z_SYS_MUTEX_GRANTED_COUNT 4
+
+extern __thread struct sys_mutex *z_sys_mutex_granted[Z_SYS_MUTEX_GRANTED_COUNT];
+extern __thread uint8_t z_sys_mutex_granted_next;
+
+static inline bool z_sys_mutex_is_granted(struct sys_mutex *mutex)
+{
+	for (int i = 0; i < Z_SYS_MUTEX_GRANTED_COUNT; i++) {
+		if (z_sys_mutex_granted[i] == mutex) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static inline void z_sys_mutex_grant(struct sys_mutex *mutex)
+{
+	if (!z_sys_mutex_is_granted(mutex)) {
+		z_sys_mutex_granted[z_sys_mutex_granted_next] = mutex;
+		z_sys_mutex_granted_next = (z_sys_mutex_granted_next + 1U) %
+					   Z_SYS_MUTEX_GRANTED_COUNT;
+	}
+}
+
+/** @endcond */
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 /**
  * @defgroup user_mutex_apis User mode mutex APIs
  * @ingroup kernel_apis
@@ -101,8 +157,42 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	atomic_val_t val;
+	int ret;
+
+	if (mutex == NULL) {
+		return -EINVAL;
+	}
+
+	if (z_sys_mutex_is_granted(mutex)) {
+		val = atomic_get(&mutex->val);
+		if ((val & ~Z_SYS_MUTEX_CONTENDED) == self) {
+			mutex->lock_count++;
+			return 0;
+		}
+
+		if (val == 0 && atomic_cas(&mutex->val, 0, self)) {
+			mutex->lock_count = 1U;
+			return 0;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -EBUSY;
+		}
+	}
+
+	/* The kernel also maintains the lock count on this path */
+	ret = z_sys_mutex_kernel_lock(mutex, timeout);
+	if (ret == 0) {
+		z_sys_mutex_grant(mutex);
+	}
+
+	return ret;
+#else
 	return z_sys_mutex_kernel_lock(mutex, timeout);
+#endif
 }
 
 /**
@@ -124,8 +214,32 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)k_current_get();
+
+	if (mutex == NULL) {
+		return -EINVAL;
+	}
+
+	/* Other threads never modify the count while we own the mutex */
+	if (z_sys_mutex_is_granted(mutex) &&
+	    (atomic_get(&mutex->val) & ~Z_SYS_MUTEX_CONTENDED) == self) {
+		if (mutex->lock_count > 1U) {
+			mutex->lock_count--;
+			return 0;
+		}
+
+		mutex->lock_count = 0U;
+		if (atomic_cas(&mutex->val, self, 0)) {
+			return 0;
+		}
+	}
+
+	/* Contended, or an error to be reported by the kernel */
 	return z_sys_mutex_kernel_unlock(mutex);
+#else
+	return z_sys_mutex_kernel_unlock(mutex);
+#endif
 }
 
 #include <syscalls/mutex.h>
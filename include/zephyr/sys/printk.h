@@ -47,6 +47,16 @@ extern "C" {
 extern __printf_like(1, 2) void printk(const char *fmt, ...);
 extern __printf_like(1, 0) void vprintk(const char *fmt, va_list ap);
 
+#ifdef CONFIG_PRINTK_DEFERRED
+/**
+ * @brief Output the pending deferred messages, and stop deferring.
+ *
+ * Called on fatal errors, the messages printed afterwards are output
+ * synchronously.
+ */
+void z_printk_panic(void);
+#endif
+
 #else
 static inline __printf_like(1, 2) void printk(const char *fmt, ...)
 {
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief public sys_rwlock APIs.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_RWLOCK_H_
+#define ZEPHYR_INCLUDE_SYS_RWLOCK_H_
+
+/*
+ * sys_rwlock exists in user memory. It is acquired and released with
+ * atomic operations, without system calls from user mode, as long as no
+ * thread has to wait for it. Waiting threads sleep on a futex when user
+ * mode is enabled, and on a k_event otherwise.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * sys_rwlock structure
+ */
+struct sys_rwlock {
+	/* Number of readers, writer and waiter flags */
+	atomic_t state;
+#ifdef CONFIG_USERSPACE
+	struct k_futex futex;
+#else
+	struct k_event event;
+#endif
+};
+
+/**
+ * @defgroup user_rwlock_apis User mode reader/writer lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Statically define and initialize a sys_rwlock
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct sys_rwlock <name>; @endcode
+ *
+ * Route this to memory domains using K_APP_DMEM().
+ *
+ * @param _name Name of the lock.
+ */
+#ifdef CONFIG_USERSPACE
+#define SYS_RWLOCK_DEFINE(_name) \
+	struct sys_rwlock _name
+#else
+#define SYS_RWLOCK_DEFINE(_name) \
+	struct sys_rwlock _name = { \
+		.event = Z_EVENT_INITIALIZER(_name.event) \
+	}
+#endif
+
+/**
+ * @brief Initialize a reader/writer lock
+ *
+ * This routine initializes a sys_rwlock, prior to its first use. When
+ * user mode is enabled, the lock must have been defined with
+ * SYS_RWLOCK_DEFINE().
+ *
+ * @param rwlock Address of the lock.
+ *
+ * @retval 0 Lock initialized.
+ * @retval -EINVAL Invalid parameters.
+ */
+int sys_rwlock_init(struct sys_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader/writer lock for reading
+ *
+ * Any number of threads may hold the lock for reading at the same time,
+ * while no thread holds it for writing. Threads waiting to write have
+ * precedence over new readers. The lock is not recursive.
+ *
+ * @param rwlock Address of the lock, which may reside in user memory.
+ * @param timeout Waiting period to lock the lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock locked for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int sys_rwlock_read_lock(struct sys_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader/writer lock locked for reading
+ *
+ * @param rwlock Address of the lock, which may reside in user memory.
+ *
+ * @retval 0 Lock unlocked.
+ * @retval -EINVAL The lock is not locked for reading.
+ */
+int sys_rwlock_read_unlock(struct sys_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader/writer lock for writing
+ *
+ * A single thread may hold the lock for writing, while no thread holds it
+ * for reading. The lock is not recursive, and the writer is not tracked:
+ * there is no priority inheritance.
+ *
+ * @param rwlock Address of the lock, which may reside in user memory.
+ * @param timeout Waiting period to lock the lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock locked for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int sys_rwlock_write_lock(struct sys_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader/writer lock locked for writing
+ *
+ * @param rwlock Address of the lock, which may reside in user memory.
+ *
+ * @retval 0 Lock unlocked.
+ * @retval -EINVAL The lock is not locked for writing.
+ */
+int sys_rwlock_write_unlock(struct sys_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_RWLOCK_H_ */
@@ -25,8 +25,21 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack = 0U;
+#endif
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Takes effect the next time the timeout is added */
+static inline void z_timeout_slack_set(struct _timeout *to, k_timeout_t slack)
+{
+	__ASSERT(!K_TIMEOUT_EQ(slack, K_FOREVER) && Z_TICK_ABS(slack.ticks) < 0,
+		 "slack must be a relative duration");
+	to->slack = (uint32_t)CLAMP(slack.ticks, 0, INT32_MAX);
+}
+#endif
+
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout);
 
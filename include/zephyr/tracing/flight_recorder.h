@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_TRACING_FLIGHT_RECORDER_H_
+#define ZEPHYR_INCLUDE_TRACING_FLIGHT_RECORDER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Tracing flight recorder
+ * @defgroup tracing_flight_recorder Tracing flight recorder
+ * @ingroup subsys_tracing_apis
+ * @{
+ */
+
+/*
+ * The flight recorder backend keeps the latest tracing packets in a
+ * circular buffer, overwriting the oldest ones. Each packet is preceded
+ * by a 4 bytes header: its length and the low 16 bits of the uptime in
+ * milliseconds when it was recorded, both little endian.
+ */
+
+#ifdef CONFIG_TRACING_BACKEND_FLIGHT_RECORDER
+
+/**
+ * @brief Freeze the flight recorder.
+ *
+ * Stop recording, so that the buffer holds the packets leading to the
+ * event which triggered the freeze. Packets older than
+ * CONFIG_TRACING_FLIGHT_RECORDER_WINDOW_MS are discarded, and the
+ * buffer is rearranged so that the packets are contiguous, oldest
+ * first. Freezing a frozen recorder has no effect.
+ *
+ * This is called on fatal errors, failed assertions and task watchdog
+ * timeouts. It can be called from any context, including ISRs.
+ */
+void tracing_flight_recorder_freeze(void);
+
+/**
+ * @brief Clear the flight recorder and resume recording.
+ */
+void tracing_flight_recorder_resume(void);
+
+/**
+ * @brief Check if the flight recorder is frozen.
+ *
+ * @return true if frozen, false if recording.
+ */
+bool tracing_flight_recorder_is_frozen(void);
+
+/**
+ * @brief Get the contents of a frozen flight recorder.
+ *
+ * @param data Set to the address of the first packet header.
+ *
+ * @return Number of bytes of packets, with their headers, 0 if the
+ *         recorder is not frozen.
+ */
+size_t tracing_flight_recorder_data_get(const uint8_t **data);
+
+#else
+
+static inline void tracing_flight_recorder_freeze(void)
+{
+}
+
+static inline void tracing_flight_recorder_resume(void)
+{
+}
+
+static inline bool tracing_flight_recorder_is_frozen(void)
+{
+	return false;
+}
+
+static inline size_t tracing_flight_recorder_data_get(const uint8_t **data)
+{
+	ARG_UNUSED(data);
+
+	return 0;
+}
+
+#endif /* CONFIG_TRACING_BACKEND_FLIGHT_RECORDER */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_TRACING_FLIGHT_RECORDER_H_ */
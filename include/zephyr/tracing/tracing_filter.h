@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_TRACING_TRACING_FILTER_H_
+#define ZEPHYR_INCLUDE_TRACING_TRACING_FILTER_H_
+
+#include <stdbool.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Runtime tracing filters
+ * @defgroup subsys_tracing_filter Runtime tracing filters
+ * @ingroup subsys_tracing
+ * @{
+ */
+
+struct k_thread;
+
+/**
+ * @brief Tracing event classes, one per kernel object type.
+ */
+enum tracing_class {
+	TRACING_CLASS_THREAD,
+	TRACING_CLASS_WORK,
+	TRACING_CLASS_SEM,
+	TRACING_CLASS_MUTEX,
+	TRACING_CLASS_CONDVAR,
+	TRACING_CLASS_QUEUE,
+	TRACING_CLASS_FIFO,
+	TRACING_CLASS_LIFO,
+	TRACING_CLASS_STACK,
+	TRACING_CLASS_MSGQ,
+	TRACING_CLASS_MBOX,
+	TRACING_CLASS_PIPE,
+	TRACING_CLASS_HEAP,
+	TRACING_CLASS_MEM_SLAB,
+	TRACING_CLASS_TIMER,
+	TRACING_CLASS_EVENT,
+	TRACING_CLASS_POLL,
+	TRACING_CLASS_PM,
+
+	TRACING_CLASS_COUNT
+};
+
+/** Mask of all the tracing event classes */
+#define TRACING_CLASS_ALL BIT_MASK(TRACING_CLASS_COUNT)
+
+/**
+ * @brief Set the classes of events to trace.
+ *
+ * @param mask Mask of BIT(TRACING_CLASS_*), all classes are traced by
+ *             default.
+ */
+void tracing_filter_class_set(uint32_t mask);
+
+/**
+ * @brief Get the classes of events traced.
+ *
+ * @return Mask of BIT(TRACING_CLASS_*).
+ */
+uint32_t tracing_filter_class_get(void);
+
+/**
+ * @brief Get the name of a class of events.
+ *
+ * @param class Class of events.
+ *
+ * @return Name of the class, NULL if invalid.
+ */
+const char *tracing_filter_class_name(enum tracing_class class);
+
+/**
+ * @brief Only trace the events of a set of threads.
+ *
+ * Once a thread is added, only events occurring in the context of the
+ * threads of the set are traced, events occurring in ISRs are not.
+ *
+ * @param thread Thread to add to the set.
+ *
+ * @retval 0 Thread added, or already in the set.
+ * @retval -ENOMEM The set is full.
+ */
+int tracing_filter_thread_add(const struct k_thread *thread);
+
+/**
+ * @brief Remove a thread from the set of traced threads.
+ *
+ * @param thread Thread to remove from the set.
+ *
+ * @retval 0 Thread removed.
+ * @retval -ENOENT Thread not in the set.
+ */
+int tracing_filter_thread_remove(const struct k_thread *thread);
+
+/**
+ * @brief Only trace the events of a set of kernel objects.
+ *
+ * Once an object is added, events related to a kernel object are only
+ * traced for the objects of the set. Events not related to an object,
+ * such as thread switches, are not filtered by object.
+ *
+ * @param obj Kernel object to add to the set.
+ *
+ * @retval 0 Object added, or already in the set.
+ * @retval -ENOMEM The set is full.
+ */
+int tracing_filter_object_add(const void *obj);
+
+/**
+ * @brief Remove a kernel object from the set of traced objects.
+ *
+ * @param obj Kernel object to remove from the set.
+ *
+ * @retval 0 Object removed.
+ * @retval -ENOENT Object not in the set.
+ */
+int tracing_filter_object_remove(const void *obj);
+
+/**
+ * @brief Trace all events again.
+ *
+ * Enable all the classes of events and empty the sets of threads and
+ * objects.
+ */
+void tracing_filter_reset(void);
+
+/**
+ * @brief Handle a filter command from the tracing command channel.
+ *
+ * Commands are "class <mask>", "thread add|remove <address>",
+ * "object add|remove <address>" and "reset", numbers in hexadecimal.
+ *
+ * @param cmd Command, without the "filter " prefix.
+ * @param length Command length.
+ *
+ * @retval 0 Command handled.
+ * @retval -EINVAL Invalid command.
+ * @return Other negative errno from the filter functions.
+ */
+int tracing_filter_cmd(const char *cmd, uint32_t length);
+
+/** @cond INTERNAL_HIDDEN */
+
+struct z_tracing_filter {
+	/* Classes of events traced */
+	uint32_t classes;
+	/* Set when a thread or object set is not empty */
+	bool narrowed;
+};
+
+extern struct z_tracing_filter z_tracing_filter;
+
+bool z_tracing_filter_match(const void *obj);
+
+#define sys_port_trace_class_k_thread TRACING_CLASS_THREAD
+#define sys_port_trace_class_k_work TRACING_CLASS_WORK
+#define sys_port_trace_class_k_work_queue TRACING_CLASS_WORK
+#define sys_port_trace_class_k_work_delayable TRACING_CLASS_WORK
+#define sys_port_trace_class_k_work_poll TRACING_CLASS_WORK
+#define sys_port_trace_class_k_sem TRACING_CLASS_SEM
+#define sys_port_trace_class_k_mutex TRACING_CLASS_MUTEX
+#define sys_port_trace_class_k_condvar TRACING_CLASS_CONDVAR
+#define sys_port_trace_class_k_queue TRACING_CLASS_QUEUE
+#define sys_port_trace_class_k_fifo TRACING_CLASS_FIFO
+#define sys_port_trace_class_k_lifo TRACING_CLASS_LIFO
+#define sys_port_trace_class_k_stack TRACING_CLASS_STACK
+#define sys_port_trace_class_k_msgq TRACING_CLASS_MSGQ
+#define sys_port_trace_class_k_mbox TRACING_CLASS_MBOX
+#define sys_port_trace_class_k_pipe TRACING_CLASS_PIPE
+#define sys_port_trace_class_k_heap TRACING_CLASS_HEAP
+#define sys_port_trace_class_k_heap_sys TRACING_CLASS_HEAP
+#define sys_port_trace_class_k_mem_slab TRACING_CLASS_MEM_SLAB
+#define sys_port_trace_class_k_timer TRACING_CLASS_TIMER
+#define sys_port_trace_class_k_event TRACING_CLASS_EVENT
+#define sys_port_trace_class_k_poll_api TRACING_CLASS_POLL
+#define sys_port_trace_class_pm TRACING_CLASS_PM
+
+/*
+ * A disabled class costs a load and a bit test. The thread and object
+ * sets are only looked at when not empty.
+ */
+#define Z_TRACING_FILTER(type, obj) \
+	(((z_tracing_filter.classes & BIT(sys_port_trace_class_ ## type)) != 0U) && \
+	 (!z_tracing_filter.narrowed || z_tracing_filter_match(obj)))
+
+/** @endcond */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_TRACING_TRACING_FILTER_H_ */
@@ -56,6 +56,20 @@
 #define _SYS_PORT_TRACING_OBJ_FUNC_EXIT(name, func) \
 	sys_port_trace_ ## name ## _ ## func ## _exit
 
+/*
+ * Runtime filtering of the tracing calls, tracking calls are never
+ * filtered so that the object lists stay complete.
+ */
+#if defined(CONFIG_TRACING_RUNTIME_FILTER)
+#include <zephyr/tracing/tracing_filter.h>
+#define _SYS_PORT_TRACING_FILTERED(type, obj, trace_call) \
+	if (Z_TRACING_FILTER(type, obj)) { \
+		trace_call; \
+	}
+#else
+#define _SYS_PORT_TRACING_FILTERED(type, obj, trace_call) trace_call
+#endif
+
 /*
  * Helper macros for the object tracking system
  */
@@ -198,7 +212,8 @@
  */
 #define SYS_PORT_TRACING_FUNC(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTERED(type, NULL, \
+			_SYS_PORT_TRACING_FUNC(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -215,7 +230,8 @@
  */
 #define SYS_PORT_TRACING_FUNC_ENTER(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC_ENTER(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTERED(type, NULL, \
+			_SYS_PORT_TRACING_FUNC_ENTER(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -231,7 +247,8 @@
  */
 #define SYS_PORT_TRACING_FUNC_BLOCKING(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC_BLOCKING(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTERED(type, NULL, \
+			_SYS_PORT_TRACING_FUNC_BLOCKING(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -248,7 +265,8 @@
  */
 #define SYS_PORT_TRACING_FUNC_EXIT(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC_EXIT(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTERED(type, NULL, \
+			_SYS_PORT_TRACING_FUNC_EXIT(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -262,7 +280,8 @@
 #define SYS_PORT_TRACING_OBJ_INIT(obj_type, obj, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_INIT(obj_type)(obj, ##__VA_ARGS__)); \
+			_SYS_PORT_TRACING_FILTERED(obj_type, obj, \
+				_SYS_PORT_TRACING_OBJ_INIT(obj_type)(obj, ##__VA_ARGS__))); \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
 			_SYS_PORT_TRACKING_OBJ_INIT(obj_type)(obj, ##__VA_ARGS__)); \
 	} while (false)
@@ -280,7 +299,8 @@
 #define SYS_PORT_TRACING_OBJ_FUNC(obj_type, func, obj, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC(obj_type, func)(obj, ##__VA_ARGS__)); \
+			_SYS_PORT_TRACING_FILTERED(obj_type, obj, \
+				_SYS_PORT_TRACING_OBJ_FUNC(obj_type, func)(obj, ##__VA_ARGS__))); \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
 			_SYS_PORT_TRACKING_OBJ_FUNC(obj_type, func)(obj, ##__VA_ARGS__)); \
 	} while (false)
@@ -299,7 +319,8 @@
 #define SYS_PORT_TRACING_OBJ_FUNC_ENTER(obj_type, func, obj, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC_ENTER(obj_type, func)(obj, ##__VA_ARGS__)); \
+			_SYS_PORT_TRACING_FILTERED(obj_type, obj, \
+				_SYS_PORT_TRACING_OBJ_FUNC_ENTER(obj_type, func)(obj, ##__VA_ARGS__))); \
 	} while (false)
 
 /**
@@ -316,8 +337,9 @@
 #define SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(obj_type, func, obj, timeout, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(obj_type, func) \
-			(obj, timeout, ##__VA_ARGS__)); \
+			_SYS_PORT_TRACING_FILTERED(obj_type, obj, \
+				_SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(obj_type, func) \
+				(obj, timeout, ##__VA_ARGS__))); \
 	} while (false)
 
 /**
@@ -334,7 +356,8 @@
 #define SYS_PORT_TRACING_OBJ_FUNC_EXIT(obj_type, func, obj, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC_EXIT(obj_type, func)(obj, ##__VA_ARGS__)); \
+			_SYS_PORT_TRACING_FILTERED(obj_type, obj, \
+				_SYS_PORT_TRACING_OBJ_FUNC_EXIT(obj_type, func)(obj, ##__VA_ARGS__))); \
 	} while (false)
 
 /**
@@ -82,6 +82,8 @@ extern struct k_queue *_track_list_k_queue;
 	sys_track_k_sem_init(sem)
 #define sys_port_track_k_msgq_purge(msgq)
 #define sys_port_track_k_msgq_peek(msgq, ret)
+#define sys_port_track_k_msgq_commit(msgq, ret)
+#define sys_port_track_k_msgq_release(msgq, ret)
 #define sys_port_track_k_msgq_init(msgq) \
 	sys_track_k_msgq_init(msgq)
 #define sys_port_track_k_mbox_init(mbox) \
@@ -131,6 +133,8 @@ void sys_track_k_queue_init(struct k_queue *queue);
 #define sys_port_track_k_sem_init(sem, ret)
 #define sys_port_track_k_msgq_purge(msgq)
 #define sys_port_track_k_msgq_peek(msgq, ret)
+#define sys_port_track_k_msgq_commit(msgq, ret)
+#define sys_port_track_k_msgq_release(msgq, ret)
 #define sys_port_track_k_msgq_init(msgq)
 #define sys_port_track_k_mbox_init(mbox)
 #define sys_port_track_k_mem_slab_init(slab, rc)
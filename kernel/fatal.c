@@ -14,6 +14,7 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/fatal.h>
 #include <zephyr/debug/coredump.h>
+#include <zephyr/tracing/flight_recorder.h>
 
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
@@ -101,6 +102,18 @@ void z_fatal_error(unsigned int reason, const z_arch_esf_t *esf)
 	struct k_thread *thread = IS_ENABLED(CONFIG_MULTITHREADING) ?
 			k_current_get() : NULL;
 
+	/* Keep the trace of what led here, before the handling below adds
+	 * events of its own.
+	 */
+	tracing_flight_recorder_freeze();
+
+#ifdef CONFIG_PRINTK_DEFERRED
+	/* Messages printed before the error, and the error report below,
+	 * must not wait for a thread that might never run again.
+	 */
+	z_printk_panic();
+#endif
+
 	/* twister looks for the "ZEPHYR FATAL ERROR" string, don't
 	 * change it without also updating twister
 	 */
@@ -175,6 +175,17 @@ void z_mem_domain_init_thread(struct k_thread *thread);
 /* Memory domain teardown hook, called from z_thread_abort() */
 void z_mem_domain_exit_thread(struct k_thread *thread);
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/* Lock and unlock a sys_mutex, with value @a val and lock count
+ * @a lock_count, through the k_mutex backing it, when the atomic fast path
+ * could not be taken
+ */
+int z_mutex_lock_contended(struct k_mutex *mutex, atomic_t *val,
+			   uint32_t *lock_count, k_timeout_t timeout);
+int z_mutex_unlock_contended(struct k_mutex *mutex, atomic_t *val,
+			     uint32_t *lock_count);
+#endif
+
 /* This spinlock:
  *
  * - Protects the full set of active k_mem_domain objects and their contents
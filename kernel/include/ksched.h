@@ -64,6 +64,7 @@ void z_ready_thread(struct k_thread *thread);
 void z_requeue_current(struct k_thread *curr);
 struct k_thread *z_swap_next_thread(void);
 void z_thread_abort(struct k_thread *thread);
+bool z_thread_active_elsewhere(struct k_thread *thread);
 
 static inline void z_pend_curr_unlocked(_wait_q_t *wait_q, k_timeout_t timeout)
 {
@@ -385,6 +386,11 @@ void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+/** @brief Timestamp a thread made ready, for the latency histograms */
+void z_sched_usage_ready(struct k_thread *thread);
+#endif
+
 /**
  * @brief Retrieves CPU cycle usage data for specified core
  */
@@ -396,6 +402,19 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Account the budget of the current thread, switched out for
+ * @p new_thread, and start accounting that of @p new_thread.
+ *
+ * Called with the scheduler lock held, or local interrupts masked on
+ * uniprocessor systems, before @p new_thread becomes current.
+ */
+void z_sched_cbs_switch(struct k_thread *new_thread);
+#else
+#define z_sched_cbs_switch(new_thread) do { } while (false)
+#endif
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
@@ -107,6 +107,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 	if (new_thread != old_thread) {
 		z_sched_usage_switch(new_thread);
+		z_sched_cbs_switch(new_thread);
 
 #ifdef CONFIG_SMP
 		_current_cpu->swap_ok = 0;
@@ -219,6 +220,11 @@ static inline void z_dummy_thread_init(struct k_thread *dummy_thread)
 	dummy_thread->base.cpu_mask = -1;
 #endif
 	dummy_thread->base.user_options = K_ESSENTIAL;
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	/* Never charged, as it has no budget and is not running one */
+	dummy_thread->base.cbs.runtime = 0U;
+	dummy_thread->base.cbs.running = false;
+#endif
 #ifdef CONFIG_THREAD_STACK_INFO
 	dummy_thread->stack_info.start = 0U;
 	dummy_thread->stack_info.size = 0U;
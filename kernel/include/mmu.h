@@ -90,6 +90,12 @@
  */
 #define Z_PAGE_FRAME_BACKED		BIT(4)
 
+/**
+ * This page frame was paged in ahead of a page fault, and its data page
+ * has not been seen accessed yet
+ */
+#define Z_PAGE_FRAME_FAULT_AHEAD	BIT(5)
+
 /**
  * Data structure for physical page frames
  *
@@ -263,6 +269,20 @@ unsigned long z_num_pagefaults_get(void);
  */
 int z_page_frame_evict(uintptr_t phys);
 
+/**
+ * Clear the accessed state of the data page in a page frame
+ *
+ * Eviction algorithms use this rather than arch_page_info_get() to clear
+ * the accessed state, so that the kernel accounts the pages paged in
+ * ahead of page faults which were accessed.
+ *
+ * Must be called with interrupts locked.
+ *
+ * @param pf Evictable page frame
+ * @return ARCH_DATA_PAGE_* bits of the data page before clearing
+ */
+uintptr_t z_page_frame_accessed_clear(struct z_page_frame *pf);
+
 /**
  * Handle a page fault for a virtual data page
  *
@@ -14,6 +14,7 @@
 #include <ksched.h>
 #include <zephyr/init.h>
 #include <zephyr/sys/check.h>
+#include <string.h>
 
 /**
  * @brief Initialize kernel memory slab subsystem.
@@ -88,6 +89,11 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->max_used = 0U;
 #endif
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	(void)memset(slab->cache, 0, sizeof(slab->cache));
+	slab->num_waiting = 0U;
+#endif
+
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -101,23 +107,221 @@ out:
 	return rc;
 }
 
-int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+static inline void trace_max_used(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	uint32_t used = k_mem_slab_num_used_get(slab);
+
+	if (used > slab->max_used) {
+		slab->max_used = used;
+	}
+#else
+	ARG_UNUSED(slab);
+#endif
+}
+
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+#define CACHE_BATCH (CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE / 2)
+
+/* Locking order: slab->lock, then a cache lock */
+
+static inline struct k_mem_slab_cache *local_cache(struct k_mem_slab *slab)
+{
+	/* Being migrated right after reading the CPU id only costs some
+	 * locality, each cache has its own lock.
+	 */
+	return &slab->cache[arch_curr_cpu()->id];
+}
+
+/* Moves at most max blocks from one free list to another */
+static uint32_t move_blocks(char **to, char **from, uint32_t max)
+{
+	uint32_t n = 0U;
+	char *block;
+
+	while (n < max && *from != NULL) {
+		block = *from;
+		*from = *(char **)block;
+		*(char **)block = *to;
+		*to = block;
+		n++;
+	}
+
+	return n;
+}
+
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	struct k_mem_slab_cache *cache = local_cache(slab);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	bool found = (cache->free_list != NULL);
+
+	if (found) {
+		*mem = cache->free_list;
+		cache->free_list = *(char **)(cache->free_list);
+		cache->num_free--;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return found;
+}
+
+/* Called with slab->lock held after taking a block from the slab */
+static void cache_refill(struct k_mem_slab *slab)
+{
+	struct k_mem_slab_cache *cache = local_cache(slab);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	uint32_t n = 0U;
+
+	if (cache->num_free < CACHE_BATCH) {
+		n = move_blocks(&cache->free_list, &slab->free_list,
+				CACHE_BATCH - cache->num_free);
+		cache->num_free += n;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	slab->num_used += n;
+}
+
+/* Called with slab->lock held, once the slab has no free block left:
+ * gives it back the blocks cached by all CPUs.
+ */
+static void cache_reclaim(struct k_mem_slab *slab)
+{
+	struct k_mem_slab_cache *cache;
+	k_spinlock_key_t key;
+	uint32_t n;
+
+	for (unsigned int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		cache = &slab->cache[i];
+		key = k_spin_lock(&cache->lock);
+		n = move_blocks(&slab->free_list, &cache->free_list,
+				cache->num_free);
+		cache->num_free = 0U;
+		k_spin_unlock(&cache->lock, key);
+
+		slab->num_used -= n;
+	}
+}
+
+/* Returns the blocks of a full cache to the slab, or to the threads
+ * waiting for a block.
+ */
+static void cache_flush(struct k_mem_slab *slab, char *blocks, uint32_t n)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	struct k_thread *pending_thread;
+	bool resched = false;
+	char *block;
+
+	slab->num_used -= n;
+
+	while (blocks != NULL) {
+		block = blocks;
+		blocks = *(char **)block;
+
+		pending_thread = z_unpend_first_thread(&slab->wait_q);
+		if (pending_thread != NULL) {
+			z_thread_return_value_set_with_data(pending_thread, 0,
+							    block);
+			z_ready_thread(pending_thread);
+			slab->num_used++;
+			resched = true;
+		} else {
+			*(char **)block = slab->free_list;
+			slab->free_list = block;
+		}
+	}
+
+	if (resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+static bool cache_free(struct k_mem_slab *slab, char *block)
+{
+	struct k_mem_slab_cache *cache = local_cache(slab);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	char *flushed = NULL;
+	uint32_t n = 0U;
+
+	/* Waiting threads are given blocks by the slab, they must not be
+	 * left waiting while blocks sit in a cache.
+	 */
+	if (slab->num_waiting != 0U) {
+		k_spin_unlock(&cache->lock, key);
+		return false;
+	}
+
+	*(char **)block = cache->free_list;
+	cache->free_list = block;
+	cache->num_free++;
+
+	if (cache->num_free > CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE) {
+		n = move_blocks(&flushed, &cache->free_list, CACHE_BATCH);
+		cache->num_free -= n;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	if (flushed != NULL) {
+		cache_flush(slab, flushed, n);
+	}
+
+	return true;
+}
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
 	int result;
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	bool reclaimed = false;
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	if (cache_alloc(slab, mem)) {
+		trace_max_used(slab);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+#endif
+
+	key = k_spin_lock(&slab->lock);
+
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	/* Announced before reclaiming the cached blocks, so that blocks
+	 * freed from now on are not cached anymore, until this thread gets
+	 * a block or stops waiting for one.
+	 */
+	if (slab->free_list == NULL) {
+		slab->num_waiting++;
+		cache_reclaim(slab);
+		reclaimed = true;
+	}
+#endif
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
 		slab->free_list = *(char **)(slab->free_list);
 		slab->num_used++;
 
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->max_used = MAX(slab->num_used, slab->max_used);
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+		cache_refill(slab);
 #endif
 
+		trace_max_used(slab);
+
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
 		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
@@ -133,11 +337,23 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+		key = k_spin_lock(&slab->lock);
+		slab->num_waiting--;
+		k_spin_unlock(&slab->lock, key);
+#endif
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
 	}
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	if (reclaimed) {
+		slab->num_waiting--;
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 	k_spin_unlock(&slab->lock, key);
@@ -147,9 +363,19 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	if (cache_free(slab, *mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+#endif
+
+	key = k_spin_lock(&slab->lock);
+
 	if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
 		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
 
@@ -939,6 +939,7 @@ struct k_mem_paging_stats_t paging_stats;
 extern struct k_mem_paging_histogram_t z_paging_histogram_eviction;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_in;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_out;
+extern struct k_mem_paging_histogram_t z_paging_histogram_page_fault;
 #endif
 
 static inline void do_backing_store_page_in(uintptr_t location)
@@ -1022,6 +1023,38 @@ static void virt_region_foreach(void *addr, size_t size,
 	}
 }
 
+/* Account a page paged in ahead of a page fault, if it was accessed or is
+ * being evicted.
+ */
+static void fault_ahead_account(struct z_page_frame *pf, uintptr_t flags,
+				bool evicting)
+{
+	if ((pf->flags & Z_PAGE_FRAME_FAULT_AHEAD) == 0U) {
+		return;
+	}
+
+	if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+		pf->flags &= ~Z_PAGE_FRAME_FAULT_AHEAD;
+#ifdef CONFIG_DEMAND_PAGING_STATS
+		paging_stats.fault_ahead.hits++;
+#endif
+	} else if (evicting) {
+		pf->flags &= ~Z_PAGE_FRAME_FAULT_AHEAD;
+#ifdef CONFIG_DEMAND_PAGING_STATS
+		paging_stats.fault_ahead.misses++;
+#endif
+	}
+}
+
+uintptr_t z_page_frame_accessed_clear(struct z_page_frame *pf)
+{
+	uintptr_t flags = arch_page_info_get(pf->addr, NULL, true);
+
+	fault_ahead_account(pf, flags, false);
+
+	return flags;
+}
+
 /*
  * Perform some preparatory steps before paging out. The provided page frame
  * must be evicted to the backing store immediately after this is called
@@ -1062,6 +1095,8 @@ static int page_frame_prepare_locked(struct z_page_frame *pf, bool *dirty_ptr,
 	 */
 	if (z_page_frame_is_mapped(pf)) {
 		dirty = dirty || !z_page_frame_is_backed(pf);
+		fault_ahead_account(pf, arch_page_info_get(pf->addr, NULL, false),
+				    true);
 	}
 
 	if (dirty || page_fault) {
@@ -1312,16 +1347,59 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+static inline void paging_stats_fault_ahead_inc(void)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.fault_ahead.cnt++;
+#endif
+}
+
+static bool do_page_fault(void *addr, bool pin, bool ahead);
+
+/* Page in the data pages following a faulting one, into free page frames,
+ * until one of them is already present.
+ */
+static void do_fault_ahead(void *addr)
+{
+	uint8_t *pos = (uint8_t *)addr;
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_FAULT_AHEAD; i++) {
+		pos += CONFIG_MMU_PAGE_SIZE;
+		if ((uintptr_t)pos >= (uintptr_t)Z_SCRATCH_PAGE ||
+		    !do_page_fault(pos, false, true)) {
+			break;
+		}
+	}
+}
+
+/* With @p ahead, the page at @p addr is paged in only if it was paged out
+ * and a page frame is free, and true is returned if it was.
+ */
+static bool do_page_fault(void *addr, bool pin, bool ahead)
 {
 	struct z_page_frame *pf;
 	int key, ret;
 	uintptr_t page_in_location, page_out_location;
 	enum arch_page_location status;
 	bool result;
+	bool paged_in = false;
 	bool dirty = false;
 	struct k_thread *faulting_thread = _current_cpu->current;
 
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+	uint32_t time_diff;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	timing_t time_start, time_end;
+
+	time_start = timing_counter_get();
+#else
+	uint32_t time_start;
+
+	time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
 		 addr);
 
@@ -1365,6 +1443,22 @@ static bool do_page_fault(void *addr, bool pin)
 
 	key = irq_lock();
 	status = arch_page_location_get(addr, &page_in_location);
+	if (ahead) {
+		/* Nothing to do unless a free page frame can take it */
+		result = false;
+		if (status != ARCH_PAGE_LOCATION_PAGED_OUT) {
+			goto out;
+		}
+
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			goto out;
+		}
+
+		paging_stats_fault_ahead_inc();
+		goto page_in;
+	}
+
 	if (status == ARCH_PAGE_LOCATION_BAD) {
 		/* Return false to treat as a fatal error */
 		result = false;
@@ -1403,6 +1497,7 @@ static bool do_page_fault(void *addr, bool pin)
 
 		paging_stats_eviction_inc(faulting_thread, dirty);
 	}
+page_in:
 	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
 	__ASSERT(ret == 0, "failed to prepare page frame");
 
@@ -1425,18 +1520,41 @@ static bool do_page_fault(void *addr, bool pin)
 	if (pin) {
 		pf->flags |= Z_PAGE_FRAME_PINNED;
 	}
+	if (ahead) {
+		pf->flags |= Z_PAGE_FRAME_FAULT_AHEAD;
+	}
 	pf->flags |= Z_PAGE_FRAME_MAPPED;
 	pf->addr = UINT_TO_POINTER(POINTER_TO_UINT(addr)
 				   & ~(CONFIG_MMU_PAGE_SIZE - 1));
 
 	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
 	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+	paged_in = true;
+	result = true;
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	k_sched_unlock();
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
 
+	if (paged_in && !ahead) {
+		if (!pin) {
+			do_fault_ahead(addr);
+		}
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+		time_end = timing_counter_get();
+		time_diff = (uint32_t)timing_cycles_get(&time_start, &time_end);
+#else
+		time_diff = k_cycle_get_32() - time_start;
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+
+		z_paging_histogram_inc(&z_paging_histogram_page_fault,
+				       time_diff);
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+	}
+
 	return result;
 }
 
@@ -1444,7 +1562,7 @@ static void do_page_in(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, false);
+	ret = do_page_fault(addr, false, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1461,7 +1579,7 @@ static void do_mem_pin(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, true);
+	ret = do_page_fault(addr, true, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1476,7 +1594,7 @@ void k_mem_pin(void *addr, size_t size)
 
 bool z_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	return do_page_fault(addr, false, false);
 }
 
 static void do_mem_unpin(void *addr)
@@ -42,6 +42,8 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->read_ptr = buffer;
 	msgq->write_ptr = buffer;
 	msgq->used_msgs = 0;
+	msgq->reserved_msgs = 0;
+	msgq->peeked_msgs = 0;
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
@@ -113,44 +115,176 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 }
 
 
-int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
+/* Advance a ring pointer by a number of messages that doesn't cross
+ * the end of the buffer.
+ */
+static inline char *msgq_advance(struct k_msgq *msgq, char *ptr, uint32_t count)
 {
-	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+	ptr += count * msgq->msg_size;
+	if (ptr == msgq->buffer_end) {
+		ptr = msgq->buffer_start;
+	}
 
-	struct k_thread *pending_thread;
-	k_spinlock_key_t key;
-	int result;
+	return ptr;
+}
 
-	key = k_spin_lock(&msgq->lock);
+/* Number of free slots following the write pointer without wrapping. */
+static inline uint32_t msgq_contig_free(struct k_msgq *msgq)
+{
+	uint32_t to_end = (msgq->buffer_end - msgq->write_ptr) / msgq->msg_size;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+	return MIN(to_end, msgq->max_msgs - msgq->used_msgs);
+}
+
+/* Number of messages following the read pointer without wrapping. */
+static inline uint32_t msgq_contig_used(struct k_msgq *msgq)
+{
+	uint32_t to_end = (msgq->buffer_end - msgq->read_ptr) / msgq->msg_size;
+
+	return MIN(to_end, msgq->used_msgs);
+}
+
+/* Wake a thread pending on the queue with a successful return. */
+static inline void msgq_wake(struct k_thread *thread)
+{
+	arch_thread_return_value_set(thread, 0);
+	z_ready_thread(thread);
+}
+
+/* Put messages in the queue, without waiting.
+ *
+ * Messages are given directly to threads waiting for data, the others are
+ * copied to the ring buffer.  A thread waiting with a NULL buffer (see
+ * k_msgq_peek_slots()) is only woken, it finds the data in the ring.
+ *
+ * Invoked with the queue lock held.
+ *
+ * @return number of messages put, threads were made ready if @p woken is
+ * set to true.
+ */
+static uint32_t msgq_put_locked(struct k_msgq *msgq, const char *data,
+				uint32_t count, bool *woken)
+{
+	struct k_thread *pending_thread;
+	uint32_t chunk, n = 0;
 
-	if (msgq->used_msgs < msgq->max_msgs) {
-		/* message queue isn't full */
+	/* Threads only wait for data when the queue is empty */
+	while ((n < count) && (msgq->used_msgs == 0U)) {
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (pending_thread != NULL) {
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, 0);
+		if (pending_thread == NULL) {
+			break;
+		}
 
+		if (pending_thread->base.swap_data != NULL) {
 			/* give message to waiting thread */
-			(void)memcpy(pending_thread->base.swap_data, data,
-			       msgq->msg_size);
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
-			z_reschedule(&msgq->lock, key);
-			return 0;
-		} else {
-			/* put message in queue */
-			(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
+			(void)memcpy(pending_thread->base.swap_data,
+				     data + n * msgq->msg_size, msgq->msg_size);
+			n++;
+		}
+
+		msgq_wake(pending_thread);
+		*woken = true;
+	}
+
+	while (n < count) {
+		chunk = MIN(count - n, msgq_contig_free(msgq));
+		if (chunk == 0U) {
+			break;
+		}
+
+		/* put messages in queue */
+		(void)memcpy(msgq->write_ptr, data + n * msgq->msg_size,
+			     chunk * msgq->msg_size);
+		msgq->write_ptr = msgq_advance(msgq, msgq->write_ptr, chunk);
+		msgq->used_msgs += chunk;
+		n += chunk;
 #ifdef CONFIG_POLL
-			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
+	}
+
+	return n;
+}
+
+/* Move the messages of threads waiting for free space into the queue.
+ *
+ * A thread waiting with a NULL message (see k_msgq_reserve()) is only
+ * woken, it reserves the free space itself.
+ *
+ * Invoked with the queue lock held, after messages were removed.
+ */
+static void msgq_wake_writers_locked(struct k_msgq *msgq, bool *woken)
+{
+	struct k_thread *pending_thread;
+
+	while (msgq->used_msgs < msgq->max_msgs) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		if (pending_thread->base.swap_data != NULL) {
+			/* add thread's message to queue */
+			(void)memcpy(msgq->write_ptr,
+				     pending_thread->base.swap_data,
+				     msgq->msg_size);
+			msgq->write_ptr = msgq_advance(msgq, msgq->write_ptr, 1);
+			msgq->used_msgs++;
+		}
+
+		msgq_wake(pending_thread);
+		*woken = true;
+	}
+}
+
+/* Get messages from the queue, without waiting.
+ *
+ * Invoked with the queue lock held.
+ *
+ * @return number of messages received, threads were made ready if @p
+ * woken is set to true.
+ */
+static uint32_t msgq_get_locked(struct k_msgq *msgq, char *data,
+				uint32_t count, bool *woken)
+{
+	uint32_t chunk, n = 0;
+
+	while (n < count) {
+		chunk = MIN(count - n, msgq_contig_used(msgq));
+		if (chunk == 0U) {
+			break;
 		}
+
+		/* take first available messages from queue */
+		(void)memcpy(data + n * msgq->msg_size, msgq->read_ptr,
+			     chunk * msgq->msg_size);
+		msgq->read_ptr = msgq_advance(msgq, msgq->read_ptr, chunk);
+		msgq->used_msgs -= chunk;
+		n += chunk;
+
+		/* handle threads waiting to write (if any) */
+		msgq_wake_writers_locked(msgq, woken);
+	}
+
+	return n;
+}
+
+int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	bool woken = false;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+
+	if (msgq->reserved_msgs != 0U) {
+		/* slots are being written in place */
+		result = -EBUSY;
+	} else if (msgq_put_locked(msgq, data, 1, &woken) == 1U) {
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 		/* don't wait for message space to become available */
@@ -168,7 +302,11 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
 
-	k_spin_unlock(&msgq->lock, key);
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
 
 	return result;
 }
@@ -208,44 +346,20 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	k_spinlock_key_t key;
-	struct k_thread *pending_thread;
+	bool woken = false;
 	int result;
 
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
-	if (msgq->used_msgs > 0U) {
-		/* take first available message from queue */
-		(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
-
-		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (pending_thread != NULL) {
+	if (msgq->peeked_msgs != 0U) {
+		/* slots are being read in place */
+		result = -EBUSY;
+	} else if (msgq_get_locked(msgq, data, 1, &woken) == 1U) {
+		if (woken) {
+			/* a thread waiting to write was handled */
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
-
-			/* add thread's message to queue */
-			(void)memcpy(msgq->write_ptr, pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
-			z_reschedule(&msgq->lock, key);
-
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, 0);
-
-			return 0;
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -264,7 +378,11 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
 
-	k_spin_unlock(&msgq->lock, key);
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
 
 	return result;
 }
@@ -281,6 +399,357 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif
 
+int z_impl_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			   uint32_t count, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	bool woken = false;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_many, msgq, timeout);
+
+	if (count == 0U) {
+		result = 0;
+	} else if (msgq->reserved_msgs != 0U) {
+		result = -EBUSY;
+	} else {
+		result = msgq_put_locked(msgq, data, count, &woken);
+	}
+
+	if (result == 0 && count > 0U) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+		} else {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put_many, msgq,
+							   timeout);
+
+			/* wait until the first message is put */
+			_current->base.swap_data = (void *) data;
+
+			result = z_pend_curr(&msgq->lock, key, &msgq->wait_q,
+					     timeout);
+			result = (result == 0) ? 1 : result;
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq,
+						       timeout, result);
+			return result;
+		}
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout, result);
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_many(struct k_msgq *msgq,
+					 const void *data, uint32_t count,
+					 k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(data, count, msgq->msg_size));
+
+	return z_impl_k_msgq_put_many(msgq, data, count, timeout);
+}
+#include <syscalls/k_msgq_put_many_mrsh.c>
+#endif
+
+int z_impl_k_msgq_get_many(struct k_msgq *msgq, void *data, uint32_t count,
+			   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	bool woken = false;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_many, msgq, timeout);
+
+	if (count == 0U) {
+		result = 0;
+	} else if (msgq->peeked_msgs != 0U) {
+		result = -EBUSY;
+	} else {
+		result = msgq_get_locked(msgq, data, count, &woken);
+	}
+
+	if (result == 0 && count > 0U) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+		} else {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get_many, msgq,
+							   timeout);
+
+			/* wait until the first message is received */
+			_current->base.swap_data = data;
+
+			result = z_pend_curr(&msgq->lock, key, &msgq->wait_q,
+					     timeout);
+			result = (result == 0) ? 1 : result;
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq,
+						       timeout, result);
+			return result;
+		}
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout, result);
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_many(struct k_msgq *msgq, void *data,
+					 uint32_t count, k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(data, count, msgq->msg_size));
+
+	return z_impl_k_msgq_get_many(msgq, data, count, timeout);
+}
+#include <syscalls/k_msgq_get_many_mrsh.c>
+#endif
+
+/* Wait for a change of the queue state, for in place accesses.
+ *
+ * The thread pends with a NULL message so that it is woken without data
+ * being copied, and re-evaluates the queue state.
+ *
+ * Invoked with the queue lock held, returns with the lock held.
+ *
+ * @retval 0 woken, the state must be evaluated again
+ * @retval -ENOMSG not waiting or the queue was purged
+ * @retval -EAGAIN waiting period timed out
+ */
+static int msgq_wait_slots(struct k_msgq *msgq, k_spinlock_key_t *key,
+			   k_timeout_t timeout, uint64_t end)
+{
+	k_timeout_t wait = K_FOREVER;
+	int result;
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -ENOMSG;
+	}
+
+	if (!K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		int64_t left = (int64_t)(end - sys_clock_tick_get());
+
+		if (left <= 0) {
+			return -EAGAIN;
+		}
+
+		wait = K_TICKS(left);
+	}
+
+	_current->base.swap_data = NULL;
+
+	result = z_pend_curr(&msgq->lock, *key, &msgq->wait_q, wait);
+	*key = k_spin_lock(&msgq->lock);
+
+	return result;
+}
+
+int k_msgq_reserve(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+		   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+	__ASSERT_NO_MSG(max_msgs > 0U);
+
+	uint64_t end = sys_clock_timeout_end_calc(timeout);
+	k_spinlock_key_t key;
+	uint32_t count;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, reserve, msgq, timeout);
+
+	do {
+		if (msgq->reserved_msgs != 0U) {
+			result = -EBUSY;
+			break;
+		}
+
+		count = MIN(max_msgs, msgq_contig_free(msgq));
+		if (count > 0U) {
+			*slots = msgq->write_ptr;
+			msgq->reserved_msgs = count;
+			result = count;
+			break;
+		}
+
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, reserve, msgq,
+							   timeout);
+		}
+
+		result = msgq_wait_slots(msgq, &key, timeout, end);
+	} while (result == 0);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, reserve, msgq, timeout, result);
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_commit(struct k_msgq *msgq, uint32_t count)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	bool woken = false;
+	bool was_empty;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (count > msgq->reserved_msgs) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, commit, msgq, -EINVAL);
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, commit, msgq, 0);
+
+	msgq->reserved_msgs = 0U;
+
+	if (count == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return 0;
+	}
+
+	was_empty = (msgq->used_msgs == 0U);
+	msgq->write_ptr = msgq_advance(msgq, msgq->write_ptr, count);
+	msgq->used_msgs += count;
+
+	/* Threads only wait for data when the queue is empty, give them
+	 * the first committed messages.
+	 */
+	while (was_empty && (msgq->used_msgs > 0U)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		if (pending_thread->base.swap_data != NULL) {
+			(void)memcpy(pending_thread->base.swap_data,
+				     msgq->read_ptr, msgq->msg_size);
+			msgq->read_ptr = msgq_advance(msgq, msgq->read_ptr, 1);
+			msgq->used_msgs--;
+		}
+
+		msgq_wake(pending_thread);
+		woken = true;
+	}
+
+#ifdef CONFIG_POLL
+	if (msgq->used_msgs > 0U) {
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	}
+#endif /* CONFIG_POLL */
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+int k_msgq_peek_slots(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+		      k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+	__ASSERT_NO_MSG(max_msgs > 0U);
+
+	uint64_t end = sys_clock_timeout_end_calc(timeout);
+	k_spinlock_key_t key;
+	uint32_t count;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, peek_slots, msgq, timeout);
+
+	do {
+		if (msgq->peeked_msgs != 0U) {
+			result = -EBUSY;
+			break;
+		}
+
+		count = MIN(max_msgs, msgq_contig_used(msgq));
+		if (count > 0U) {
+			*slots = msgq->read_ptr;
+			msgq->peeked_msgs = count;
+			result = count;
+			break;
+		}
+
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, peek_slots, msgq,
+							   timeout);
+		}
+
+		result = msgq_wait_slots(msgq, &key, timeout, end);
+	} while (result == 0);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, peek_slots, msgq, timeout, result);
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_release(struct k_msgq *msgq, uint32_t count)
+{
+	k_spinlock_key_t key;
+	bool woken = false;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (count > msgq->peeked_msgs) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, release, msgq, -EINVAL);
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, release, msgq, 0);
+
+	msgq->peeked_msgs = 0U;
+
+	if (count > 0U) {
+		msgq->read_ptr = msgq_advance(msgq, msgq->read_ptr, count);
+		msgq->used_msgs -= count;
+
+		/* handle threads waiting to write (if any) */
+		msgq_wake_writers_locked(msgq, &woken);
+	}
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -330,7 +799,11 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 		z_ready_thread(pending_thread);
 	}
 
+	/* Messages read in place are discarded as well, a reservation is
+	 * kept as it starts at the write pointer.
+	 */
 	msgq->used_msgs = 0;
+	msgq->peeked_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
 	z_reschedule(&msgq->lock, key);
@@ -30,13 +30,16 @@
 #include <zephyr/kernel_structs.h>
 #include <zephyr/toolchain.h>
 #include <ksched.h>
+#include <kernel_internal.h>
 #include <zephyr/wait_q.h>
 #include <errno.h>
+#include <string.h>
 #include <zephyr/init.h>
 #include <zephyr/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/mutex.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 /* We use a global spinlock here because some of the synchronization
@@ -92,6 +95,76 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+#ifdef CONFIG_MUTEX_SPIN_STATS
+static struct k_mutex_spin_stats spin_stats;
+
+void k_mutex_spin_stats_get(struct k_mutex_spin_stats *stats, bool reset)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats = spin_stats;
+	if (reset) {
+		(void)memset(&spin_stats, 0, sizeof(spin_stats));
+	}
+
+	k_spin_unlock(&lock, key);
+}
+#endif
+
+static bool owner_active_elsewhere(struct k_thread *owner)
+{
+	unsigned int key = arch_irq_lock();
+	bool active = z_thread_active_elsewhere(owner);
+
+	arch_irq_unlock(key);
+
+	return active;
+}
+
+/* Called with the lock held, on a mutex owned by another thread. While
+ * nobody waits for the mutex and its owner runs on another CPU, releases
+ * the lock and spins for a bounded time hoping the owner unlocks it soon,
+ * which is cheaper than pending and being switched back in. Returns true,
+ * with the lock held again, if the mutex was found unlocked.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	volatile struct k_mutex *vmutex = mutex;
+	struct k_thread *owner = mutex->owner;
+	uint32_t start, elapsed = 0U;
+	bool acquired;
+
+	if (z_waitq_head(&mutex->wait_q) != NULL ||
+	    !z_thread_active_elsewhere(owner)) {
+		return false;
+	}
+
+	start = k_cycle_get_32();
+	k_spin_unlock(&lock, *key);
+
+	/* Stop as soon as the mutex is unlocked, changes hands or its owner
+	 * is switched out: it is not worth waiting for then.
+	 */
+	while (vmutex->lock_count != 0U && vmutex->owner == owner &&
+	       elapsed < CONFIG_MUTEX_SPIN_CYCLES &&
+	       owner_active_elsewhere(owner)) {
+		elapsed = k_cycle_get_32() - start;
+	}
+
+	*key = k_spin_lock(&lock);
+	acquired = (mutex->lock_count == 0U);
+
+#ifdef CONFIG_MUTEX_SPIN_STATS
+	spin_stats.spins++;
+	spin_stats.acquired += acquired ? 1U : 0U;
+	spin_stats.cycles += k_cycle_get_32() - start;
+#endif
+
+	return acquired;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -132,6 +205,23 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if (mutex_spin(mutex, &key)) {
+		mutex->owner_orig_prio = _current->base.prio;
+		mutex->lock_count = 1U;
+		mutex->owner = _current;
+
+		LOG_DBG("%p took mutex %p spinning, orig prio: %d",
+			_current, mutex, mutex->owner_orig_prio);
+
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
@@ -275,3 +365,253 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 }
 #include <syscalls/k_mutex_unlock_mrsh.c>
 #endif
+
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/*
+ * A sys_mutex locked in user mode has no kernel state until another
+ * thread has to wait for it. That thread tags the owner in the mutex
+ * value and makes the backing k_mutex held by the owner, so that it
+ * inherits the priority of the waiters and releases the mutex through
+ * the kernel. A tagged value is only modified under the lock.
+ *
+ * The value lives in user memory and may have been forged: the owner of
+ * the k_mutex prevails over it, and an owner read from the value is only
+ * trusted once checked against the kernel objects.
+ */
+
+/* Whether a thread can access the memory of a sys_mutex */
+static bool thread_has_access(struct k_thread *thread, atomic_t *val)
+{
+	struct k_mem_domain *domain;
+	uintptr_t addr = (uintptr_t)val;
+	bool ret = false;
+	k_spinlock_key_t key;
+
+	if ((thread->base.user_options & K_USER) == 0U) {
+		return true;
+	}
+
+	key = k_spin_lock(&z_mem_domain_lock);
+
+	domain = thread->mem_domain_info.mem_domain;
+	for (int i = 0; i < CONFIG_MAX_DOMAIN_PARTITIONS; i++) {
+		struct k_mem_partition *part = &domain->partitions[i];
+
+		if (part->size != 0U && addr >= part->start &&
+		    addr + sizeof(atomic_t) <= part->start + part->size) {
+			ret = true;
+			break;
+		}
+	}
+
+	k_spin_unlock(&z_mem_domain_lock, key);
+
+	return ret;
+}
+
+static struct k_thread *sys_mutex_owner_get(atomic_t *val, atomic_val_t old)
+{
+	struct k_thread *thread =
+		(struct k_thread *)(old & ~Z_SYS_MUTEX_CONTENDED);
+	struct z_object *obj = z_object_find(thread);
+
+	/* Only a live thread which can use the mutex may have locked it, any
+	 * other thread must not inherit the priority of the waiters
+	 */
+	if (obj == NULL || obj->type != K_OBJ_THREAD ||
+	    (obj->flags & K_OBJ_FLAG_INITIALIZED) == 0U ||
+	    z_is_thread_state_set(thread, _THREAD_DEAD) ||
+	    !thread_has_access(thread, val)) {
+		return NULL;
+	}
+
+	return thread;
+}
+
+int z_mutex_lock_contended(struct k_mutex *mutex, atomic_t *val,
+			   uint32_t *lock_count, k_timeout_t timeout)
+{
+	atomic_val_t self = (atomic_val_t)_current;
+	struct k_thread *owner, *waiter;
+	k_spinlock_key_t key;
+	atomic_val_t old;
+	bool resched = false;
+	int new_prio, ret;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	while (true) {
+		if (mutex->owner != NULL) {
+			if (mutex->owner == _current) {
+				(*lock_count)++;
+				ret = 0;
+				goto out;
+			}
+			break;
+		}
+
+		old = atomic_get(val);
+
+		if (old == 0) {
+			/* Released meanwhile, retry the fast path */
+			if (atomic_cas(val, 0, self)) {
+				*lock_count = 1U;
+				ret = 0;
+				goto out;
+			}
+			continue;
+		}
+
+		if ((old & ~Z_SYS_MUTEX_CONTENDED) == self) {
+			(*lock_count)++;
+			ret = 0;
+			goto out;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			ret = -EBUSY;
+			goto out;
+		}
+
+		/* Only the kernel tags the value, along with setting the
+		 * owner of the k_mutex
+		 */
+		owner = ((old & Z_SYS_MUTEX_CONTENDED) == 0) ?
+			sys_mutex_owner_get(val, old) : NULL;
+		if (owner == NULL) {
+			ret = -EINVAL;
+			goto out;
+		}
+
+		if (atomic_cas(val, old, old | Z_SYS_MUTEX_CONTENDED)) {
+			mutex->owner = owner;
+			mutex->lock_count = 1U;
+			mutex->owner_orig_prio = owner->base.prio;
+			break;
+		}
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = -EBUSY;
+		goto out;
+	}
+
+	new_prio = new_prio_for_inheritance(_current->base.prio,
+					    mutex->owner->base.prio);
+	if (z_is_prio_higher(new_prio, mutex->owner->base.prio)) {
+		resched = adjust_owner_prio(mutex, new_prio);
+	}
+
+	/* The unlocking thread sets the value for us when handing over */
+	if (z_pend_curr(&lock, key, &mutex->wait_q, timeout) == 0) {
+		*lock_count = 1U;
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (mutex->owner != NULL) {
+		waiter = z_waitq_head(&mutex->wait_q);
+		new_prio = (waiter != NULL) ?
+			new_prio_for_inheritance(waiter->base.prio,
+						 mutex->owner_orig_prio) :
+			mutex->owner_orig_prio;
+		resched = adjust_owner_prio(mutex, new_prio) || resched;
+
+		if (waiter == NULL) {
+			/* No waiter left, the owner may release the mutex
+			 * in user mode again
+			 */
+			mutex->owner = NULL;
+			mutex->lock_count = 0U;
+			(void)atomic_and(val, ~Z_SYS_MUTEX_CONTENDED);
+		}
+	}
+
+	ret = -EAGAIN;
+
+out:
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return ret;
+}
+
+int z_mutex_unlock_contended(struct k_mutex *mutex, atomic_t *val,
+			     uint32_t *lock_count)
+{
+	atomic_val_t self = (atomic_val_t)_current;
+	struct k_thread *new_owner;
+	k_spinlock_key_t key;
+	atomic_val_t old;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	if (mutex->owner == NULL) {
+		/* Nobody waits, untagged values only change in user mode
+		 * by the owner, when unlocked
+		 */
+		old = atomic_get(val);
+		if ((old & ~Z_SYS_MUTEX_CONTENDED) != self) {
+			k_spin_unlock(&lock, key);
+			return (old == 0) ? -EINVAL : -EPERM;
+		}
+
+		if (*lock_count > 1U) {
+			(*lock_count)--;
+		} else {
+			*lock_count = 0U;
+			atomic_set(val, 0);
+		}
+
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	if (mutex->owner != _current) {
+		k_spin_unlock(&lock, key);
+		return -EPERM;
+	}
+
+	if (*lock_count > 1U) {
+		(*lock_count)--;
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	*lock_count = 0U;
+	adjust_owner_prio(mutex, mutex->owner_orig_prio);
+
+	new_owner = z_unpend_first_thread(&mutex->wait_q);
+	if (new_owner == NULL) {
+		mutex->owner = NULL;
+		mutex->lock_count = 0U;
+		atomic_set(val, 0);
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	if (z_waitq_head(&mutex->wait_q) != NULL) {
+		mutex->owner = new_owner;
+		mutex->owner_orig_prio = new_owner->base.prio;
+		atomic_set(val, (atomic_val_t)new_owner | Z_SYS_MUTEX_CONTENDED);
+	} else {
+		mutex->owner = NULL;
+		mutex->lock_count = 0U;
+		atomic_set(val, (atomic_val_t)new_owner);
+	}
+
+	arch_thread_return_value_set(new_owner, 0);
+	z_ready_thread(new_owner);
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
@@ -584,7 +584,7 @@ static void update_cache(int preempt_ok)
 #endif
 }
 
-static bool thread_active_elsewhere(struct k_thread *thread)
+bool z_thread_active_elsewhere(struct k_thread *thread)
 {
 	/* True if the thread is currently running on another CPU.
 	 * There are more scalable designs to answer this question in
@@ -612,6 +612,29 @@ static void flag_ipi(void)
 #endif
 }
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/* Constant bandwidth server wake up rule: a thread whose budget left
+ * would let it run at more than its bandwidth until its deadline gets
+ * a new budget and deadline.
+ */
+static void cbs_wakeup(struct k_thread *thread)
+{
+	uint32_t now = k_cycle_get_32();
+	int32_t left = (int32_t)(thread->base.prio_deadline - now);
+
+	if (thread->base.cbs.runtime == 0U) {
+		return;
+	}
+
+	if (left <= 0 ||
+	    (uint64_t)thread->base.cbs.budget * thread->base.cbs.period >
+	    (uint64_t)left * thread->base.cbs.runtime) {
+		thread->base.cbs.budget = thread->base.cbs.runtime;
+		thread->base.prio_deadline = now + thread->base.cbs.period;
+	}
+}
+#endif
+
 static void ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
@@ -624,6 +647,12 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+		z_sched_usage_ready(thread);
+#endif
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		cbs_wakeup(thread);
+#endif
 		queue_thread(thread);
 		update_cache(0);
 		flag_ipi();
@@ -633,7 +662,7 @@ static void ready_thread(struct k_thread *thread)
 void z_ready_thread(struct k_thread *thread)
 {
 	LOCKED(&sched_spinlock) {
-		if (!thread_active_elsewhere(thread)) {
+		if (!z_thread_active_elsewhere(thread)) {
 			ready_thread(thread);
 		}
 	}
@@ -1067,6 +1096,7 @@ void *z_get_next_switch_handle(void *interrupted)
 		new_thread = next_up();
 
 		z_sched_usage_switch(new_thread);
+		z_sched_cbs_switch(new_thread);
 
 		if (old_thread != new_thread) {
 			update_metairq_preempt(new_thread);
@@ -1110,6 +1140,7 @@ void *z_get_next_switch_handle(void *interrupted)
 	return ret;
 #else
 	z_sched_usage_switch(_kernel.ready_q.cache);
+	z_sched_cbs_switch(_kernel.ready_q.cache);
 	_current->switch_handle = interrupted;
 	set_current(_kernel.ready_q.cache);
 	return _current->switch_handle;
@@ -1360,7 +1391,172 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 }
 #include <syscalls/k_thread_deadline_set_mrsh.c>
 #endif
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+static void cbs_timeout(struct _timeout *timeout);
+
+/* All cbs_*() helpers are called with sched_spinlock held */
+
+static void cbs_start(struct k_thread *thread, uint32_t now)
+{
+	thread->base.cbs.start = now;
+	thread->base.cbs.running = true;
+	z_add_timeout(&thread->base.cbs.timeout, cbs_timeout,
+		      K_TICKS(k_cyc_to_ticks_ceil32(thread->base.cbs.budget)));
+}
+
+/* Charges the budget with the time run so far, returns true if it is
+ * exhausted.
+ */
+static bool cbs_charge(struct k_thread *thread, uint32_t now)
+{
+	uint32_t used = now - thread->base.cbs.start;
+
+	thread->base.cbs.running = false;
+	(void)z_abort_timeout(&thread->base.cbs.timeout);
+
+	if (used < thread->base.cbs.budget) {
+		thread->base.cbs.budget -= used;
+		return false;
+	}
+
+	return true;
+}
+
+/* Replenishes an exhausted budget, postponing the deadline by a period */
+static void cbs_replenish(struct k_thread *thread)
+{
+	bool queued = z_is_thread_queued(thread);
+
+	if (queued) {
+		dequeue_thread(thread);
+	}
+
+	thread->base.cbs.overruns++;
+	thread->base.cbs.budget = thread->base.cbs.runtime;
+	thread->base.prio_deadline += thread->base.cbs.period;
+
+	if (queued) {
+		queue_thread(thread);
+	}
+}
+
+static void cbs_timeout(struct _timeout *timeout)
+{
+	struct k_thread *thread = CONTAINER_OF(timeout, struct k_thread,
+					       base.cbs.timeout);
+
+	LOCKED(&sched_spinlock) {
+		/* The thread may have been switched out, and charged,
+		 * while this was about to run.
+		 */
+		if (thread->base.cbs.running) {
+			uint32_t now = k_cycle_get_32();
+
+			(void)cbs_charge(thread, now);
+			cbs_replenish(thread);
+
+			/* Keeps running until a thread with an earlier
+			 * deadline preempts it.
+			 */
+			cbs_start(thread, now);
+			update_cache(thread == _current);
+			flag_ipi();
+		}
+	}
+
+	signal_pending_ipi();
+}
+
+void z_sched_cbs_switch(struct k_thread *new_thread)
+{
+	struct k_thread *old_thread = _current;
+	uint32_t now;
+
+	if (old_thread == new_thread) {
+		return;
+	}
+
+	now = k_cycle_get_32();
+
+	if (old_thread->base.cbs.running &&
+	    cbs_charge(old_thread, now)) {
+		cbs_replenish(old_thread);
+	}
+
+	if (new_thread->base.cbs.runtime != 0U) {
+		cbs_start(new_thread, now);
+	}
+}
+
+int z_impl_k_thread_deadline_budget_set(k_tid_t tid, uint32_t runtime,
+					uint32_t period)
+{
+	struct k_thread *thread = tid;
+
+	if ((runtime != 0U && period == 0U) || runtime > period ||
+	    period > (uint32_t)INT32_MAX) {
+		return -EINVAL;
+	}
+
+	LOCKED(&sched_spinlock) {
+		bool queued = z_is_thread_queued(thread);
+
+		if (thread->base.cbs.running) {
+			(void)cbs_charge(thread, k_cycle_get_32());
+		}
+
+		if (queued) {
+			dequeue_thread(thread);
+		}
+
+		thread->base.cbs.runtime = runtime;
+		thread->base.cbs.period = period;
+		thread->base.cbs.budget = runtime;
+		if (runtime != 0U) {
+			thread->base.prio_deadline = k_cycle_get_32() + period;
+		}
+
+		if (queued) {
+			queue_thread(thread);
+		}
+
+		if (thread == _current && runtime != 0U) {
+			cbs_start(thread, k_cycle_get_32());
+		}
+
+		update_cache(thread == _current);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_deadline_budget_set(k_tid_t tid,
+						      uint32_t runtime,
+						      uint32_t period)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(tid, K_OBJ_THREAD));
+	return z_impl_k_thread_deadline_budget_set(tid, runtime, period);
+}
+#include <syscalls/k_thread_deadline_budget_set_mrsh.c>
+#endif
+
+uint32_t z_impl_k_thread_deadline_overruns_get(k_tid_t tid)
+{
+	return tid->base.cbs.overruns;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline uint32_t z_vrfy_k_thread_deadline_overruns_get(k_tid_t tid)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(tid, K_OBJ_THREAD));
+	return z_impl_k_thread_deadline_overruns_get(tid);
+}
+#include <syscalls/k_thread_deadline_overruns_get_mrsh.c>
 #endif
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+#endif /* CONFIG_SCHED_DEADLINE */
 
 bool k_can_yield(void)
 {
@@ -1730,7 +1926,7 @@ void z_thread_abort(struct k_thread *thread)
 		end_thread(thread);
 	}
 
-	bool active = thread_active_elsewhere(thread);
+	bool active = z_thread_active_elsewhere(thread);
 
 	if (active) {
 		/* It's running somewhere else, flag and poke */
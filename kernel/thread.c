@@ -809,6 +809,13 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 	thread_base->slice_expired = NULL;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	thread_base->cbs.runtime = 0U;
+	thread_base->cbs.overruns = 0U;
+	thread_base->cbs.running = false;
+	z_init_timeout(&thread_base->cbs.timeout);
+#endif
+
 	/* swap_data does not need to be initialized */
 
 	z_init_thread_timeout(thread_base);
@@ -1105,8 +1112,32 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+		for (int j = 0; j < CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS; j++) {
+			stats->ready_latency.count[j] +=
+				tmp_stats.ready_latency.count[j];
+			stats->run_length.count[j] +=
+				tmp_stats.run_length.count[j];
+			stats->isr_latency.count[j] +=
+				tmp_stats.isr_latency.count[j];
+		}
+#endif
 	}
 #endif
 
 	return 0;
 }
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+int k_thread_runtime_stats_cpu_get(int cpu, k_thread_runtime_stats_t *stats)
+{
+	if (stats == NULL || cpu < 0 || cpu >= CONFIG_MP_NUM_CPUS) {
+		return -EINVAL;
+	}
+
+	*stats = (k_thread_runtime_stats_t) {};
+	z_sched_cpu_usage(cpu, stats);
+
+	return 0;
+}
+#endif
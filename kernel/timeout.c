@@ -11,6 +11,7 @@
 #include <zephyr/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/debug/profiler.h>
 
 static uint64_t curr_tick;
 
@@ -24,6 +25,10 @@ static struct k_spinlock timeout_lock;
 /* Cycles left to process in the currently-executing sys_clock_announce() */
 static int announce_remaining;
 
+#ifdef CONFIG_TIMEOUT_SLACK
+static struct k_timeout_slack_stats slack_stats;
+#endif
+
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 
@@ -64,17 +69,43 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
+/* Ticks from the last announcement to the next expiry, which may be
+ * delayed within the slack of the timeouts due first, so that they are
+ * all handled together. Must be called with a non-empty list.
+ */
+static int64_t first_expiry(void)
+{
+	struct _timeout *t = first();
+	int64_t due = t->dticks;
+#ifdef CONFIG_TIMEOUT_SLACK
+	int64_t latest = due + t->slack;
+
+	for (t = next(t); t != NULL; t = next(t)) {
+		due += t->dticks;
+		if (due > latest) {
+			break;
+		}
+		latest = MIN(latest, due + t->slack);
+	}
+
+	return latest;
+#else
+	return due;
+#endif
+}
+
 static int32_t next_timeout(void)
 {
 	struct _timeout *to = first();
 	int32_t ticks_elapsed = elapsed();
+	int64_t expiry = (to == NULL) ? 0 : first_expiry();
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(expiry - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, expiry - ticks_elapsed);
 	}
 
 #ifdef CONFIG_TIMESLICING
@@ -101,6 +132,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 
 	LOCKED(&timeout_lock) {
 		struct _timeout *t;
+		k_ticks_t due;
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    Z_TICK_ABS(timeout.ticks) >= 0) {
@@ -110,6 +142,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		} else {
 			to->dticks = timeout.ticks + 1 + elapsed();
 		}
+		due = to->dticks;
 
 		for (t = first(); t != NULL; t = next(t)) {
 			if (t->dticks > to->dticks) {
@@ -124,7 +157,11 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			sys_dlist_append(&timeout_list, &to->node);
 		}
 
-		if (to == first()) {
+		/* With slack, a timeout due after the first one may still
+		 * bring the next expiry forward.
+		 */
+		if (to == first() ||
+		    (IS_ENABLED(CONFIG_TIMEOUT_SLACK) && due <= first_expiry())) {
 #if CONFIG_TIMESLICING
 			/*
 			 * This is not ideal, since it does not
@@ -236,8 +273,24 @@ void z_set_timeout_expiry(int32_t ticks, bool is_idle)
 	}
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void k_timeout_slack_stats_get(struct k_timeout_slack_stats *stats, bool reset)
+{
+	LOCKED(&timeout_lock) {
+		*stats = slack_stats;
+		if (reset) {
+			slack_stats = (struct k_timeout_slack_stats) {};
+		}
+	}
+}
+#endif
+
 void sys_clock_announce(int32_t ticks)
 {
+#ifdef CONFIG_PROFILER
+	z_profiler_sample();
+#endif
+
 #ifdef CONFIG_TIMESLICING
 	z_time_slice(ticks);
 #endif
@@ -258,10 +311,26 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_SLACK
+	bool expired = false;
+#endif
+
 	while (first() != NULL && first()->dticks <= announce_remaining) {
 		struct _timeout *t = first();
 		int dt = t->dticks;
 
+#ifdef CONFIG_TIMEOUT_SLACK
+		/* Timeouts due at a later tick than one already handled
+		 * would have needed a wakeup of their own.
+		 */
+		if (expired && dt > 0) {
+			slack_stats.saved++;
+		} else if (!expired) {
+			slack_stats.wakeups++;
+			expired = true;
+		}
+#endif
+
 		curr_tick += dt;
 		announce_remaining -= dt;
 		t->dticks = 0;
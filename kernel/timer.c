@@ -309,3 +309,22 @@ static inline void z_vrfy_k_timer_user_data_set(struct k_timer *timer,
 #include <syscalls/k_timer_user_data_set_mrsh.c>
 
 #endif
+
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_impl_k_timer_slack_set(struct k_timer *timer, k_timeout_t slack)
+{
+	z_timeout_slack_set(&timer->timeout, slack);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_timer_slack_set(struct k_timer *timer,
+					    k_timeout_t slack)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(timer, K_OBJ_TIMER));
+	Z_OOPS(Z_SYSCALL_VERIFY(!K_TIMEOUT_EQ(slack, K_FOREVER) &&
+				Z_TICK_ABS(slack.ticks) < 0));
+	z_impl_k_timer_slack_set(timer, slack);
+}
+#include <syscalls/k_timer_slack_set_mrsh.c>
+#endif
+#endif /* CONFIG_TIMEOUT_SLACK */
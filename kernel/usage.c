@@ -58,6 +58,79 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 #define sched_cpu_update_usage(cpu, cycles)   do { } while (0)
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+static void hist_add(struct k_cycle_hist *hist, uint32_t cycles)
+{
+	unsigned int bucket;
+
+	bucket = find_msb_set(cycles >> CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_SHIFT);
+	bucket = MIN(bucket, CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS - 1);
+
+	hist->count[bucket]++;
+}
+
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	/* Keep the earliest time, the thread may be readied again before
+	 * it gets to run.
+	 */
+	if (thread->base.usage.stamp == 0U) {
+		thread->base.usage.stamp = usage_now();
+		thread->base.usage.ready_from_isr = arch_is_in_isr();
+	}
+}
+
+/* Called with the usage lock held, as thread starts running on cpu */
+static void sched_hist_start(struct _cpu *cpu, struct k_thread *thread,
+			     uint32_t now)
+{
+	struct k_cycle_stats *usage = &thread->base.usage;
+	uint32_t cycles = now - usage->stamp;
+
+	cpu->usage.stamp = now;
+
+	if (usage->stamp == 0U) {
+		return;
+	}
+
+	usage->stamp = 0U;
+
+	if (usage->track_usage) {
+		hist_add(&usage->ready_latency, cycles);
+		if (usage->ready_from_isr) {
+			hist_add(&usage->isr_latency, cycles);
+		}
+	}
+
+	if (cpu->usage.track_usage && thread != cpu->idle_thread) {
+		hist_add(&cpu->usage.ready_latency, cycles);
+		if (usage->ready_from_isr) {
+			hist_add(&cpu->usage.isr_latency, cycles);
+		}
+	}
+}
+
+/* Called with the usage lock held, as the current thread of cpu stops */
+static void sched_hist_stop(struct _cpu *cpu, uint32_t now)
+{
+	uint32_t cycles = now - cpu->usage.stamp;
+
+	if (cpu->usage.stamp == 0U) {
+		return;
+	}
+
+	cpu->usage.stamp = 0U;
+
+	if (cpu->current->base.usage.track_usage) {
+		hist_add(&cpu->current->base.usage.run_length, cycles);
+	}
+
+	if (cpu->usage.track_usage && cpu->current != cpu->idle_thread) {
+		hist_add(&cpu->usage.run_length, cycles);
+	}
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 {
 	thread->base.usage.total += cycles;
@@ -80,6 +153,10 @@ void z_sched_usage_start(struct k_thread *thread)
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	sched_hist_start(_current_cpu, thread, _current_cpu->usage0);
+#endif
+
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
 		thread->base.usage.current = 0;
@@ -103,13 +180,18 @@ void z_sched_usage_stop(void)
 	uint32_t u0 = cpu->usage0;
 
 	if (u0 != 0) {
-		uint32_t cycles = usage_now() - u0;
+		uint32_t now = usage_now();
+		uint32_t cycles = now - u0;
 
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
 		}
 
 		sched_cpu_update_usage(cpu, cycles);
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+		sched_hist_stop(cpu, now);
+#endif
 	}
 
 	cpu->usage0 = 0;
@@ -145,6 +227,8 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 		cpu->usage0 = now;
 	}
 
+	cpu = &_kernel.cpus[cpu_id];
+
 	stats->total_cycles     = cpu->usage.total;
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	stats->current_cycles   = cpu->usage.current;
@@ -158,6 +242,12 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	}
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	stats->ready_latency = cpu->usage.ready_latency;
+	stats->run_length    = cpu->usage.run_length;
+	stats->isr_latency   = cpu->usage.isr_latency;
+#endif
+
 	stats->idle_cycles =
 		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
 
@@ -213,6 +303,12 @@ void z_sched_thread_usage(struct k_thread *thread,
 	}
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	stats->ready_latency = thread->base.usage.ready_latency;
+	stats->run_length    = thread->base.usage.run_length;
+	stats->isr_latency   = thread->base.usage.isr_latency;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
 #endif
@@ -157,6 +157,198 @@ int k_work_busy_get(const struct k_work *work)
 	return ret;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+static inline bool queue_is_pool(const struct k_work_q *queue)
+{
+	return queue->workers != NULL;
+}
+
+/* Find the worker of a pool that is running a work item.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the pool
+ * @param work the work item
+ *
+ * @return the worker running @p work, or NULL if it is not running.
+ */
+static struct k_work_q_worker *pool_runner_locked(struct k_work_q *queue,
+						  const struct k_work *work)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (queue->workers[i].current == work) {
+			return &queue->workers[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the worker of a pool that has a work item on its pending list.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the pool
+ * @param work the work item
+ *
+ * @return the worker holding @p work, or NULL if it is not queued.
+ */
+static struct k_work_q_worker *pool_holder_locked(struct k_work_q *queue,
+						  const struct k_work *work)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		struct k_work *wn;
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers[i].pending, wn, node) {
+			if (wn == work) {
+				return &queue->workers[i];
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/* Determine whether the current thread is a worker of a pool. */
+static bool pool_is_worker(const struct k_work_q *queue)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (_current == &queue->workers[i].thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Append a work item to a pool.
+ *
+ * Work that is running is appended to the list of the worker running it,
+ * which will process it again once the handler returns.  Other work is
+ * appended to the list of the worker associated with the current CPU.
+ *
+ * Invoked with work lock held.
+ */
+static void pool_append_locked(struct k_work_q *queue, struct k_work *work)
+{
+	struct k_work_q_worker *worker = pool_runner_locked(queue, work);
+
+	if (worker == NULL) {
+		worker = &queue->workers[_current_cpu->id % queue->num_workers];
+	}
+
+	sys_slist_append(&worker->pending, &work->node);
+}
+
+/* Determine whether any worker of a pool may process a work item.
+ *
+ * A running item may only be processed again by the worker running it,
+ * which is guaranteed as such an item is never taken by any worker.  A
+ * flusher waits for the item it flushes to complete.  That item may be
+ * released once its handler returns, so it is only looked for among the
+ * items the workers are running, and never dereferenced.
+ *
+ * Invoked with work lock held.
+ */
+static bool pool_can_take_locked(struct k_work_q *queue,
+				 const struct k_work *work)
+{
+	if (flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+		return false;
+	}
+
+	if (work->handler == handle_flush) {
+		const struct z_work_flusher *flusher
+			= CONTAINER_OF(work, struct z_work_flusher, work);
+
+		return pool_runner_locked(queue, flusher->target) == NULL;
+	}
+
+	return true;
+}
+
+/* Take the next work item to be processed by a worker of a pool.
+ *
+ * The worker looks at its own list first, then steals from the lists of
+ * the other workers.
+ *
+ * Invoked with work lock held.
+ *
+ * @param worker the worker looking for work
+ *
+ * @return the work item removed from a pending list, or NULL if none can
+ * be processed.
+ */
+static struct k_work *pool_get_locked(struct k_work_q_worker *worker)
+{
+	struct k_work_q *queue = worker->queue;
+	size_t self = worker - queue->workers;
+
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		struct k_work_q_worker *victim
+			= &queue->workers[(self + i) % queue->num_workers];
+		sys_snode_t *prev = NULL;
+		struct k_work *work;
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&victim->pending, work, node) {
+			if (pool_can_take_locked(queue, work)) {
+				sys_slist_remove(&victim->pending, prev,
+						 &work->node);
+				return work;
+			}
+
+			prev = &work->node;
+		}
+	}
+
+	return NULL;
+}
+
+/* Add a flusher work item to a pool.
+ *
+ * Invoked with work lock held.
+ *
+ * See queue_flusher_locked().
+ */
+static void pool_flusher_locked(struct k_work_q *queue,
+				struct k_work *work,
+				struct z_work_flusher *flusher)
+{
+	struct k_work_q_worker *worker = pool_holder_locked(queue, work);
+
+	init_flusher(flusher);
+	flusher->target = work;
+
+	if (worker != NULL) {
+		sys_slist_insert(&worker->pending, &work->node,
+				 &flusher->work.node);
+	} else {
+		worker = pool_runner_locked(queue, work);
+		__ASSERT_NO_MSG(worker != NULL);
+		sys_slist_prepend(&worker->pending, &flusher->work.node);
+	}
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+/* Determine whether no work item is queued on a queue.
+ *
+ * Invoked with work lock held.
+ */
+static bool queue_is_empty_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (!sys_slist_is_empty(&queue->workers[i].pending)) {
+			return false;
+		}
+	}
+#endif
+
+	return sys_slist_is_empty(&queue->pending);
+}
+
 /* Add a flusher work item to the queue.
  *
  * Invoked with work lock held.
@@ -175,6 +367,13 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	bool in_list = false;
 	struct k_work *wn;
 
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (queue_is_pool(queue)) {
+		pool_flusher_locked(queue, work, flusher);
+		return;
+	}
+#endif
+
 	/* Determine whether the work item is still queued. */
 	SYS_SLIST_FOR_EACH_CONTAINER(&queue->pending, wn, node) {
 		if (wn == work) {
@@ -202,9 +401,23 @@ static void queue_flusher_locked(struct k_work_q *queue,
 static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
-	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
-		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
+	if (!flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
+		return;
 	}
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (queue_is_pool(queue)) {
+		struct k_work_q_worker *worker = pool_holder_locked(queue, work);
+
+		if (worker != NULL) {
+			(void)sys_slist_find_and_remove(&worker->pending,
+							&work->node);
+		}
+		return;
+	}
+#endif
+
+	(void)sys_slist_find_and_remove(&queue->pending, &work->node);
 }
 
 /* Potentially notify a queue that it needs to look for pending work.
@@ -257,6 +470,13 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 
 	int ret = -EBUSY;
 	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+#ifdef CONFIG_WORKQUEUE_POOL
+	bool pool = queue_is_pool(queue);
+
+	if (pool) {
+		chained = pool_is_worker(queue) && !k_is_in_isr();
+	}
+#endif
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -274,7 +494,15 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (pool) {
+			pool_append_locked(queue, work);
+		} else {
+			sys_slist_append(&queue->pending, &work->node);
+		}
+#else
 		sys_slist_append(&queue->pending, &work->node);
+#endif
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -692,6 +920,76 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	}
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+/* Loop executed by a thread of a work queue pool.
+ *
+ * @param worker_ptr pointer to the worker structure
+ */
+static void work_queue_pool_main(void *worker_ptr, void *p2, void *p3)
+{
+	struct k_work_q_worker *worker = worker_ptr;
+	struct k_work_q *queue = worker->queue;
+
+	while (true) {
+		struct k_work *work;
+		k_work_handler_t handler;
+		k_spinlock_key_t key = k_spin_lock(&lock);
+		bool yield;
+
+		work = pool_get_locked(worker);
+		if (work == NULL) {
+			/* The last worker to go idle releases the threads
+			 * waiting for the queue to drain.  Work still on the
+			 * lists is held back by a busy worker, which comes
+			 * back here once it completes.
+			 */
+			if ((queue->num_busy == 0U)
+			    && flag_test_and_clear(&queue->flags,
+						   K_WORK_QUEUE_DRAIN_BIT)) {
+				(void)z_sched_wake_all(&queue->drainq, 1, NULL);
+			}
+
+			(void)z_sched_wait(&lock, key, &queue->notifyq,
+					   K_FOREVER, NULL);
+			continue;
+		}
+
+		queue->num_busy++;
+		flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		worker->current = work;
+		flag_set(&work->flags, K_WORK_RUNNING_BIT);
+		flag_clear(&work->flags, K_WORK_QUEUED_BIT);
+		handler = work->handler;
+
+		k_spin_unlock(&lock, key);
+
+		__ASSERT_NO_MSG(handler != NULL);
+		handler(work);
+
+		key = k_spin_lock(&lock);
+
+		flag_clear(&work->flags, K_WORK_RUNNING_BIT);
+		if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
+			finalize_cancel_locked(work);
+		}
+
+		worker->current = NULL;
+		if (--queue->num_busy == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+
+		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
+		k_spin_unlock(&lock, key);
+
+		if (yield) {
+			k_yield();
+		}
+	}
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 void k_work_queue_init(struct k_work_q *queue)
 {
 	__ASSERT_NO_MSG(queue != NULL);
@@ -743,6 +1041,74 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+void k_work_queue_pool_start(struct k_work_q *queue,
+			     struct k_work_q_worker *workers,
+			     size_t num_workers, k_thread_stack_t *stacks,
+			     size_t stack_size, int prio,
+			     const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(workers);
+	__ASSERT_NO_MSG((num_workers > 0U) && (num_workers <= UINT16_MAX));
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+	uint32_t flags = K_WORK_QUEUE_STARTED;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	sys_slist_init(&queue->pending);
+	z_waitq_init(&queue->notifyq);
+	z_waitq_init(&queue->drainq);
+
+	for (size_t i = 0; i < num_workers; i++) {
+		workers[i].queue = queue;
+		workers[i].current = NULL;
+		sys_slist_init(&workers[i].pending);
+	}
+
+	queue->workers = workers;
+	queue->num_workers = num_workers;
+	queue->num_busy = 0U;
+
+	if ((cfg != NULL) && cfg->no_yield) {
+		flags |= K_WORK_QUEUE_NO_YIELD;
+	}
+
+	/* As for k_work_queue_start() work can be submitted as soon as the
+	 * state is in place.
+	 */
+	flags_set(&queue->flags, flags);
+
+	for (size_t i = 0; i < num_workers; i++) {
+		struct k_thread *thread = &workers[i].thread;
+
+		(void)k_thread_create(thread,
+				      stacks + i * K_THREAD_STACK_LEN(stack_size),
+				      stack_size, work_queue_pool_main,
+				      &workers[i], NULL, NULL, prio, 0, K_FOREVER);
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			k_thread_name_set(thread, cfg->name);
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((cfg != NULL) && cfg->pin_workers) {
+			(void)k_thread_cpu_pin(thread, i % CONFIG_MP_NUM_CPUS);
+		}
+#endif
+	}
+
+	for (size_t i = 0; i < num_workers; i++) {
+		k_thread_start(&workers[i].thread);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -757,7 +1123,7 @@ int k_work_queue_drain(struct k_work_q *queue,
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
 	    || plug
-	    || !sys_slist_is_empty(&queue->pending)) {
+	    || !queue_is_empty_locked(queue)) {
 		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 		if (plug) {
 			flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
@@ -843,6 +1209,16 @@ void k_work_init_delayable(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_INIT(k_work_delayable, dwork);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	z_timeout_slack_set(&dwork->timeout, slack);
+}
+#endif
+
 static inline int work_delayable_busy_get_locked(const struct k_work_delayable *dwork)
 {
 	return flags_get(&dwork->work.flags) & K_WORK_MASK;
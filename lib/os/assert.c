@@ -6,6 +6,7 @@
 
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/tracing/flight_recorder.h>
 #include <zephyr/zephyr.h>
 
 
@@ -31,6 +32,8 @@ __weak void assert_post_action(const char *file, unsigned int line)
 	ARG_UNUSED(line);
 #endif
 
+	tracing_flight_recorder_freeze();
+
 #ifdef CONFIG_USERSPACE
 	/* User threads aren't allowed to induce kernel panics; generate
 	 * an oops instead.
@@ -7,9 +7,20 @@
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/heap_listener.h>
 #include <zephyr/kernel.h>
+#include <zephyr/stats/stats_perf.h>
 #include <string.h>
 #include "heap.h"
 
+#ifdef CONFIG_STATS_PERF_SYS_HEAP
+STATS_PERF_DEFINE(perf_sys_heap_alloc);
+STATS_PERF_DEFINE(perf_sys_heap_free);
+#define HEAP_PERF_START() STATS_PERF_START()
+#define HEAP_PERF_END(name, start) STATS_PERF_END(name, start)
+#else
+#define HEAP_PERF_START() 0U
+#define HEAP_PERF_END(name, start) ((void)(start))
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 static inline void increase_allocated_bytes(struct z_heap *h, size_t num_bytes)
 {
@@ -162,6 +173,7 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 	if (mem == NULL) {
 		return; /* ISO C free() semantics */
 	}
+	uint32_t start = HEAP_PERF_START();
 	struct z_heap *h = heap->heap;
 	chunkid_t c = mem_to_chunkid(h, mem);
 
@@ -192,6 +204,8 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 #endif
 
 	free_chunk(h, c);
+
+	HEAP_PERF_END(perf_sys_heap_free, start);
 }
 
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
@@ -257,7 +271,7 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
-void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+static void *heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	void *mem;
@@ -294,6 +308,16 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	return mem;
 }
 
+void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+{
+	uint32_t start = HEAP_PERF_START();
+	void *mem = heap_alloc(heap, bytes);
+
+	HEAP_PERF_END(perf_sys_heap_alloc, start);
+
+	return mem;
+}
+
 void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/sys/lfring.h>
+
+/* Directions in which threads may be blocked, also used as event bits */
+#define LFRING_WAIT_NOT_EMPTY BIT(0)
+#define LFRING_WAIT_NOT_FULL  BIT(1)
+
+/* Signed distance between two free running indices */
+static inline long pos_diff(atomic_val_t a, atomic_val_t b)
+{
+	return (long)((unsigned long)a - (unsigned long)b);
+}
+
+static inline uint8_t *slot_get(struct sys_lfring *ring, atomic_val_t pos)
+{
+	return &ring->buf[((unsigned long)pos & ring->mask) * ring->elem_size];
+}
+
+/*
+ * MPMC slots carry a sequence number stored relative to the slot index,
+ * so that a zeroed array is a valid initial state. A slot is free for a
+ * producer at pos when its sequence number is the lap of pos, it holds an
+ * element for a consumer at pos when it is the lap plus one, and it is
+ * released for the next lap by the consumer.
+ */
+static inline atomic_t *seq_get(struct sys_lfring *ring, atomic_val_t pos)
+{
+	return &ring->seq[(unsigned long)pos & ring->mask];
+}
+
+static inline atomic_val_t lap_get(struct sys_lfring *ring, atomic_val_t pos)
+{
+	return (atomic_val_t)((unsigned long)pos & ~(unsigned long)ring->mask);
+}
+
+static bool ring_is_empty(struct sys_lfring *ring)
+{
+	atomic_val_t pos = atomic_get(&ring->head);
+
+	if (ring->seq == NULL) {
+		return atomic_get(&ring->tail) == pos;
+	}
+
+	return pos_diff(atomic_get(seq_get(ring, pos)),
+			lap_get(ring, pos) + 1) < 0;
+}
+
+static bool ring_is_full(struct sys_lfring *ring)
+{
+	atomic_val_t pos = atomic_get(&ring->tail);
+
+	if (ring->seq == NULL) {
+		return pos_diff(pos, atomic_get(&ring->head)) > (long)ring->mask;
+	}
+
+	return pos_diff(atomic_get(seq_get(ring, pos)), lap_get(ring, pos)) < 0;
+}
+
+static bool spsc_put(struct sys_lfring *ring, const void *elem)
+{
+	atomic_val_t pos = atomic_get(&ring->tail);
+
+	if (pos_diff(pos, atomic_get(&ring->head)) > (long)ring->mask) {
+		return false;
+	}
+
+	memcpy(slot_get(ring, pos), elem, ring->elem_size);
+	atomic_set(&ring->tail, pos + 1);
+
+	return true;
+}
+
+static bool spsc_get(struct sys_lfring *ring, void *elem)
+{
+	atomic_val_t pos = atomic_get(&ring->head);
+
+	if (atomic_get(&ring->tail) == pos) {
+		return false;
+	}
+
+	memcpy(elem, slot_get(ring, pos), ring->elem_size);
+	atomic_set(&ring->head, pos + 1);
+
+	return true;
+}
+
+/* Claim the slot at the index @a idx for which the sequence number is
+ * the lap plus @a ready, advancing @a idx past it.
+ */
+static bool mpmc_claim(struct sys_lfring *ring, atomic_t *idx,
+		       atomic_val_t ready, atomic_val_t *claimed)
+{
+	atomic_val_t pos = atomic_get(idx);
+	long diff;
+
+	while (true) {
+		diff = pos_diff(atomic_get(seq_get(ring, pos)),
+				lap_get(ring, pos) + ready);
+		if (diff < 0) {
+			return false;
+		}
+
+		if (diff == 0 && atomic_cas(idx, pos, pos + 1)) {
+			*claimed = pos;
+			return true;
+		}
+
+		/* Another producer or consumer took the slot */
+		pos = atomic_get(idx);
+	}
+}
+
+static bool mpmc_put(struct sys_lfring *ring, const void *elem)
+{
+	atomic_val_t pos;
+
+	if (!mpmc_claim(ring, &ring->tail, 0, &pos)) {
+		return false;
+	}
+
+	memcpy(slot_get(ring, pos), elem, ring->elem_size);
+	atomic_set(seq_get(ring, pos), lap_get(ring, pos) + 1);
+
+	return true;
+}
+
+static bool mpmc_get(struct sys_lfring *ring, void *elem)
+{
+	atomic_val_t pos;
+
+	if (!mpmc_claim(ring, &ring->head, 1, &pos)) {
+		return false;
+	}
+
+	memcpy(elem, slot_get(ring, pos), ring->elem_size);
+	atomic_set(seq_get(ring, pos), lap_get(ring, pos) + ring->mask + 1);
+
+	return true;
+}
+
+/* Wake the threads blocked in direction @a dir, if any. Only the
+ * waiters flag is read when nobody is blocked.
+ */
+static void ring_notify(struct sys_lfring *ring, atomic_val_t dir)
+{
+	if ((atomic_get(&ring->waiters) & dir) == 0) {
+		return;
+	}
+
+	if ((atomic_and(&ring->waiters, ~dir) & dir) == 0) {
+		return;
+	}
+
+#ifdef CONFIG_USERSPACE
+	struct k_futex *futex = (dir == LFRING_WAIT_NOT_EMPTY) ?
+				&ring->not_empty : &ring->not_full;
+
+	(void)atomic_inc(&futex->val);
+	(void)k_futex_wake(futex, true);
+#else
+	k_event_post((dir == LFRING_WAIT_NOT_EMPTY) ?
+		     &ring->not_empty : &ring->not_full, dir);
+#endif
+}
+
+/* Block until the ring may no longer be empty or full in direction
+ * @a dir. Returns 0 if the operation shall be retried.
+ */
+static int ring_wait(struct sys_lfring *ring, atomic_val_t dir,
+		     k_timeout_t timeout)
+{
+	bool (*is_blocked)(struct sys_lfring *ring) =
+		(dir == LFRING_WAIT_NOT_EMPTY) ? ring_is_empty : ring_is_full;
+
+#ifdef CONFIG_USERSPACE
+	struct k_futex *futex = (dir == LFRING_WAIT_NOT_EMPTY) ?
+				&ring->not_empty : &ring->not_full;
+	int seen = (int)atomic_get(&futex->val);
+	int ret;
+
+	/* The flag is published before checking the ring again, so either
+	 * this thread sees the new state or the other side sees the flag
+	 * and changes the futex value.
+	 */
+	(void)atomic_or(&ring->waiters, dir);
+	if (!is_blocked(ring)) {
+		return 0;
+	}
+
+	ret = k_futex_wait(futex, seen, timeout);
+	if (ret == -ETIMEDOUT) {
+		return -EAGAIN;
+	}
+
+	return (ret == -EAGAIN) ? 0 : ret;
+#else
+	struct k_event *event = (dir == LFRING_WAIT_NOT_EMPTY) ?
+				&ring->not_empty : &ring->not_full;
+
+	k_event_set(event, 0);
+	(void)atomic_or(&ring->waiters, dir);
+	if (!is_blocked(ring)) {
+		return 0;
+	}
+
+	return (k_event_wait(event, dir, false, timeout) == 0) ? -EAGAIN : 0;
+#endif
+}
+
+static int ring_xfer(struct sys_lfring *ring, void *elem, k_timeout_t timeout,
+		     bool put)
+{
+	atomic_val_t dir = put ? LFRING_WAIT_NOT_FULL : LFRING_WAIT_NOT_EMPTY;
+	bool forever = K_TIMEOUT_EQ(timeout, K_FOREVER);
+	k_timeout_t wait = timeout;
+	int64_t end = -1, left;
+	bool done;
+	int ret;
+
+	while (true) {
+		if (ring->seq == NULL) {
+			done = put ? spsc_put(ring, elem) : spsc_get(ring, elem);
+		} else {
+			done = put ? mpmc_put(ring, elem) : mpmc_get(ring, elem);
+		}
+
+		if (done) {
+			ring_notify(ring, put ? LFRING_WAIT_NOT_EMPTY :
+					  LFRING_WAIT_NOT_FULL);
+			return 0;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		/* The deadline is only computed once the ring is found
+		 * empty or full, keeping the fast path out of the kernel.
+		 */
+		if (!forever) {
+			if (end < 0) {
+#ifdef CONFIG_TIMEOUT_64BIT
+				if (Z_TICK_ABS(timeout.ticks) >= 0) {
+					end = Z_TICK_ABS(timeout.ticks);
+				} else
+#endif
+				{
+					end = k_uptime_ticks() + timeout.ticks;
+				}
+			}
+
+			left = end - k_uptime_ticks();
+			if (left <= 0) {
+				return -EAGAIN;
+			}
+
+			wait = K_TICKS(left);
+		}
+
+		ret = ring_wait(ring, dir, wait);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+}
+
+int sys_lfring_init(struct sys_lfring *ring, void *buf, atomic_t *seq,
+		    size_t elem_size, uint32_t len)
+{
+	if (ring == NULL || buf == NULL || elem_size == 0U ||
+	    !Z_LFRING_LEN_VALID(len) || len > (UINT32_MAX >> 2) ||
+	    (seq != NULL && !Z_LFRING_MPMC_LEN_VALID(len))) {
+		return -EINVAL;
+	}
+
+	atomic_set(&ring->tail, 0);
+	atomic_set(&ring->head, 0);
+	atomic_set(&ring->waiters, 0);
+	ring->seq = seq;
+	ring->buf = buf;
+	ring->mask = len - 1U;
+	ring->elem_size = elem_size;
+
+	if (seq != NULL) {
+		for (uint32_t i = 0; i < len; i++) {
+			atomic_set(&seq[i], 0);
+		}
+	}
+
+#ifdef CONFIG_USERSPACE
+	atomic_set(&ring->not_empty.val, 0);
+	atomic_set(&ring->not_full.val, 0);
+#else
+	k_event_init(&ring->not_empty);
+	k_event_init(&ring->not_full);
+#endif
+
+	return 0;
+}
+
+int sys_lfring_put(struct sys_lfring *ring, const void *elem,
+		   k_timeout_t timeout)
+{
+	return ring_xfer(ring, (void *)elem, timeout, true);
+}
+
+int sys_lfring_get(struct sys_lfring *ring, void *elem, k_timeout_t timeout)
+{
+	return ring_xfer(ring, elem, timeout, false);
+}
@@ -21,6 +21,10 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/cbprintf.h>
 #include <sys/types.h>
+#ifdef CONFIG_PRINTK_DEFERRED
+#include <zephyr/init.h>
+#include <zephyr/sys/mpsc_pbuf.h>
+#endif
 
 /* Option present only when CONFIG_USERSPACE enabled. */
 #ifndef CONFIG_PRINTK_BUFFER_SIZE
@@ -115,6 +119,152 @@ static int char_out(int c, void *ctx_p)
 	return _char_out(c);
 }
 
+#ifdef CONFIG_PRINTK_DEFERRED
+/* Messages are stored as cbprintf packages in a packet buffer, and output by
+ * a low priority thread. Packets are a multiple of the package alignment
+ * long, so that each package is aligned.
+ */
+struct printk_pkt_hdr {
+	MPSC_PBUF_HDR;
+	uint32_t wlen: 32 - MPSC_PBUF_HDR_BITS;
+};
+
+#define PKT_HDR_SIZE \
+	ROUND_UP(sizeof(struct printk_pkt_hdr), CBPRINTF_PACKAGE_ALIGNMENT)
+#define PKT_ALIGN_WORDS (CBPRINTF_PACKAGE_ALIGNMENT / sizeof(uint32_t))
+
+static uint32_t __aligned(CBPRINTF_PACKAGE_ALIGNMENT)
+	deferred_buf[ROUND_DOWN(CONFIG_PRINTK_DEFERRED_BUFFER_SIZE,
+				CBPRINTF_PACKAGE_ALIGNMENT) / sizeof(uint32_t)];
+
+static uint32_t deferred_get_wlen(const union mpsc_pbuf_generic *packet)
+{
+	return ((const struct printk_pkt_hdr *)packet)->wlen;
+}
+
+static const struct mpsc_pbuf_buffer_config deferred_config = {
+	.buf = deferred_buf,
+	.size = ARRAY_SIZE(deferred_buf),
+	.get_wlen = deferred_get_wlen,
+	.flags = 0
+};
+
+static struct mpsc_pbuf_buffer deferred;
+/* Cleared until the buffer is initialized, and on fatal errors */
+static bool deferred_enabled;
+static atomic_t deferred_pending;
+static atomic_t deferred_dropped;
+static K_SEM_DEFINE(deferred_sem, 0, 1);
+
+static bool vprintk_deferred(const char *fmt, va_list ap)
+{
+	union mpsc_pbuf_generic *pkt;
+	va_list ap_len;
+	size_t wlen;
+	int plen;
+
+	if (!deferred_enabled) {
+		return false;
+	}
+
+	va_copy(ap_len, ap);
+	plen = cbvprintf_package(NULL, 0, 0, fmt, ap_len);
+	va_end(ap_len);
+	if (plen < 0) {
+		return false;
+	}
+
+	wlen = ceiling_fraction(PKT_HDR_SIZE + plen,
+				CBPRINTF_PACKAGE_ALIGNMENT) * PKT_ALIGN_WORDS;
+	pkt = mpsc_pbuf_alloc(&deferred, wlen, K_NO_WAIT);
+	if (pkt == NULL) {
+		/* Wake up the thread to report the drop */
+		atomic_inc(&deferred_dropped);
+		k_sem_give(&deferred_sem);
+		return true;
+	}
+
+	plen = cbvprintf_package((uint8_t *)pkt + PKT_HDR_SIZE, plen, 0,
+				 fmt, ap);
+	__ASSERT_NO_MSG(plen >= 0);
+
+	((struct printk_pkt_hdr *)pkt)->wlen = wlen;
+	mpsc_pbuf_commit(&deferred, pkt);
+
+	/* The thread is only woken up when the first message is pending */
+	if (atomic_inc(&deferred_pending) == 0) {
+		k_sem_give(&deferred_sem);
+	}
+
+	return true;
+}
+
+static void deferred_flush(void)
+{
+	const union mpsc_pbuf_generic *pkt;
+	struct out_context ctx;
+	atomic_val_t dropped;
+
+	while ((pkt = mpsc_pbuf_claim(&deferred)) != NULL) {
+		ctx.count = 0;
+#ifdef CONFIG_PRINTK_SYNC
+		k_spinlock_key_t key = k_spin_lock(&lock);
+#endif
+
+		(void)cbpprintf(char_out, &ctx,
+				(uint8_t *)pkt + PKT_HDR_SIZE);
+
+#ifdef CONFIG_PRINTK_SYNC
+		k_spin_unlock(&lock, key);
+#endif
+
+		mpsc_pbuf_free(&deferred, pkt);
+		atomic_dec(&deferred_pending);
+	}
+
+	dropped = atomic_set(&deferred_dropped, 0);
+	if (dropped != 0) {
+		ctx.count = 0;
+		cbprintf(char_out, &ctx, "--- %lu printk messages dropped ---\n",
+			 (unsigned long)dropped);
+	}
+}
+
+static void deferred_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&deferred_sem, K_FOREVER);
+		deferred_flush();
+	}
+}
+
+K_THREAD_DEFINE(printk_deferred, CONFIG_PRINTK_DEFERRED_STACK_SIZE,
+		deferred_thread, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+void z_printk_panic(void)
+{
+	deferred_enabled = false;
+	deferred_flush();
+}
+
+static int printk_deferred_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	mpsc_pbuf_init(&deferred, &deferred_config);
+	deferred_enabled = true;
+
+	return 0;
+}
+
+SYS_INIT(printk_deferred_init, PRE_KERNEL_1, 0);
+#endif /* CONFIG_PRINTK_DEFERRED */
+
 void vprintk(const char *fmt, va_list ap)
 {
 	if (IS_ENABLED(CONFIG_LOG_PRINTK)) {
@@ -132,6 +282,13 @@ void vprintk(const char *fmt, va_list ap)
 		}
 	} else {
 		struct out_context ctx = { 0 };
+
+#ifdef CONFIG_PRINTK_DEFERRED
+		if (vprintk_deferred(fmt, ap)) {
+			return;
+		}
+#endif
+
 #ifdef CONFIG_PRINTK_SYNC
 		k_spinlock_key_t key = k_spin_lock(&lock);
 #endif
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/rwlock.h>
+
+#define RWLOCK_WRITER		BIT(30)
+/* Blocks new readers, so that writers are not starved */
+#define RWLOCK_WRITER_WAITING	BIT(29)
+/* Set by waiting threads, the next unlock wakes them all */
+#define RWLOCK_WAITERS		BIT(28)
+#define RWLOCK_READERS		(RWLOCK_WAITERS - 1)
+
+static bool read_trylock(struct sys_rwlock *rwlock)
+{
+	atomic_val_t val;
+
+	do {
+		val = atomic_get(&rwlock->state);
+		if ((val & (RWLOCK_WRITER | RWLOCK_WRITER_WAITING)) != 0 ||
+		    (val & RWLOCK_READERS) == RWLOCK_READERS) {
+			return false;
+		}
+	} while (atomic_cas(&rwlock->state, val, val + 1) == 0);
+
+	return true;
+}
+
+static bool write_trylock(struct sys_rwlock *rwlock)
+{
+	atomic_val_t val;
+
+	do {
+		val = atomic_get(&rwlock->state);
+		if ((val & (RWLOCK_WRITER | RWLOCK_READERS)) != 0) {
+			return false;
+		}
+	} while (atomic_cas(&rwlock->state, val, val | RWLOCK_WRITER) == 0);
+
+	return true;
+}
+
+static void rwlock_wake(struct sys_rwlock *rwlock)
+{
+	(void)atomic_and(&rwlock->state,
+			 ~(RWLOCK_WAITERS | RWLOCK_WRITER_WAITING));
+
+#ifdef CONFIG_USERSPACE
+	(void)atomic_inc(&rwlock->futex.val);
+	(void)k_futex_wake(&rwlock->futex, true);
+#else
+	k_event_post(&rwlock->event, BIT(0));
+#endif
+}
+
+static int rwlock_lock(struct sys_rwlock *rwlock, bool write,
+		       k_timeout_t timeout)
+{
+	bool (*trylock)(struct sys_rwlock *rwlock) =
+		write ? write_trylock : read_trylock;
+	atomic_val_t flags = write ? (RWLOCK_WAITERS | RWLOCK_WRITER_WAITING) :
+				     RWLOCK_WAITERS;
+	bool forever = K_TIMEOUT_EQ(timeout, K_FOREVER);
+	k_timeout_t wait = timeout;
+	int64_t end = 0, left;
+#ifdef CONFIG_USERSPACE
+	int seen, ret;
+#endif
+
+	if (trylock(rwlock)) {
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -EBUSY;
+	}
+
+	/* The deadline is only computed once the lock is found busy,
+	 * keeping the fast path out of the kernel.
+	 */
+	if (!forever) {
+#ifdef CONFIG_TIMEOUT_64BIT
+		if (Z_TICK_ABS(timeout.ticks) >= 0) {
+			end = Z_TICK_ABS(timeout.ticks);
+		} else
+#endif
+		{
+			end = k_uptime_ticks() + timeout.ticks;
+		}
+	}
+
+	while (true) {
+		if (!forever) {
+			left = end - k_uptime_ticks();
+			if (left <= 0) {
+				return -EAGAIN;
+			}
+
+			wait = K_TICKS(left);
+		}
+
+		/* The flags are published before trying again, so either
+		 * this thread gets the lock or the holder sees the flags and
+		 * wakes it.
+		 */
+#ifdef CONFIG_USERSPACE
+		seen = (int)atomic_get(&rwlock->futex.val);
+		(void)atomic_or(&rwlock->state, flags);
+		if (trylock(rwlock)) {
+			return 0;
+		}
+
+		ret = k_futex_wait(&rwlock->futex, seen, wait);
+		if (ret == -ETIMEDOUT) {
+			return -EAGAIN;
+		} else if (ret != 0 && ret != -EAGAIN) {
+			return ret;
+		}
+#else
+		k_event_set(&rwlock->event, 0);
+		(void)atomic_or(&rwlock->state, flags);
+		if (trylock(rwlock)) {
+			return 0;
+		}
+
+		if (k_event_wait(&rwlock->event, BIT(0), false, wait) == 0) {
+			return -EAGAIN;
+		}
+#endif
+
+		if (trylock(rwlock)) {
+			return 0;
+		}
+	}
+}
+
+int sys_rwlock_init(struct sys_rwlock *rwlock)
+{
+	if (rwlock == NULL) {
+		return -EINVAL;
+	}
+
+	atomic_set(&rwlock->state, 0);
+
+#ifdef CONFIG_USERSPACE
+	atomic_set(&rwlock->futex.val, 0);
+#else
+	k_event_init(&rwlock->event);
+#endif
+
+	return 0;
+}
+
+int sys_rwlock_read_lock(struct sys_rwlock *rwlock, k_timeout_t timeout)
+{
+	return rwlock_lock(rwlock, false, timeout);
+}
+
+int sys_rwlock_read_unlock(struct sys_rwlock *rwlock)
+{
+	atomic_val_t val;
+
+	do {
+		val = atomic_get(&rwlock->state);
+		if ((val & RWLOCK_READERS) == 0) {
+			return -EINVAL;
+		}
+	} while (atomic_cas(&rwlock->state, val, val - 1) == 0);
+
+	/* Waiters can only get the lock once the last reader leaves */
+	if ((val & RWLOCK_READERS) == 1 && (val & RWLOCK_WAITERS) != 0) {
+		rwlock_wake(rwlock);
+	}
+
+	return 0;
+}
+
+int sys_rwlock_write_lock(struct sys_rwlock *rwlock, k_timeout_t timeout)
+{
+	return rwlock_lock(rwlock, true, timeout);
+}
+
+int sys_rwlock_write_unlock(struct sys_rwlock *rwlock)
+{
+	atomic_val_t val;
+
+	do {
+		val = atomic_get(&rwlock->state);
+		if ((val & RWLOCK_WRITER) == 0) {
+			return -EINVAL;
+		}
+	} while (atomic_cas(&rwlock->state, val, val & ~RWLOCK_WRITER) == 0);
+
+	if ((val & RWLOCK_WAITERS) != 0) {
+		rwlock_wake(rwlock);
+	}
+
+	return 0;
+}
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 agent <agent@local>
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Reader for framed dictionary log files
+
+The file system log backend writes dictionary-based log messages
+in frames following a file header. This extracts the raw log data
+from such files, decompressing frames as needed.
+"""
+
+import logging
+import struct
+
+
+FILE_MAGIC = b"ZLDF"
+FILE_VERSION = 1
+FILE_HDR_FMT = "<4sBBH"
+FRAME_HDR_FMT = "<HH"
+
+logger = logging.getLogger("parser")
+
+
+def is_framed(data):
+    """Return True if the log data starts with a framed file header"""
+    return data[:len(FILE_MAGIC)] == FILE_MAGIC
+
+
+def lz4_block_decompress(src, raw_len):
+    """Decompress a block in the LZ4 block format"""
+    dst = bytearray()
+    idx = 0
+
+    def read_len(length):
+        nonlocal idx
+        if length == 15:
+            while True:
+                val = src[idx]
+                idx += 1
+                length += val
+                if val != 255:
+                    break
+        return length
+
+    while idx < len(src):
+        token = src[idx]
+        idx += 1
+
+        lit_len = read_len(token >> 4)
+        dst += src[idx:idx + lit_len]
+        idx += lit_len
+
+        if idx >= len(src):
+            # Last sequence only has literals
+            break
+
+        offset = src[idx] | (src[idx + 1] << 8)
+        idx += 2
+        if offset == 0 or offset > len(dst):
+            raise ValueError("invalid match offset")
+
+        match_len = read_len(token & 0xF) + 4
+        start = len(dst) - offset
+        for i in range(match_len):
+            # Matches may overlap with the bytes being copied
+            dst.append(dst[start + i])
+
+    if len(dst) != raw_len:
+        raise ValueError("decompressed length mismatch")
+
+    return bytes(dst)
+
+
+def unframe(data):
+    """
+    Return the log data held in the frames of a framed log file.
+
+    Reading stops at the first empty or truncated frame, which is
+    where the file ended when it was last written.
+    """
+    magic, version, _, align = struct.unpack_from(FILE_HDR_FMT, data)
+    if magic != FILE_MAGIC or version != FILE_VERSION or align == 0:
+        logger.error("ERROR: Unsupported log file header")
+        return None
+
+    logdata = b''
+    hdr_len = struct.calcsize(FRAME_HDR_FMT)
+    offset = align
+
+    while offset + hdr_len <= len(data):
+        stored_len, raw_len = struct.unpack_from(FRAME_HDR_FMT, data, offset)
+        if stored_len == 0 or stored_len > raw_len:
+            break
+
+        payload = data[offset + hdr_len:offset + hdr_len + stored_len]
+        if len(payload) != stored_len:
+            logger.debug("# Truncated frame at offset %d", offset)
+            break
+
+        if stored_len < raw_len:
+            try:
+                payload = lz4_block_decompress(payload, raw_len)
+            except (ValueError, IndexError):
+                logger.error("ERROR: Corrupted frame at offset %d", offset)
+                break
+
+        logdata += payload
+
+        frame_len = hdr_len + stored_len
+        offset += (frame_len + align - 1) // align * align
+
+    return logdata
@@ -17,6 +17,7 @@ import logging
 import sys
 
 import dictionary_parser
+from dictionary_parser import log_file
 from dictionary_parser.log_database import LogDatabase
 
 
@@ -31,7 +32,8 @@ def parse_args():
     argparser = argparse.ArgumentParser()
 
     argparser.add_argument("dbfile", help="Dictionary Logging Database file")
-    argparser.add_argument("logfile", help="Log Data file")
+    argparser.add_argument("logfile", nargs="+",
+                           help="Log Data file(s), parsed in the given order")
     argparser.add_argument("--hex", action="store_true",
                            help="Log Data file is in hexadecimal strings")
     argparser.add_argument("--rawhex", action="store_true",
@@ -42,7 +44,7 @@ def parse_args():
     return argparser.parse_args()
 
 
-def read_log_file(args):
+def read_log_file(args, logfilename):
     """
     Read the log from file
     """
@@ -52,11 +54,11 @@ def read_log_file(args):
     if args.hex:
         if args.rawhex:
             # Simply log file with only hexadecimal data
-            logdata = dictionary_parser.utils.convert_hex_file_to_bin(args.logfile)
+            logdata = dictionary_parser.utils.convert_hex_file_to_bin(logfilename)
         else:
             hexdata = ''
 
-            with open(args.logfile, "r", encoding="iso-8859-1") as hexfile:
+            with open(logfilename, "r", encoding="iso-8859-1") as hexfile:
                 for line in hexfile.readlines():
                     hexdata += line.strip()
 
@@ -89,15 +91,19 @@ def read_log_file(args):
 
             logdata = binascii.unhexlify(hexdata[:idx])
     else:
-        logfile = open(args.logfile, "rb")
+        logfile = open(logfilename, "rb")
         if not logfile:
-            logger.error("ERROR: Cannot open binary log data file: %s, exiting...", args.logfile)
+            logger.error("ERROR: Cannot open binary log data file: %s, exiting...", logfilename)
             sys.exit(1)
 
         logdata = logfile.read()
 
         logfile.close()
 
+        # Files written by the file system backend may be framed
+        if log_file.is_framed(logdata):
+            logdata = log_file.unframe(logdata)
+
     return logdata
 
 
@@ -118,11 +124,6 @@ def main():
         logger.error("ERROR: Cannot open database file: %s, exiting...", args.dbfile)
         sys.exit(1)
 
-    logdata = read_log_file(args)
-    if logdata is None:
-        logger.error("ERROR: cannot read log from file: %s, exiting...", args.logfile)
-        sys.exit(1)
-
     log_parser = dictionary_parser.get_parser(database)
     if log_parser is not None:
         logger.debug("# Build ID: %s", database.get_build_id())
@@ -132,10 +133,16 @@ def main():
         else:
             logger.debug("# Endianness: Big")
 
-        ret = log_parser.parse_log_data(logdata, debug=args.debug)
-        if not ret:
-            logger.error("ERROR: there were error(s) parsing log data")
-            sys.exit(1)
+        for logfilename in args.logfile:
+            logdata = read_log_file(args, logfilename)
+            if logdata is None:
+                logger.error("ERROR: cannot read log from file: %s, exiting...", logfilename)
+                sys.exit(1)
+
+            ret = log_parser.parse_log_data(logdata, debug=args.debug)
+            if not ret:
+                logger.error("ERROR: there were error(s) parsing log data")
+                sys.exit(1)
     else:
         logger.error("ERROR: Cannot find a suitable parser matching database version!")
         sys.exit(1)
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 agent <agent@local>
+#
+# SPDX-License-Identifier: Apache-2.0
+"""
+Script to symbolize the histogram printed by the sampling profiler
+(CONFIG_PROFILER), given the ELF file of the application.
+
+Capture the output of profiler_print() or of the "profiler print" shell
+command, then:
+
+    ./scripts/profiler/profiler_report.py build/zephyr/zephyr.elf log.txt
+
+prints the samples per function, most sampled first. With backtraces
+(CONFIG_PROFILER_BACKTRACE_DEPTH), --folded prints the call stacks in the
+folded format of FlameGraph instead.
+"""
+
+import argparse
+import bisect
+import collections
+import re
+import sys
+
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+ENTRY_RE = re.compile(r"(\d+) samples at ((?:0x[0-9a-fA-F]+ ?)+)")
+SUMMARY_RE = re.compile(
+        r"\d+ samples, \d+ dropped, \d+ unlisted, overhead [\d.]+ %")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+            description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="ELF file of the application")
+    parser.add_argument("log", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="profiler output (default: standard input)")
+    parser.add_argument("--folded", action="store_true",
+                        help="print the call stacks in folded format")
+    return parser.parse_args()
+
+
+class Symbols:
+    """Maps addresses to the name of the function containing them."""
+
+    def __init__(self, path):
+        funcs = []
+        with open(path, "rb") as f:
+            elf = ELFFile(f)
+            # Thumb function addresses have the lowest bit set
+            mask = ~1 if elf["e_machine"] == "EM_ARM" else ~0
+            for section in elf.iter_sections():
+                if not isinstance(section, SymbolTableSection):
+                    continue
+                for sym in section.iter_symbols():
+                    if (sym["st_info"]["type"] == "STT_FUNC" and
+                            sym["st_size"] > 0):
+                        start = sym["st_value"] & mask
+                        funcs.append((start, start + sym["st_size"],
+                                      sym.name))
+        funcs.sort()
+        self.starts = [func[0] for func in funcs]
+        self.funcs = funcs
+
+    def name(self, addr):
+        if addr == 0:
+            return "[interrupt]"
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i >= 0 and addr < self.funcs[i][1]:
+            return self.funcs[i][2]
+        return f"0x{addr:x}"
+
+
+def main():
+    args = parse_args()
+    symbols = Symbols(args.elf)
+    per_func = collections.Counter()
+    stacks = collections.Counter()
+    total = 0
+
+    for line in args.log:
+        summary = SUMMARY_RE.search(line)
+        if summary is not None:
+            print(summary.group(0))
+            continue
+        match = ENTRY_RE.search(line)
+        if match is None:
+            continue
+        count = int(match.group(1))
+        addrs = [int(addr, 16) for addr in match.group(2).split()]
+        # Return addresses point after the call, look up the call itself
+        names = [symbols.name(addrs[0])] + \
+                [symbols.name(addr - 1) for addr in addrs[1:]]
+        per_func[names[0]] += count
+        stacks[";".join(reversed(names))] += count
+        total += count
+
+    if args.folded:
+        for stack, count in stacks.most_common():
+            print(f"{stack} {count}")
+        return
+
+    for name, count in per_func.most_common():
+        print(f"{count:8} {100 * count / total:6.2f}% {name}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 agent <agent@local>
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""tests for the framed dictionary log file reader"""
+
+import os
+import sys
+
+import pytest
+
+sys.path.insert(0, os.path.join(os.environ["ZEPHYR_BASE"],
+                                "scripts", "logging", "dictionary"))
+from dictionary_parser import log_file  # Implementation Under Test
+
+# Log file written with the framing and LZ4 encoder of the file system
+# backend (subsys/logging/log_backend_fs.c), with a write alignment of
+# 16 bytes, from the frames in FRAMES.
+LOG_FILE = bytes.fromhex(
+    "5a4c4446010010000000000000000000"
+    "2200e600ff0864696374696f6e617279"
+    "206c6f67206d657373616765201700b7"
+    "50736167652000000000000000000000"
+    "c800c800079e35cc63fa9128bf56ed84"
+    "1bb249e0770ea53cd36a01982fc65df4"
+    "8b22b950e77e15ac43da71089f36cd64"
+    "fb9229c057ee851cb34ae1780fa63dd4"
+    "6b029930c75ef58c23ba51e87f16ad44"
+    "db7209a037ce65fc932ac158ef861db4"
+    "4be27910a73ed56c039a31c85ff68d24"
+    "bb52e98017ae45dc730aa138cf66fd94"
+    "2bc259f0871eb54ce37a11a83fd66d04"
+    "9b32c960f78e25bc53ea8118af46dd74"
+    "0ba239d067fe952cc35af1881fb64de4"
+    "7b12a940d76e059c33ca61f88f26bd54"
+    "eb8219b047de750ca33ad16800000000"
+    "35005401ff1a030a11181f262d343b42"
+    "4950575e656c737a81888f969da4abb2"
+    "b9c0c7ced5dce3eaf1f8ff060d140001"
+    "00ff1450000000000000000000000000")
+
+FRAMES = [
+    # Repeated text, compressed to a long match
+    b"dictionary log message " * 10,
+    # Does not compress, stored as it is
+    bytes((i * 151 + 7) & 0xFF for i in range(200)),
+    # Long literals followed by a match longer than 255 bytes
+    bytes((i * 7 + 3) & 0xFF for i in range(40)) + bytes(300),
+]
+
+# Offsets and stored lengths of the frames in LOG_FILE
+FRAME_OFFSETS = [(16, 34), (64, 200), (272, 53)]
+
+
+def test_is_framed():
+    """Framed files are told from raw log data by their header"""
+    assert log_file.is_framed(LOG_FILE)
+    assert not log_file.is_framed(b"".join(FRAMES))
+
+
+def test_unframe():
+    """All frames are read, decompressing those which were compressed"""
+    assert log_file.unframe(LOG_FILE) == b"".join(FRAMES)
+
+
+@pytest.mark.parametrize("frame", range(len(FRAMES)))
+def test_lz4_block_decompress(frame):
+    """Compressed frames decompress to the data they were written from"""
+    offset, stored = FRAME_OFFSETS[frame]
+    raw = FRAMES[frame]
+    payload = LOG_FILE[offset + 4:offset + 4 + stored]
+
+    if stored == len(raw):
+        assert payload == raw
+    else:
+        assert log_file.lz4_block_decompress(payload, len(raw)) == raw
+
+
+def test_unframe_truncated():
+    """Reading stops at a frame cut short, as at the end of a full disk"""
+    offset, _ = FRAME_OFFSETS[2]
+
+    assert log_file.unframe(LOG_FILE[:offset + 20]) == b"".join(FRAMES[:2])
+    assert log_file.unframe(LOG_FILE[:offset]) == b"".join(FRAMES[:2])
+
+
+def test_unframe_erased():
+    """Reading stops at a zeroed frame header"""
+    assert log_file.unframe(LOG_FILE + bytes(32)) == b"".join(FRAMES)
+
+
+def test_unframe_corrupted():
+    """A corrupted compressed frame ends reading"""
+    offset, _ = FRAME_OFFSETS[2]
+    data = bytearray(LOG_FILE)
+    # Make the match offset point before the start of the frame
+    data[offset + 4 + 43:offset + 4 + 45] = b"\xff\x00"
+
+    assert log_file.unframe(bytes(data)) == b"".join(FRAMES[:2])
+
+
+def test_unframe_bad_header():
+    """Files with another header are not read"""
+    assert log_file.unframe(b"ZLDX" + LOG_FILE[4:]) is None
+    assert log_file.unframe(LOG_FILE[:4] + b"\x02" + LOG_FILE[5:]) is None
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 agent <agent@local>
+#
+# SPDX-License-Identifier: Apache-2.0
+"""
+Script to convert the contents of a frozen tracing flight recorder to a
+trace stream, by removing the header the recorder adds to each packet.
+
+Dump the recorder with a debugger, for example after a fatal error:
+
+    (gdb) dump binary memory recorder.bin tracing_flight_recorder.buf \
+      tracing_flight_recorder.buf+tracing_flight_recorder.used
+
+With CTF tracing, the stream can then be parsed with parse_ctf.py:
+
+    mkdir ctf
+    ./scripts/tracing/flight_recorder.py recorder.bin ctf/channel0_0
+    cp subsys/tracing/ctf/tsdl/metadata ctf/
+    ./scripts/tracing/parse_ctf.py -t ctf
+"""
+
+import argparse
+import struct
+import sys
+
+HDR = struct.Struct("<HH")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+            description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="flight recorder contents")
+    parser.add_argument("stream", help="output trace stream")
+    return parser.parse_args()
+
+
+def packets(data):
+    """Yield (uptime ms low 16 bits, payload) of each recorded packet."""
+    off = 0
+    while off + HDR.size <= len(data):
+        length, stamp = HDR.unpack_from(data, off)
+        off += HDR.size
+        if off + length > len(data):
+            sys.exit(f"Truncated packet at offset {off - HDR.size}")
+        yield stamp, data[off:off + length]
+        off += length
+
+
+def main():
+    args = parse_args()
+
+    with open(args.dump, "rb") as f:
+        data = f.read()
+
+    count = 0
+    first = last = None
+    with open(args.stream, "wb") as f:
+        for stamp, payload in packets(data):
+            f.write(payload)
+            count += 1
+            if first is None:
+                first = stamp
+            last = stamp
+
+    if count > 0:
+        span = (last - first) & 0xffff
+        print(f"{count} packets over the last {span} ms")
+    else:
+        print("No packet recorded")
+
+
+if __name__ == "__main__":
+    main()
@@ -10,6 +10,7 @@
 #include <zephyr/debug/coredump.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/tracing/flight_recorder.h>
 
 #include "coredump_internal.h"
 
@@ -114,6 +115,24 @@ void process_memory_region_list(void)
 #endif
 }
 
+static void dump_flight_recorder(void)
+{
+	const uint8_t *data;
+	size_t len;
+
+	/* Already part of the RAM dump otherwise */
+	if (IS_ENABLED(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_LINKER_RAM)) {
+		return;
+	}
+
+	tracing_flight_recorder_freeze();
+	len = tracing_flight_recorder_data_get(&data);
+	if (len > 0) {
+		coredump_memory_dump(POINTER_TO_UINT(data),
+				     POINTER_TO_UINT(data) + len);
+	}
+}
+
 void coredump(unsigned int reason, const z_arch_esf_t *esf,
 	      struct k_thread *thread)
 {
@@ -131,6 +150,8 @@ void coredump(unsigned int reason, const z_arch_esf_t *esf,
 
 	process_memory_region_list();
 
+	dump_flight_recorder();
+
 	z_coredump_end();
 }
 
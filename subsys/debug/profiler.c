@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ *  @brief Sampling profiler implementation
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/debug/profiler.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/printk.h>
+#ifdef CONFIG_PROFILER_SHELL
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(profiler, CONFIG_PROFILER_LOG_LEVEL);
+
+#if IS_ENABLED(CONFIG_PROFILER_USE_PRINTK)
+#define PROFILER_PRINT(...) printk(__VA_ARGS__)
+#define PROFILER_FMT(str)   "profiler: " str "\n"
+#define PROFILER_VSTR(str)  (str)
+#else
+#define PROFILER_PRINT(...) LOG_INF(__VA_ARGS__)
+#define PROFILER_FMT(str)   str
+#define PROFILER_VSTR(str)  log_strdup(str)
+#endif
+
+/* Samples are buffered per CPU by the timer interrupt, and moved to the
+ * histogram by a work item before the buffer gets full.
+ */
+struct profiler_cpu {
+	struct k_spinlock lock;
+	uint32_t head;
+	uint32_t tail;
+	uint32_t dropped;
+	/* Cycles spent sampling */
+	uint64_t overhead;
+	uintptr_t samples[CONFIG_PROFILER_BUFFER_SIZE][PROFILER_SAMPLE_DEPTH];
+};
+
+struct profiler_entry {
+	uintptr_t pcs[PROFILER_SAMPLE_DEPTH];
+	uint32_t count;
+};
+
+static struct profiler_cpu cpus[CONFIG_MP_NUM_CPUS];
+
+static struct profiler_entry histogram[CONFIG_PROFILER_HISTOGRAM_SIZE];
+/* Samples which did not fit in the histogram */
+static uint32_t unlisted;
+static K_MUTEX_DEFINE(histogram_lock);
+
+static atomic_t running;
+static int64_t start_ms;
+static int64_t elapsed_ms;
+
+static void drain_handler(struct k_work *work);
+static K_WORK_DEFINE(drain_work, drain_handler);
+static K_TIMER_DEFINE(sample_timer, NULL, NULL);
+
+#if defined(CONFIG_X86) && !defined(CONFIG_X86_64) && !defined(CONFIG_X86_KPTI)
+
+#if CONFIG_PROFILER_BACKTRACE_DEPTH > 0
+static void backtrace(uintptr_t *ras, uintptr_t irq_top)
+{
+	uintptr_t irq_bottom = irq_top - CONFIG_ISR_STACK_SIZE;
+	uintptr_t start = _current->stack_info.start;
+	uintptr_t end = start + _current->stack_info.size;
+	uintptr_t *fp = __builtin_frame_address(0);
+	uintptr_t *next;
+
+	/* The frames of the interrupt handling are on the interrupt stack,
+	 * the first frame pointer saved outside of it is the one of the
+	 * interrupted code.
+	 */
+	for (int i = 0; (uintptr_t)fp >= irq_bottom && (uintptr_t)fp < irq_top;
+	     i++) {
+		if (i == 32) {
+			return;
+		}
+		fp = (uintptr_t *)fp[0];
+	}
+
+	for (int i = 0; i < CONFIG_PROFILER_BACKTRACE_DEPTH; i++) {
+		if ((uintptr_t)fp < start ||
+		    (uintptr_t)(fp + 2) > end) {
+			break;
+		}
+
+		ras[i] = fp[1];
+
+		next = (uintptr_t *)fp[0];
+		if (next <= fp) {
+			break;
+		}
+		fp = next;
+	}
+}
+#endif
+
+static void sample_get(uintptr_t *pcs)
+{
+	uintptr_t irq_top = (uintptr_t)_current_cpu->irq_stack;
+	uint32_t *frame;
+
+	if (_current_cpu->nested != 1) {
+		return;
+	}
+
+	/* _interrupt_enter saves the stack pointer of the interrupted code
+	 * at the top of the interrupt stack, after pushing edi, ecx, edx and
+	 * eax over the interrupt frame.
+	 */
+	frame = (uint32_t *)((uint32_t *)irq_top)[-1];
+	pcs[0] = frame[4];
+
+#if CONFIG_PROFILER_BACKTRACE_DEPTH > 0
+	backtrace(&pcs[1], irq_top);
+#endif
+}
+
+#elif defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+
+static void sample_get(uintptr_t *pcs)
+{
+	/* Threads run on the process stack, where the exception entry
+	 * stacked their frame, only valid if no other exception is active.
+	 */
+	if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) == 0) {
+		return;
+	}
+
+	pcs[0] = ((uint32_t *)__get_PSP())[6];
+}
+
+#else
+
+/* Without a way to find the interrupted program counter, samples are
+ * attributed to the entry point of the interrupted thread.
+ */
+static void sample_get(uintptr_t *pcs)
+{
+	pcs[0] = (uintptr_t)_current->entry.pEntry;
+}
+
+#endif
+
+void z_profiler_sample(void)
+{
+	uintptr_t pcs[PROFILER_SAMPLE_DEPTH] = { 0 };
+	struct profiler_cpu *cpu;
+	k_spinlock_key_t key;
+	uint32_t start;
+	bool half_full;
+
+	if (!atomic_get(&running)) {
+		return;
+	}
+
+	start = k_cycle_get_32();
+
+	sample_get(pcs);
+
+	cpu = &cpus[_current_cpu->id];
+	key = k_spin_lock(&cpu->lock);
+
+	if (cpu->head - cpu->tail < CONFIG_PROFILER_BUFFER_SIZE) {
+		memcpy(cpu->samples[cpu->head % CONFIG_PROFILER_BUFFER_SIZE],
+		       pcs, sizeof(pcs));
+		cpu->head++;
+	} else {
+		cpu->dropped++;
+	}
+
+	half_full = cpu->head - cpu->tail == CONFIG_PROFILER_BUFFER_SIZE / 2;
+	cpu->overhead += k_cycle_get_32() - start;
+
+	k_spin_unlock(&cpu->lock, key);
+
+	if (half_full) {
+		k_work_submit(&drain_work);
+	}
+}
+
+static void histogram_add(const uintptr_t *pcs)
+{
+	uint32_t hash = 0;
+	uint32_t idx;
+
+	for (int i = 0; i < PROFILER_SAMPLE_DEPTH; i++) {
+		hash = hash * 31U + (uint32_t)pcs[i];
+	}
+
+	idx = hash % CONFIG_PROFILER_HISTOGRAM_SIZE;
+
+	for (int i = 0; i < CONFIG_PROFILER_HISTOGRAM_SIZE; i++) {
+		struct profiler_entry *entry = &histogram[idx];
+
+		if (entry->count == 0U) {
+			memcpy(entry->pcs, pcs, sizeof(entry->pcs));
+		}
+
+		if (memcmp(entry->pcs, pcs, sizeof(entry->pcs)) == 0) {
+			entry->count++;
+			return;
+		}
+
+		idx = (idx + 1U) % CONFIG_PROFILER_HISTOGRAM_SIZE;
+	}
+
+	unlisted++;
+}
+
+/* Called with histogram_lock held */
+static void drain(void)
+{
+	uintptr_t pcs[PROFILER_SAMPLE_DEPTH];
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct profiler_cpu *cpu = &cpus[i];
+
+		while (true) {
+			k_spinlock_key_t key = k_spin_lock(&cpu->lock);
+
+			if (cpu->tail == cpu->head) {
+				k_spin_unlock(&cpu->lock, key);
+				break;
+			}
+
+			memcpy(pcs,
+			       cpu->samples[cpu->tail % CONFIG_PROFILER_BUFFER_SIZE],
+			       sizeof(pcs));
+			cpu->tail++;
+
+			k_spin_unlock(&cpu->lock, key);
+
+			histogram_add(pcs);
+		}
+	}
+}
+
+static void drain_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&histogram_lock, K_FOREVER);
+	drain();
+	k_mutex_unlock(&histogram_lock);
+}
+
+int profiler_start(void)
+{
+	if (!atomic_cas(&running, 0, 1)) {
+		return -EALREADY;
+	}
+
+	start_ms = k_uptime_get();
+	k_timer_start(&sample_timer, K_USEC(CONFIG_PROFILER_SAMPLE_PERIOD_US),
+		      K_USEC(CONFIG_PROFILER_SAMPLE_PERIOD_US));
+
+	return 0;
+}
+
+int profiler_stop(void)
+{
+	if (!atomic_cas(&running, 1, 0)) {
+		return -EALREADY;
+	}
+
+	k_timer_stop(&sample_timer);
+	elapsed_ms += k_uptime_get() - start_ms;
+
+	return 0;
+}
+
+void profiler_reset(void)
+{
+	k_mutex_lock(&histogram_lock, K_FOREVER);
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct profiler_cpu *cpu = &cpus[i];
+		k_spinlock_key_t key = k_spin_lock(&cpu->lock);
+
+		cpu->tail = cpu->head;
+		cpu->dropped = 0U;
+		cpu->overhead = 0U;
+
+		k_spin_unlock(&cpu->lock, key);
+	}
+
+	(void)memset(histogram, 0, sizeof(histogram));
+	unlisted = 0U;
+	start_ms = k_uptime_get();
+	elapsed_ms = 0;
+
+	k_mutex_unlock(&histogram_lock);
+}
+
+void profiler_foreach(profiler_cb_t cb, void *user_data)
+{
+	k_mutex_lock(&histogram_lock, K_FOREVER);
+
+	drain();
+
+	for (int i = 0; i < CONFIG_PROFILER_HISTOGRAM_SIZE; i++) {
+		if (histogram[i].count != 0U) {
+			cb(histogram[i].pcs, histogram[i].count, user_data);
+		}
+	}
+
+	k_mutex_unlock(&histogram_lock);
+}
+
+static void entry_print_cb(const uintptr_t *pcs, uint32_t count,
+			   void *user_data)
+{
+	char str[PROFILER_SAMPLE_DEPTH * (sizeof(uintptr_t) * 2 + 3) + 1];
+	size_t len = 0;
+	uint32_t *total = user_data;
+
+	for (int i = 0; i < PROFILER_SAMPLE_DEPTH &&
+			(i == 0 || pcs[i] != 0U); i++) {
+		len += snprintk(&str[len], sizeof(str) - len, "%s0x%lx",
+				i == 0 ? "" : " ", (unsigned long)pcs[i]);
+	}
+
+	*total += count;
+
+	PROFILER_PRINT(PROFILER_FMT("%u samples at %s"), count,
+		       PROFILER_VSTR(str));
+}
+
+void profiler_print(void)
+{
+	uint64_t overhead = 0U;
+	uint64_t cycles;
+	uint32_t dropped = 0U;
+	uint32_t total = 0U;
+	uint32_t permyriad = 0U;
+	int64_t ms;
+
+	profiler_foreach(entry_print_cb, &total);
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		k_spinlock_key_t key = k_spin_lock(&cpus[i].lock);
+
+		overhead += cpus[i].overhead;
+		dropped += cpus[i].dropped;
+
+		k_spin_unlock(&cpus[i].lock, key);
+	}
+
+	ms = elapsed_ms;
+	if (atomic_get(&running)) {
+		ms += k_uptime_get() - start_ms;
+	}
+
+	cycles = k_ms_to_cyc_floor64(ms) * CONFIG_MP_NUM_CPUS;
+	if (cycles != 0U) {
+		permyriad = (uint32_t)(overhead * 10000U / cycles);
+	}
+
+	PROFILER_PRINT(PROFILER_FMT("%u samples, %u dropped, %u unlisted, "
+				    "overhead %u.%02u %%"),
+		       total + unlisted, dropped, unlisted,
+		       permyriad / 100U, permyriad % 100U);
+}
+
+#ifdef CONFIG_PROFILER_SHELL
+
+static int cmd_start(const struct shell *sh, size_t argc, char **argv)
+{
+	if (profiler_start() != 0) {
+		shell_error(sh, "Profiler already running");
+		return -EALREADY;
+	}
+
+	return 0;
+}
+
+static int cmd_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	if (profiler_stop() != 0) {
+		shell_error(sh, "Profiler not running");
+		return -EALREADY;
+	}
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	profiler_reset();
+
+	return 0;
+}
+
+static int cmd_print(const struct shell *sh, size_t argc, char **argv)
+{
+	profiler_print();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_profiler,
+	SHELL_CMD(start, NULL, "Start sampling", cmd_start),
+	SHELL_CMD(stop, NULL, "Stop sampling", cmd_stop),
+	SHELL_CMD(reset, NULL, "Discard the samples", cmd_reset),
+	SHELL_CMD(print, NULL, "Print the samples histogram", cmd_print),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(profiler, &sub_profiler, "Sampling profiler", NULL);
+
+#endif /* CONFIG_PROFILER_SHELL */
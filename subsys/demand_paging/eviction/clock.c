@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* Index in z_page_frames[] of the next page frame the hand considers */
+static size_t hand;
+
+/* The hand goes around the page frames at most twice. In the first lap the
+ * accessed state of the pages it passes is cleared, so in the second it
+ * finds those which were not accessed since. A dirty page is only evicted
+ * if no clean page was found not accessed, since it needs to be paged out.
+ */
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf, *dirty_pf = NULL;
+	uintptr_t flags;
+
+	for (size_t i = 0; i < 2 * Z_NUM_PAGE_FRAMES; i++) {
+		pf = &z_page_frames[hand];
+		hand = (hand + 1) % Z_NUM_PAGE_FRAMES;
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		flags = arch_page_info_get(pf->addr, NULL, false);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+			/* Second chance */
+			(void)z_page_frame_accessed_clear(pf);
+			continue;
+		}
+
+		if ((flags & ARCH_DATA_PAGE_DIRTY) != 0U) {
+			if (dirty_pf == NULL) {
+				dirty_pf = pf;
+			}
+			continue;
+		}
+
+		*dirty_ptr = false;
+
+		return pf;
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(dirty_pf != NULL, "no page to evict");
+
+	*dirty_ptr = true;
+
+	return dirty_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
@@ -34,7 +34,7 @@ static void nru_periodic_update(struct k_timer *timer)
 		}
 
 		/* Clear accessed bit in page tables */
-		(void)arch_page_info_get(pf->addr, NULL, true);
+		(void)z_page_frame_accessed_clear(pf);
 	}
 
 	irq_unlock(key);
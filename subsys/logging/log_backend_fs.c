@@ -6,11 +6,14 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_ctrl.h>
 #include <assert.h>
 #include <zephyr/fs/fs.h>
+#include <zephyr/sys/byteorder.h>
 
 #define MAX_PATH_LEN 256
 #define MAX_FLASH_WRITE_SIZE 256
@@ -35,6 +38,33 @@ static int get_log_file_id(struct fs_dirent *ent);
 static uint32_t log_format_current = CONFIG_LOG_BACKEND_FS_OUTPUT_DEFAULT;
 #endif
 
+#ifdef CONFIG_LOG_BACKEND_FS_DICT_FRAMES
+/*
+ * Framed dictionary log files start with a header:
+ *
+ *   "ZLDF", version (1 byte), flags (1 byte), alignment (le16)
+ *
+ * zero padded to the alignment, followed by frames:
+ *
+ *   stored length (le16), raw length (le16), stored bytes
+ *
+ * zero padded to the alignment. A frame is compressed in the LZ4 block
+ * format if its stored length is less than its raw length. Decompressed
+ * frames hold whole dictionary log messages.
+ */
+#define DICT_FILE_MAGIC		"ZLDF"
+#define DICT_FILE_VERSION	1
+#define DICT_FILE_HDR_LEN	8
+#define DICT_FRAME_HDR_LEN	4
+#define DICT_ALIGN		CONFIG_LOG_BACKEND_FS_DICT_WRITE_ALIGN
+#define DICT_BATCH_SIZE		CONFIG_LOG_BACKEND_FS_DICT_BATCH_SIZE
+
+BUILD_ASSERT(IS_POWER_OF_TWO(DICT_ALIGN),
+	     "Frame write alignment must be a power of two");
+
+static int write_file_header(struct fs_file_t *f);
+#endif
+
 static int check_log_volumen_available(void)
 {
 	int index = 0;
@@ -179,10 +209,27 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 			if (rc < 0) {
 				goto on_error;
 			}
+
+			/* The new file may start with a header */
+			size = fs_tell(f);
+			if (size < 0) {
+				goto on_error;
+			}
 		}
 
 		rc = fs_write(f, data, length);
 		if (rc >= 0) {
+			if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_DICT_FRAMES) &&
+			    (rc != length)) {
+				/* Frames are written whole or not at all,
+				 * a partial one would corrupt the file.
+				 */
+				if ((fs_truncate(f, size) < 0) ||
+				    (fs_seek(f, size, FS_SEEK_SET) < 0)) {
+					goto on_error;
+				}
+				rc = 0;
+			}
 			if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OVERWRITE) &&
 			    (rc != length)) {
 				del_oldest_log();
@@ -393,6 +440,10 @@ static int allocate_new_file(struct fs_file_t *file)
 	++file_ctr;
 	newest = curr_file_num;
 
+#ifdef CONFIG_LOG_BACKEND_FS_DICT_FRAMES
+	rc = write_file_header(file);
+#endif
+
 out:
 	return rc;
 }
@@ -429,10 +480,230 @@ static int del_oldest_log(void)
 BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE),
 	     "Immediate logging is not supported by LOG FS backend.");
 
+#ifdef CONFIG_LOG_BACKEND_FS_DICT_FRAMES
+static int write_file_header(struct fs_file_t *f)
+{
+	static const uint8_t zeros[DICT_FILE_HDR_LEN];
+	uint8_t hdr[DICT_FILE_HDR_LEN];
+	int rc;
+
+	memcpy(hdr, DICT_FILE_MAGIC, 4);
+	hdr[4] = DICT_FILE_VERSION;
+	hdr[5] = 0U;
+	sys_put_le16(DICT_ALIGN, &hdr[6]);
+
+	rc = fs_write(f, hdr, sizeof(hdr));
+	for (size_t pad = DICT_ALIGN - sizeof(hdr);
+	     rc == DICT_FILE_HDR_LEN && pad > 0; pad -= sizeof(zeros)) {
+		rc = fs_write(f, zeros, sizeof(zeros));
+	}
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	return (rc == DICT_FILE_HDR_LEN) ? 0 : -ENOSPC;
+}
+#endif /* CONFIG_LOG_BACKEND_FS_DICT_FRAMES */
+
+#ifdef CONFIG_LOG_BACKEND_FS_DICT_FRAMES
+/* Messages are gathered in the batch, up to the end of the last whole
+ * one, and written as one frame.
+ */
+static uint8_t __aligned(4) batch[DICT_BATCH_SIZE];
+static size_t batch_len;
+static size_t batch_msg_end;
+
+static uint8_t __aligned(4)
+	frame[ROUND_UP(DICT_FRAME_HDR_LEN + DICT_BATCH_SIZE, DICT_ALIGN)];
+
+BUILD_ASSERT(CONFIG_LOG_BACKEND_FS_FILE_SIZE >= DICT_ALIGN + sizeof(frame),
+	     "Log files must hold the file header and a full frame");
+
+#ifdef CONFIG_LOG_BACKEND_FS_DICT_COMPRESS
+#define LZ4_HASH_BITS	10
+#define LZ4_MIN_MATCH	4
+/* The last match starts at least 12 bytes before the end of the input,
+ * and the last 5 bytes are literals.
+ */
+#define LZ4_MF_LIMIT	12
+#define LZ4_LAST_LITERALS 5
+
+static bool lz4_put_len(uint8_t *dst, size_t cap, size_t *out, size_t len)
+{
+	for (; len >= 255U; len -= 255U) {
+		if (*out >= cap) {
+			return false;
+		}
+		dst[(*out)++] = 255U;
+	}
+
+	if (*out >= cap) {
+		return false;
+	}
+	dst[(*out)++] = (uint8_t)len;
+
+	return true;
+}
+
+/* Emits a sequence of literals, followed by a match unless @p mlen is 0 */
+static bool lz4_put_seq(uint8_t *dst, size_t cap, size_t *out,
+			const uint8_t *lit, size_t lit_len, size_t offset,
+			size_t mlen)
+{
+	size_t mcode = (mlen != 0U) ? (mlen - LZ4_MIN_MATCH) : 0U;
+
+	if (*out >= cap) {
+		return false;
+	}
+	dst[(*out)++] = (uint8_t)((MIN(lit_len, 15U) << 4) | MIN(mcode, 15U));
+
+	if (lit_len >= 15U && !lz4_put_len(dst, cap, out, lit_len - 15U)) {
+		return false;
+	}
+
+	if (cap - *out < lit_len) {
+		return false;
+	}
+	memcpy(&dst[*out], lit, lit_len);
+	*out += lit_len;
+
+	if (mlen == 0U) {
+		return true;
+	}
+
+	if (cap - *out < 2U) {
+		return false;
+	}
+	sys_put_le16(offset, &dst[*out]);
+	*out += 2U;
+
+	return mcode < 15U || lz4_put_len(dst, cap, out, mcode - 15U);
+}
+
+/* Compresses in the LZ4 block format, returns the compressed length or 0
+ * if it would exceed @p cap.
+ */
+static size_t lz4_compress(const uint8_t *src, size_t len, uint8_t *dst,
+			   size_t cap)
+{
+	static uint16_t table[BIT(LZ4_HASH_BITS)];
+	size_t limit = (len > LZ4_MF_LIMIT) ? (len - LZ4_MF_LIMIT) : 0U;
+	size_t anchor = 0U, pos = 0U, out = 0U;
+
+	/* Stale entries are harmless, candidates are compared */
+	while (pos < limit) {
+		uint32_t seq = sys_get_le32(&src[pos]);
+		uint32_t h = (seq * 2654435761U) >> (32 - LZ4_HASH_BITS);
+		size_t ref = table[h];
+		size_t mlen = LZ4_MIN_MATCH;
+
+		table[h] = (uint16_t)pos;
+		if (ref >= pos || sys_get_le32(&src[ref]) != seq) {
+			pos++;
+			continue;
+		}
+
+		while (pos + mlen < len - LZ4_LAST_LITERALS &&
+		       src[ref + mlen] == src[pos + mlen]) {
+			mlen++;
+		}
+
+		if (!lz4_put_seq(dst, cap, &out, &src[anchor], pos - anchor,
+				 pos - ref, mlen)) {
+			return 0;
+		}
+
+		pos += mlen;
+		anchor = pos;
+	}
+
+	if (!lz4_put_seq(dst, cap, &out, &src[anchor], len - anchor, 0, 0)) {
+		return 0;
+	}
+
+	return out;
+}
+#endif /* CONFIG_LOG_BACKEND_FS_DICT_COMPRESS */
+
+static void frame_write(size_t len)
+{
+	uint8_t *payload = &frame[DICT_FRAME_HDR_LEN];
+	size_t stored = 0U;
+	size_t total;
+
+#ifdef CONFIG_LOG_BACKEND_FS_DICT_COMPRESS
+	stored = lz4_compress(batch, len, payload, len - 1U);
+#endif
+	if (stored == 0U) {
+		memcpy(payload, batch, len);
+		stored = len;
+	}
+
+	sys_put_le16(stored, &frame[0]);
+	sys_put_le16(len, &frame[2]);
+	total = ROUND_UP(DICT_FRAME_HDR_LEN + stored, DICT_ALIGN);
+	memset(&payload[stored], 0, total - DICT_FRAME_HDR_LEN - stored);
+
+	/* The frame goes whole in a single file, as rotation happens before
+	 * writes which would not fit, and partial writes are undone.
+	 */
+	if (write_log_to_file(frame, total, NULL) == 0 &&
+	    IS_ENABLED(CONFIG_LOG_BACKEND_FS_OVERWRITE)) {
+		/* The oldest log file was deleted to make room */
+		(void)write_log_to_file(frame, total, NULL);
+	}
+}
+
+static void batch_flush(void)
+{
+	if (batch_msg_end == 0U) {
+		return;
+	}
+
+	frame_write(batch_msg_end);
+
+	batch_len -= batch_msg_end;
+	memmove(batch, &batch[batch_msg_end], batch_len);
+	batch_msg_end = 0U;
+}
+
+int write_log_to_batch(uint8_t *data, size_t length, void *ctx)
+{
+	size_t len;
+
+	ARG_UNUSED(ctx);
+
+	if (batch_len == sizeof(batch)) {
+		if (batch_msg_end == 0U) {
+			/* A message larger than a batch is split */
+			batch_msg_end = batch_len;
+		}
+		batch_flush();
+	}
+
+	len = MIN(length, sizeof(batch) - batch_len);
+	memcpy(&batch[batch_len], data, len);
+	batch_len += len;
+
+	return (int)len;
+}
+
+/* Writes the batched messages as a frame */
+void flush_log_batch(void)
+{
+	batch_msg_end = batch_len;
+	batch_flush();
+}
+#endif /* CONFIG_LOG_BACKEND_FS_DICT_FRAMES */
+
 #ifndef CONFIG_LOG_BACKEND_FS_TESTSUITE
 
 static uint8_t __aligned(4) buf[MAX_FLASH_WRITE_SIZE];
-LOG_OUTPUT_DEFINE(log_output, write_log_to_file, buf, MAX_FLASH_WRITE_SIZE);
+LOG_OUTPUT_DEFINE(log_output,
+		  COND_CODE_1(CONFIG_LOG_BACKEND_FS_DICT_FRAMES,
+			      (write_log_to_batch), (write_log_to_file)),
+		  buf, MAX_FLASH_WRITE_SIZE);
 
 static void put(const struct log_backend *const backend,
 		struct log_msg *msg)
@@ -449,6 +720,11 @@ static void panic(struct log_backend const *const backend)
 	/* In case of panic deinitialize backend. It is better to keep
 	 * current data rather than log new and risk of failure.
 	 */
+#ifdef CONFIG_LOG_BACKEND_FS_DICT_FRAMES
+	/* The file system is not used on panic, batched messages are lost */
+	batch_len = 0U;
+	batch_msg_end = 0U;
+#endif
 	log_backend_deactivate(backend);
 }
 
@@ -458,6 +734,9 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 
 	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY)) {
 		log_dict_output_dropped_process(&log_output, cnt);
+#ifdef CONFIG_LOG_BACKEND_FS_DICT_FRAMES
+		batch_msg_end = batch_len;
+#endif
 	} else {
 		log_backend_std_dropped(&log_output, cnt);
 	}
@@ -471,10 +750,27 @@ static void process(const struct log_backend *const backend,
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
 	log_output_func(&log_output, &msg->log, flags);
+
+#ifdef CONFIG_LOG_BACKEND_FS_DICT_FRAMES
+	/* Write a frame when the batch is full, or once there are no more
+	 * messages to gather.
+	 */
+	if (log_data_pending()) {
+		batch_msg_end = batch_len;
+	} else {
+		flush_log_batch();
+	}
+#endif
 }
 
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_DICT_FRAMES) &&
+	    log_type != LOG_OUTPUT_DICT) {
+		/* Framed files only hold dictionary messages */
+		return -ENOTSUP;
+	}
+
 	log_format_current = log_type;
 	return 0;
 }
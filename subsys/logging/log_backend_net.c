@@ -8,6 +8,7 @@
 LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 
 #include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_std.h>
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_msg.h>
@@ -204,6 +205,13 @@ static void process(const struct log_backend *const backend,
 		return;
 	}
 
+	if (IS_ENABLED(CONFIG_LOG_OUTPUT_BATCH)) {
+		/* Several syslog messages are sent in one packet, each ending
+		 * with a line feed.
+		 */
+		flags |= LOG_OUTPUT_FLAG_BATCH;
+	}
+
 	if (!net_init_done && do_net_init() == 0) {
 		net_init_done = true;
 	}
@@ -213,6 +221,15 @@ static void process(const struct log_backend *const backend,
 	log_output_func(&log_output_net, &msg->log, flags);
 }
 
+static void flush(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+
+	if (!panic_mode) {
+		log_backend_std_flush(&log_output_net);
+	}
+}
+
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
 	log_format_current = log_type;
@@ -274,6 +291,7 @@ const struct log_backend_api log_backend_net_api = {
 	 * this can be revisited if needed.
 	 */
 	.put_sync_hexdump = NULL,
+	.flush = IS_ENABLED(CONFIG_LOG_OUTPUT_BATCH) ? flush : NULL,
 	.format_set = IS_ENABLED(CONFIG_LOG1) ? NULL : format_set,
 };
 
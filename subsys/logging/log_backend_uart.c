@@ -106,9 +106,20 @@ static void process(const struct log_backend *const backend,
 
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
+	if (IS_ENABLED(CONFIG_LOG_OUTPUT_BATCH) && !in_panic) {
+		flags |= LOG_OUTPUT_FLAG_BATCH;
+	}
+
 	log_output_func(&log_output_uart, &msg->log, flags);
 }
 
+static void flush(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+
+	log_backend_std_flush(&log_output_uart);
+}
+
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
 	log_format_current = log_type;
@@ -195,6 +206,7 @@ const struct log_backend_api log_backend_uart_api = {
 	.panic = panic,
 	.init = log_backend_uart_init,
 	.dropped = IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE) ? NULL : dropped,
+	.flush = IS_ENABLED(CONFIG_LOG_OUTPUT_BATCH) ? flush : NULL,
 	.format_set = IS_ENABLED(CONFIG_LOG1) ? NULL : format_set,
 };
 
@@ -9,6 +9,7 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_internal.h>
 #include <string.h>
+#include <stdlib.h>
 
 typedef int (*log_backend_cmd_t)(const struct shell *shell,
 				 const struct log_backend *backend,
@@ -429,6 +430,92 @@ static int cmd_log_mem(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+/* Applies a rate limit or sampling setting to the given sources, or to all
+ * of them if none is given.
+ */
+static int rate_set(const struct shell *sh, size_t argc, char **argv,
+		    uint32_t rate, uint32_t burst, bool sample)
+{
+	bool all = argc ? false : true;
+	int cnt = all ? z_log_sources_count() : argc;
+	int err = 0;
+
+	for (int i = 0; i < cnt; i++) {
+		int id = all ? i : module_id_get(argv[i]);
+
+		if (id < 0) {
+			shell_error(sh, "%s: unknown source name.", argv[i]);
+			err = -ENOEXEC;
+			continue;
+		}
+
+		if ((sample ? log_sample_set(CONFIG_LOG_DOMAIN_ID, id, rate) :
+			      log_rate_limit_set(CONFIG_LOG_DOMAIN_ID, id,
+						 rate, burst)) < 0) {
+			shell_error(sh, "Invalid setting");
+			return -ENOEXEC;
+		}
+	}
+
+	return err;
+}
+
+static int cmd_log_rate_limit(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t rate = strtoul(argv[1], NULL, 10);
+	uint32_t burst = strtoul(argv[2], NULL, 10);
+
+	/* Arguments following the burst are interpreted as module names. */
+	return rate_set(sh, argc - 3, &argv[3], rate, burst, false);
+}
+
+static int cmd_log_rate_sample(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t n = strtoul(argv[1], NULL, 10);
+
+	/* Arguments following N are interpreted as module names. */
+	return rate_set(sh, argc - 2, &argv[2], n, 0, true);
+}
+
+static int cmd_log_rate_status(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t rate = 0, burst = 0, n = 1;
+
+	shell_print(sh, "%-40s | rate  | burst | 1 in  | suppressed", "module_name");
+	shell_print(sh, "----------------------------------------------------------"
+		    "--------------------------");
+
+	for (int16_t i = 0; i < z_log_sources_count(); i++) {
+		(void)log_rate_limit_get(CONFIG_LOG_DOMAIN_ID, i, &rate, &burst, &n);
+
+		shell_print(sh, "%-40s | %-5u | %-5u | %-5u | %u",
+			    log_source_name_get(CONFIG_LOG_DOMAIN_ID, i),
+			    rate, burst, n,
+			    log_rate_limit_suppressed_get(CONFIG_LOG_DOMAIN_ID,
+							  i, argc > 1));
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_log_rate,
+	SHELL_CMD_ARG(limit, NULL,
+		  "'log rate limit <msgs/s> <burst> <module_0> .. <module_n>' "
+		  "limits the rate of messages of specified modules (all if no "
+		  "modules specified), 0 msgs/s removes the limit.",
+		  cmd_log_rate_limit, 3, 255),
+	SHELL_CMD_ARG(sample, NULL,
+		  "'log rate sample <n> <module_0> .. <module_n>' keeps one "
+		  "message in n of specified modules (all if no modules "
+		  "specified), 1 keeps all.",
+		  cmd_log_rate_sample, 2, 255),
+	SHELL_CMD_ARG(status, NULL,
+		  "'log rate status [clear]' lists rate limits and suppressed "
+		  "messages, clearing the counts if requested.",
+		  cmd_log_rate_status, 1, 1),
+	SHELL_SUBCMD_SET_END
+);
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_log_backend,
 	SHELL_CMD_ARG(disable, &dsub_module_name,
 		  "'log disable <module_0> .. <module_n>' disables logs in "
@@ -482,6 +569,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 			   1, 0),
 	SHELL_COND_CMD(CONFIG_LOG_MODE_DEFERRED, mem, NULL, "Logger memory usage",
 		       cmd_log_mem),
+	SHELL_COND_CMD(CONFIG_LOG_RATE_LIMIT, rate, &sub_log_rate,
+		       "Rate limiting and sampling of sources", NULL),
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(log, &sub_log_stat, "Commands for controlling logger",
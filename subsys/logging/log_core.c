@@ -71,6 +71,10 @@ BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE),
 	     "Option must be enabled when CONFIG_LOG_MODE_IMMEDIATE is set");
 #endif
 
+BUILD_ASSERT(!(IS_ENABLED(CONFIG_RISCV) && IS_ENABLED(CONFIG_64BIT)) ||
+	     (sizeof(struct log_source_dynamic_data) % 8) == 0,
+	     "Dynamic source data must be a multiple of 8 bytes on RV64");
+
 #ifndef CONFIG_LOG1
 static const log_format_func_t format_table[] = {
 	[LOG_OUTPUT_TEXT] = log_output_msg2_process,
@@ -126,16 +130,30 @@ static struct k_timer log_process_thread_timer;
 static log_timestamp_t dummy_timestamp(void);
 static log_timestamp_get_t timestamp_func = dummy_timestamp;
 
-struct mpsc_pbuf_buffer log_buffer;
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+#define LOG_BUFFER_CNT CONFIG_MP_NUM_CPUS
+#else
+#define LOG_BUFFER_CNT 1
+#endif
+
+/* Words of each buffer */
+#define LOG_BUFFER_WLEN (CONFIG_LOG_BUFFER_SIZE / sizeof(int) / LOG_BUFFER_CNT)
+
+struct mpsc_pbuf_buffer log_buffer[LOG_BUFFER_CNT];
 static uint32_t __aligned(Z_LOG_MSG2_ALIGNMENT)
-	buf32[CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+	buf32[LOG_BUFFER_CNT * LOG_BUFFER_WLEN];
+
+#if LOG_BUFFER_CNT > 1
+/* Message claimed from each buffer, not processed yet */
+static union log_msg2_generic *log_buffer_head[LOG_BUFFER_CNT];
+#endif
 
 static void notify_drop(const struct mpsc_pbuf_buffer *buffer,
 			const union mpsc_pbuf_generic *item);
 
 static const struct mpsc_pbuf_buffer_config mpsc_config = {
 	.buf = (uint32_t *)buf32,
-	.size = ARRAY_SIZE(buf32),
+	.size = LOG_BUFFER_WLEN,
 	.notify_drop = notify_drop,
 	.get_wlen = log_msg2_generic_get_wlen,
 	.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?
@@ -875,6 +893,17 @@ void dropped_notify(void)
 	}
 }
 
+static void flush_notify(void)
+{
+	for (int i = 0; i < log_backend_count_get(); i++) {
+		struct log_backend const *backend = log_backend_get(i);
+
+		if (log_backend_is_active(backend)) {
+			log_backend_flush(backend);
+		}
+	}
+}
+
 union log_msgs get_msg(void)
 {
 	union log_msgs msg;
@@ -917,6 +946,7 @@ void z_log_notify_backend_enabled(void)
 bool z_impl_log_process(bool bypass)
 {
 	union log_msgs msg;
+	bool pending;
 
 	if (!backend_attached && !bypass) {
 		return false;
@@ -934,7 +964,13 @@ bool z_impl_log_process(bool bypass)
 		dropped_notify();
 	}
 
-	return next_pending();
+	pending = next_pending();
+	if (IS_ENABLED(CONFIG_LOG_OUTPUT_BATCH) && !bypass && !pending) {
+		/* Backends write what they gathered once the queue is drained */
+		flush_notify();
+	}
+
+	return pending;
 }
 
 #ifdef CONFIG_USERSPACE
@@ -1289,12 +1325,40 @@ void log_hexdump_from_user(struct log_msg_ids src_level, const char *metadata,
 
 void z_log_msg2_init(void)
 {
-	mpsc_pbuf_init(&log_buffer, &mpsc_config);
+	struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		config.buf = &buf32[i * LOG_BUFFER_WLEN];
+		mpsc_pbuf_init(&log_buffer[i], &config);
+#if LOG_BUFFER_CNT > 1
+		log_buffer_head[i] = NULL;
+#endif
+	}
+}
+
+/* Buffer a message is allocated from */
+static inline struct mpsc_pbuf_buffer *msg_buffer(const void *msg)
+{
+	if (LOG_BUFFER_CNT == 1) {
+		return &log_buffer[0];
+	}
+
+	return &log_buffer[((const uint32_t *)msg - buf32) / LOG_BUFFER_WLEN];
 }
 
 struct log_msg2 *z_log_msg2_alloc(uint32_t wlen)
 {
-	return (struct log_msg2 *)mpsc_pbuf_alloc(&log_buffer, wlen,
+	struct mpsc_pbuf_buffer *buffer = &log_buffer[0];
+
+#if LOG_BUFFER_CNT > 1
+	/* The thread may migrate once the CPU is known, which only costs
+	 * some contention as messages are committed to the buffer they
+	 * were allocated from.
+	 */
+	buffer = &log_buffer[arch_curr_cpu()->id];
+#endif
+
+	return (struct log_msg2 *)mpsc_pbuf_alloc(buffer, wlen,
 				K_MSEC(CONFIG_LOG_BLOCK_IN_THREAD_TIMEOUT_MS));
 }
 
@@ -1312,24 +1376,81 @@ void z_log_msg2_commit(struct log_msg2 *msg)
 		return;
 	}
 
-	mpsc_pbuf_commit(&log_buffer, (union mpsc_pbuf_generic *)msg);
+	mpsc_pbuf_commit(msg_buffer(msg), (union mpsc_pbuf_generic *)msg);
 	z_log_msg_post_finalize();
 }
 
+#if LOG_BUFFER_CNT > 1
+/* Timestamps wrap around */
+static inline bool timestamp_before(log_timestamp_t a, log_timestamp_t b)
+{
+	return (log_timestamp_t)(a - b) > ((log_timestamp_t)-1 / 2);
+}
+
+/* Merges the buffers in timestamp order: the oldest message claimed
+ * from each buffer is held until it is the oldest of all. Only one
+ * message is claimed from a buffer at a time, so they are freed in the
+ * order they were claimed.
+ */
+static union log_msg2_generic *merge_claim(void)
+{
+	union log_msg2_generic *msg;
+	int first = -1;
+
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		if (log_buffer_head[i] == NULL) {
+			log_buffer_head[i] = (union log_msg2_generic *)
+				mpsc_pbuf_claim(&log_buffer[i]);
+		}
+
+		if (log_buffer_head[i] != NULL &&
+		    (first < 0 ||
+		     timestamp_before(log_buffer_head[i]->log.hdr.timestamp,
+				      log_buffer_head[first]->log.hdr.timestamp))) {
+			first = i;
+		}
+	}
+
+	if (first < 0) {
+		return NULL;
+	}
+
+	msg = log_buffer_head[first];
+	log_buffer_head[first] = NULL;
+
+	return msg;
+}
+#endif
+
 union log_msg2_generic *z_log_msg2_claim(void)
 {
-	return (union log_msg2_generic *)mpsc_pbuf_claim(&log_buffer);
+#if LOG_BUFFER_CNT > 1
+	return merge_claim();
+#else
+	return (union log_msg2_generic *)mpsc_pbuf_claim(&log_buffer[0]);
+#endif
 }
 
 void z_log_msg2_free(union log_msg2_generic *msg)
 {
-	mpsc_pbuf_free(&log_buffer, (union mpsc_pbuf_generic *)msg);
+	mpsc_pbuf_free(msg_buffer(msg), (union mpsc_pbuf_generic *)msg);
 }
 
 
 bool z_log_msg2_pending(void)
 {
-	return mpsc_pbuf_is_pending(&log_buffer);
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+#if LOG_BUFFER_CNT > 1
+		if (log_buffer_head[i] != NULL) {
+			return true;
+		}
+#endif
+		if (mpsc_pbuf_is_pending(&log_buffer[i])) {
+			return true;
+		}
+	}
+
+	return false;
 }
 
 const char *z_log_get_tag(void)
@@ -1376,7 +1497,15 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 		return 0;
 	}
 
-	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
+	*buf_size = 0;
+	*usage = 0;
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		uint32_t size, now;
+
+		mpsc_pbuf_get_utilization(&log_buffer[i], &size, &now);
+		*buf_size += size;
+		*usage += now;
+	}
 
 	return 0;
 }
@@ -1394,7 +1523,21 @@ int log_mem_get_max_usage(uint32_t *max)
 		return 0;
 	}
 
-	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+	/* Sum of the maximum of each buffer, which may not have been reached
+	 * at the same time.
+	 */
+	*max = 0;
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		uint32_t buf_max;
+		int err = mpsc_pbuf_get_max_utilization(&log_buffer[i], &buf_max);
+
+		if (err != 0) {
+			return err;
+		}
+		*max += buf_max;
+	}
+
+	return 0;
 }
 
 static void log_process_thread_timer_expiry_fn(struct k_timer *timer)
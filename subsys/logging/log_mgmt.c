@@ -200,6 +200,154 @@ void log_backend_disable(struct log_backend const *const backend)
 	backend_filter_set(backend, LOG_LEVEL_NONE);
 }
 
+#ifdef CONFIG_LOG_RATE_LIMIT
+static struct k_spinlock rate_limit_lock;
+
+static struct log_source_rate_limit *rate_limit_get(uint32_t domain_id,
+						    int16_t source_id)
+{
+	if (domain_id != CONFIG_LOG_DOMAIN_ID || source_id < 0 ||
+	    source_id >= (int16_t)z_log_sources_count()) {
+		return NULL;
+	}
+
+	return &__log_dynamic_start[source_id].rate_limit;
+}
+
+bool z_log_rate_limit(struct log_source_dynamic_data *data)
+{
+	struct log_source_rate_limit *rl = &data->rate_limit;
+	k_spinlock_key_t key = k_spin_lock(&rate_limit_lock);
+	bool pass = true;
+
+	if (rl->sample > 1U) {
+		pass = (rl->count == 0U);
+		rl->count = (rl->count + 1U) % rl->sample;
+	}
+
+	if (pass && rl->rate != 0U) {
+		uint32_t now = k_uptime_get_32();
+		uint64_t tokens = rl->tokens + (uint64_t)(now - rl->last) * rl->rate;
+
+		rl->tokens = MIN(tokens, rl->burst * 1000U);
+		rl->last = now;
+
+		if (rl->tokens >= 1000U) {
+			rl->tokens -= 1000U;
+		} else {
+			pass = false;
+		}
+	}
+
+	if (!pass) {
+		rl->suppressed++;
+	}
+
+	k_spin_unlock(&rate_limit_lock, key);
+
+	return pass;
+}
+#endif /* CONFIG_LOG_RATE_LIMIT */
+
+int log_rate_limit_set(uint32_t domain_id, int16_t source_id,
+		       uint32_t rate, uint32_t burst)
+{
+#ifdef CONFIG_LOG_RATE_LIMIT
+	struct log_source_rate_limit *rl = rate_limit_get(domain_id, source_id);
+	k_spinlock_key_t key;
+
+	if (rl == NULL || rate > UINT16_MAX || burst > UINT16_MAX ||
+	    (rate != 0U && burst == 0U)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&rate_limit_lock);
+	rl->burst = burst;
+	rl->tokens = burst * 1000U;
+	rl->last = k_uptime_get_32();
+	rl->rate = rate;
+	k_spin_unlock(&rate_limit_lock, key);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+int log_sample_set(uint32_t domain_id, int16_t source_id, uint32_t n)
+{
+#ifdef CONFIG_LOG_RATE_LIMIT
+	struct log_source_rate_limit *rl = rate_limit_get(domain_id, source_id);
+	k_spinlock_key_t key;
+
+	if (rl == NULL || n > UINT16_MAX) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&rate_limit_lock);
+	rl->count = 0U;
+	rl->sample = n;
+	k_spin_unlock(&rate_limit_lock, key);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+int log_rate_limit_get(uint32_t domain_id, int16_t source_id,
+		       uint32_t *rate, uint32_t *burst, uint32_t *n)
+{
+#ifdef CONFIG_LOG_RATE_LIMIT
+	struct log_source_rate_limit *rl = rate_limit_get(domain_id, source_id);
+
+	if (rl == NULL) {
+		return -EINVAL;
+	}
+
+	if (rate != NULL) {
+		*rate = rl->rate;
+	}
+
+	if (burst != NULL) {
+		*burst = rl->burst;
+	}
+
+	if (n != NULL) {
+		*n = MAX(rl->sample, 1U);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+uint32_t log_rate_limit_suppressed_get(uint32_t domain_id, int16_t source_id,
+				       bool clear)
+{
+#ifdef CONFIG_LOG_RATE_LIMIT
+	struct log_source_rate_limit *rl = rate_limit_get(domain_id, source_id);
+	k_spinlock_key_t key;
+	uint32_t cnt;
+
+	if (rl == NULL) {
+		return 0;
+	}
+
+	key = k_spin_lock(&rate_limit_lock);
+	cnt = rl->suppressed;
+	if (clear) {
+		rl->suppressed = 0U;
+	}
+	k_spin_unlock(&rate_limit_lock, key);
+
+	return cnt;
+#else
+	return 0;
+#endif
+}
+
 uint32_t log_filter_get(struct log_backend const *const backend,
 			uint32_t domain_id, int16_t source_id, bool runtime)
 {
@@ -12,6 +12,7 @@
 #include <ctype.h>
 #include <time.h>
 #include <stdio.h>
+#include <string.h>
 #include <stdbool.h>
 
 #define LOG_COLOR_CODE_DEFAULT "\x1B[0m"
@@ -111,6 +112,8 @@ static int level_to_rfc5424_severity(uint32_t level)
 	return ret;
 }
 
+static void overflow_flush(const struct log_output *output);
+
 static int out_func(int c, void *ctx)
 {
 	const struct log_output *out_ctx = (const struct log_output *)ctx;
@@ -126,7 +129,7 @@ static int out_func(int c, void *ctx)
 	}
 
 	if (out_ctx->control_block->offset == out_ctx->size) {
-		log_output_flush(out_ctx);
+		overflow_flush(out_ctx);
 	}
 
 	idx = atomic_inc(&out_ctx->control_block->offset);
@@ -180,6 +183,42 @@ void log_output_flush(const struct log_output *output)
 		     output->control_block->ctx);
 
 	output->control_block->offset = 0;
+#ifdef CONFIG_LOG_OUTPUT_BATCH
+	output->control_block->batch_end = 0;
+#endif
+}
+
+/* Writes the whole messages gathered in the buffer, keeping the one being
+ * formatted, or everything if the buffer only holds part of a message.
+ */
+static void overflow_flush(const struct log_output *output)
+{
+#ifdef CONFIG_LOG_OUTPUT_BATCH
+	struct log_output_control_block *cb = output->control_block;
+	size_t done = cb->batch_end;
+
+	if (done != 0) {
+		buffer_write(output->func, output->buf, done, cb->ctx);
+		memmove(output->buf, &output->buf[done], cb->offset - done);
+		cb->offset -= done;
+		cb->batch_end = 0;
+		return;
+	}
+#endif
+
+	log_output_flush(output);
+}
+
+static void msg_end(const struct log_output *output, uint32_t flags)
+{
+#ifdef CONFIG_LOG_OUTPUT_BATCH
+	if (flags & LOG_OUTPUT_FLAG_BATCH) {
+		output->control_block->batch_end = output->control_block->offset;
+		return;
+	}
+#endif
+
+	log_output_flush(output);
 }
 
 static inline bool is_leap_year(uint32_t year)
@@ -706,7 +745,7 @@ void log_output_msg2_process(const struct log_output *output,
 		postfix_print(output, flags, level);
 	}
 
-	log_output_flush(output);
+	msg_end(output, flags);
 }
 
 static bool ends_with_newline(const char *fmt)
@@ -810,6 +849,12 @@ void log_output_dropped_process(const struct log_output *output, uint32_t cnt)
 	cnt = MIN(cnt, 9999);
 	len = snprintk(buf, sizeof(buf), "%d", cnt);
 
+	if (IS_ENABLED(CONFIG_LOG_OUTPUT_BATCH) &&
+	    output->control_block->offset != 0) {
+		/* Keep the order with the messages gathered before */
+		log_output_flush(output);
+	}
+
 	buffer_write(outf, (uint8_t *)prefix, sizeof(prefix) - 1,
 		     output->control_block->ctx);
 	buffer_write(outf, buf, len, output->control_block->ctx);
@@ -30,6 +30,7 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include <zephyr/net/websocket.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/capture.h>
+#include <zephyr/stats/stats_perf.h>
 
 #if defined(CONFIG_NET_LLDP)
 #include <zephyr/net/lldp.h>
@@ -150,8 +151,16 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 	return NET_DROP;
 }
 
+#if defined(CONFIG_STATS_PERF_NET_RX)
+STATS_PERF_DEFINE(perf_net_rx);
+#endif
+
 static void processing_data(struct net_pkt *pkt, bool is_loopback)
 {
+#if defined(CONFIG_STATS_PERF_NET_RX)
+	uint32_t start = STATS_PERF_START();
+#endif
+
 again:
 	switch (process_data(pkt, is_loopback)) {
 	case NET_CONTINUE:
@@ -174,6 +183,10 @@ again:
 		net_pkt_unref(pkt);
 		break;
 	}
+
+#if defined(CONFIG_STATS_PERF_NET_RX)
+	STATS_PERF_END(perf_net_rx, start);
+#endif
 }
 
 /* Things to setup after we are able to RX and TX */
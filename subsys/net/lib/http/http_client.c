@@ -25,6 +25,7 @@ LOG_MODULE_REGISTER(net_http, CONFIG_NET_HTTP_LOG_LEVEL);
 #include <zephyr/net/http_client.h>
 
 #include "net_private.h"
+#include "http_client_internal.h"
 
 #define HTTP_CONTENT_LEN_SIZE 11
 #define MAX_SEND_BUF_LEN 192
@@ -344,6 +345,13 @@ static int on_message_complete(struct http_parser *parser)
 
 	req->internal.response.message_complete = 1;
 
+	/* On a persistent connection the next response may follow in the
+	 * same segment, stop here so that it is not consumed by this request.
+	 */
+	if (req->internal.persistent) {
+		http_parser_pause(parser, 1);
+	}
+
 	return 0;
 }
 
@@ -392,16 +400,53 @@ static void http_client_init_parser(struct http_parser *parser,
 	settings->on_url = on_url;
 }
 
-static int http_wait_data(int sock, struct http_request *req)
+static int http_carry_take(struct http_client_carry *carry, uint8_t *buf,
+			   size_t len)
+{
+	len = MIN(len, carry->len);
+
+	memcpy(buf, carry->buf, len);
+	carry->len -= len;
+	memmove(carry->buf, carry->buf + len, carry->len);
+
+	return (int)len;
+}
+
+static int http_carry_put(struct http_client_carry *carry, const uint8_t *buf,
+			  size_t len)
+{
+	if (carry->len + len > carry->max_len) {
+		NET_DBG("No room for %zd bytes of pipelined data", len);
+		return -ENOBUFS;
+	}
+
+	/* Data not yet handed out stays behind the returned data */
+	memmove(carry->buf + len, carry->buf, carry->len);
+	memcpy(carry->buf, buf, len);
+	carry->len += len;
+
+	return 0;
+}
+
+static int http_wait_data(int sock, struct http_request *req,
+			  struct http_client_carry *carry)
 {
 	int total_received = 0;
 	size_t offset = 0;
 	int received, ret;
 
 	do {
-		received = zsock_recv(sock, req->internal.response.recv_buf + offset,
-				      req->internal.response.recv_buf_len - offset,
-				      0);
+		if (carry && carry->len > 0) {
+			received = http_carry_take(
+				carry, req->internal.response.recv_buf + offset,
+				req->internal.response.recv_buf_len - offset);
+		} else {
+			received = zsock_recv(sock,
+					      req->internal.response.recv_buf + offset,
+					      req->internal.response.recv_buf_len - offset,
+					      0);
+		}
+
 		if (received == 0) {
 			/* Connection closed */
 			LOG_DBG("Connection closed");
@@ -434,13 +479,37 @@ static int http_wait_data(int sock, struct http_request *req)
 			ret = -errno;
 			break;
 		} else {
+			size_t parsed;
+
 			req->internal.response.data_len += received;
 
-			(void)http_parser_execute(
+			parsed = http_parser_execute(
 				&req->internal.parser,
 				&req->internal.parser_settings,
 				req->internal.response.recv_buf + offset,
 				received);
+
+			if (carry && req->internal.response.message_complete &&
+			    parsed < received) {
+				/* Start of the next pipelined response */
+				ret = http_carry_put(
+					carry,
+					req->internal.response.recv_buf + offset + parsed,
+					received - parsed);
+				if (ret < 0) {
+					break;
+				}
+
+				req->internal.response.data_len -= received - parsed;
+				received = parsed;
+
+				if (req->internal.response.body_frag_start) {
+					req->internal.response.body_frag_len =
+						req->internal.response.data_len -
+						(req->internal.response.body_frag_start -
+						 req->internal.response.recv_buf);
+				}
+			}
 		}
 
 		total_received += received;
@@ -499,15 +568,15 @@ static void http_timeout(struct k_work *work)
 	(void)zsock_shutdown(data->sock, ZSOCK_SHUT_RD);
 }
 
-int http_client_req(int sock, struct http_request *req,
-		    int32_t timeout, void *user_data)
+int http_client_send_req(int sock, struct http_request *req,
+			 int32_t timeout, void *user_data)
 {
 	/* Utilize the network usage by sending data in bigger blocks */
 	char send_buf[MAX_SEND_BUF_LEN];
 	const size_t send_buf_max_len = sizeof(send_buf);
 	size_t send_buf_pos = 0;
 	int total_sent = 0;
-	int ret, total_recv, i;
+	int ret, i;
 	const char *method;
 
 	if (sock < 0 || req == NULL || req->response == NULL ||
@@ -687,6 +756,17 @@ int http_client_req(int sock, struct http_request *req,
 
 	NET_DBG("Sent %d bytes", total_sent);
 
+	return total_sent;
+
+out:
+	return ret;
+}
+
+int http_client_recv_rsp(int sock, struct http_request *req,
+			 struct http_client_carry *carry)
+{
+	int total_recv;
+
 	http_client_init_parser(&req->internal.parser,
 				&req->internal.parser_settings);
 
@@ -698,7 +778,7 @@ int http_client_req(int sock, struct http_request *req,
 	}
 
 	/* Request is sent, now wait data to be received */
-	total_recv = http_wait_data(sock, req);
+	total_recv = http_wait_data(sock, req, carry);
 	if (total_recv < 0) {
 		NET_DBG("Wait data failure (%d)", total_recv);
 	} else {
@@ -710,8 +790,56 @@ int http_client_req(int sock, struct http_request *req,
 		(void)k_work_cancel_delayable(&req->internal.work);
 	}
 
+	return total_recv;
+}
+
+int http_client_req(int sock, struct http_request *req,
+		    int32_t timeout, void *user_data)
+{
+	int total_sent;
+
+	if (req != NULL) {
+		req->internal.persistent = false;
+	}
+
+	total_sent = http_client_send_req(sock, req, timeout, user_data);
+	if (total_sent < 0) {
+		return total_sent;
+	}
+
+	(void)http_client_recv_rsp(sock, req, NULL);
+
 	return total_sent;
+}
 
-out:
-	return ret;
+int http_client_send_chunk(int sock, const void *data, size_t len)
+{
+	/* Chunk size in hex, CRLF, and the CRLF of the last chunk */
+	char hdr[sizeof("ffffffff" HTTP_CRLF)];
+	int hdr_len;
+	int ret;
+
+	hdr_len = snprintk(hdr, sizeof(hdr), "%x" HTTP_CRLF, (unsigned int)len);
+	if (hdr_len <= 0 || hdr_len >= sizeof(hdr)) {
+		return -EINVAL;
+	}
+
+	ret = sendall(sock, hdr, hdr_len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (len > 0) {
+		ret = sendall(sock, data, len);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	ret = sendall(sock, HTTP_CRLF, sizeof(HTTP_CRLF) - 1);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return hdr_len + (int)len + sizeof(HTTP_CRLF) - 1;
 }
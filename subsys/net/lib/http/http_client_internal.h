@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _HTTP_CLIENT_INTERNAL_H_
+#define _HTTP_CLIENT_INTERNAL_H_
+
+#include <zephyr/net/http_client.h>
+
+/* Bytes received past the end of a response on a persistent connection,
+ * i.e. the beginning of the next pipelined response.
+ */
+struct http_client_carry {
+	uint8_t *buf;
+	size_t len;
+	size_t max_len;
+};
+
+/* Send the request line, headers and payload of a request.
+ * Returns the amount of data sent or <0 on error.
+ */
+int http_client_send_req(int sock, struct http_request *req,
+			 int32_t timeout, void *user_data);
+
+/* Receive and parse the response to a request that was sent with
+ * http_client_send_req(). If carry is set, data past the end of the
+ * response is stored there and is consumed first by the next call.
+ */
+int http_client_recv_rsp(int sock, struct http_request *req,
+			 struct http_client_carry *carry);
+
+#endif /* _HTTP_CLIENT_INTERNAL_H_ */
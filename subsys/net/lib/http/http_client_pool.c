@@ -0,0 +1,380 @@
+/** @file
+ * @brief HTTP client connection pool
+ *
+ * Keeps HTTP client connections open between requests so that the TCP
+ * and TLS handshakes are done only once per server.
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_http, CONFIG_NET_HTTP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <errno.h>
+#include <stdbool.h>
+
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/tls_credentials.h>
+#include <zephyr/net/http_client.h>
+
+#include "net_private.h"
+#include "http_client_internal.h"
+
+#define IDLE_TIMEOUT_MS (CONFIG_HTTP_CLIENT_POOL_IDLE_TIMEOUT * MSEC_PER_SEC)
+
+struct http_client_conn {
+	char host[CONFIG_HTTP_CLIENT_POOL_HOST_LEN];
+	char port[sizeof("65535")];
+	int sec_tag;
+	int sock;
+	int64_t last_used;
+	bool in_use;
+	struct http_client_carry carry;
+	uint8_t carry_buf[CONFIG_HTTP_CLIENT_POOL_CARRY_SIZE];
+};
+
+static struct http_client_conn conns[CONFIG_HTTP_CLIENT_POOL_SIZE] = {
+	[0 ... (CONFIG_HTTP_CLIENT_POOL_SIZE - 1)] = {
+		.sock = -1,
+	},
+};
+
+static K_MUTEX_DEFINE(pool_lock);
+
+static bool conn_matches(struct http_client_conn *conn,
+			 const struct http_client_endpoint *ep)
+{
+	return conn->sec_tag == (ep->sec_tag < 0 ? -1 : ep->sec_tag) &&
+	       strcmp(conn->host, ep->host) == 0 &&
+	       strcmp(conn->port, ep->port) == 0;
+}
+
+/* An idle connection must not have anything to read. If it has, the
+ * server either closed it or sent something we cannot match to a request.
+ */
+static bool conn_is_alive(struct http_client_conn *conn)
+{
+	struct zsock_pollfd fds = {
+		.fd = conn->sock,
+		.events = ZSOCK_POLLIN,
+	};
+
+	if (conn->carry.len > 0) {
+		return false;
+	}
+
+	return zsock_poll(&fds, 1, 0) == 0;
+}
+
+static void conn_close(struct http_client_conn *conn)
+{
+	NET_DBG("Closing connection %d to %s:%s", conn->sock,
+		log_strdup(conn->host), log_strdup(conn->port));
+
+	(void)zsock_close(conn->sock);
+	conn->sock = -1;
+	conn->carry.len = 0;
+}
+
+static int conn_open(struct http_client_conn *conn)
+{
+	struct zsock_addrinfo hints = {
+		.ai_socktype = SOCK_STREAM,
+	};
+	struct zsock_addrinfo *res;
+	int proto = IPPROTO_TCP;
+	int sock, ret;
+
+	ret = zsock_getaddrinfo(conn->host, conn->port, &hints, &res);
+	if (ret != 0) {
+		NET_DBG("Cannot resolve %s (%d)", log_strdup(conn->host), ret);
+		return -EHOSTUNREACH;
+	}
+
+	if (conn->sec_tag >= 0) {
+		if (!IS_ENABLED(CONFIG_NET_SOCKETS_SOCKOPT_TLS)) {
+			ret = -EPROTONOSUPPORT;
+			goto out;
+		}
+
+		proto = IPPROTO_TLS_1_2;
+	}
+
+	sock = zsock_socket(res->ai_family, SOCK_STREAM, proto);
+	if (sock < 0) {
+		ret = -errno;
+		goto out;
+	}
+
+#if defined(CONFIG_NET_SOCKETS_SOCKOPT_TLS)
+	if (conn->sec_tag >= 0) {
+		sec_tag_t sec_tag_list[] = { conn->sec_tag };
+
+		ret = zsock_setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST,
+				       sec_tag_list, sizeof(sec_tag_list));
+		if (ret < 0) {
+			ret = -errno;
+			goto close;
+		}
+
+		ret = zsock_setsockopt(sock, SOL_TLS, TLS_HOSTNAME,
+				       conn->host, strlen(conn->host) + 1);
+		if (ret < 0) {
+			ret = -errno;
+			goto close;
+		}
+	}
+#endif
+
+	ret = zsock_connect(sock, res->ai_addr, res->ai_addrlen);
+	if (ret < 0) {
+		ret = -errno;
+		goto close;
+	}
+
+	NET_DBG("New connection %d to %s:%s", sock, log_strdup(conn->host),
+		log_strdup(conn->port));
+
+	conn->sock = sock;
+	conn->carry.len = 0;
+	ret = 0;
+	goto out;
+
+close:
+	(void)zsock_close(sock);
+out:
+	zsock_freeaddrinfo(res);
+
+	return ret;
+}
+
+static int pool_acquire(const struct http_client_endpoint *ep,
+			struct http_client_conn **result)
+{
+	struct http_client_conn *conn = NULL;
+	int64_t now;
+	int ret;
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	now = k_uptime_get();
+
+	for (int i = 0; i < ARRAY_SIZE(conns); i++) {
+		struct http_client_conn *c = &conns[i];
+
+		if (c->in_use || c->sock < 0) {
+			continue;
+		}
+
+		if (now - c->last_used > IDLE_TIMEOUT_MS) {
+			conn_close(c);
+			continue;
+		}
+
+		if (conn_matches(c, ep)) {
+			if (conn_is_alive(c)) {
+				c->in_use = true;
+				k_mutex_unlock(&pool_lock);
+
+				NET_DBG("Reusing connection %d", c->sock);
+				*result = c;
+				return 0;
+			}
+
+			conn_close(c);
+		}
+	}
+
+	/* No idle connection to reuse, take a free slot or evict the
+	 * least recently used idle connection.
+	 */
+	for (int i = 0; i < ARRAY_SIZE(conns); i++) {
+		struct http_client_conn *c = &conns[i];
+
+		if (c->in_use) {
+			continue;
+		}
+
+		if (c->sock < 0) {
+			conn = c;
+			break;
+		}
+
+		if (!conn || c->last_used < conn->last_used) {
+			conn = c;
+		}
+	}
+
+	if (!conn) {
+		k_mutex_unlock(&pool_lock);
+		return -EAGAIN;
+	}
+
+	if (conn->sock >= 0) {
+		conn_close(conn);
+	}
+
+	strncpy(conn->host, ep->host, sizeof(conn->host) - 1);
+	conn->host[sizeof(conn->host) - 1] = '\0';
+	strncpy(conn->port, ep->port, sizeof(conn->port) - 1);
+	conn->port[sizeof(conn->port) - 1] = '\0';
+	conn->sec_tag = ep->sec_tag < 0 ? -1 : ep->sec_tag;
+	conn->carry.buf = conn->carry_buf;
+	conn->carry.max_len = sizeof(conn->carry_buf);
+	conn->in_use = true;
+
+	k_mutex_unlock(&pool_lock);
+
+	/* Connecting may take long, do it without holding the pool */
+	ret = conn_open(conn);
+	if (ret < 0) {
+		k_mutex_lock(&pool_lock, K_FOREVER);
+		conn->in_use = false;
+		k_mutex_unlock(&pool_lock);
+
+		return ret;
+	}
+
+	*result = conn;
+
+	return 0;
+}
+
+static void pool_release(struct http_client_conn *conn, bool keep)
+{
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	if (!keep || conn->carry.len > 0) {
+		conn_close(conn);
+	}
+
+	conn->last_used = k_uptime_get();
+	conn->in_use = false;
+
+	k_mutex_unlock(&pool_lock);
+}
+
+static bool method_is_idempotent(enum http_method method)
+{
+	switch (method) {
+	case HTTP_GET:
+	case HTTP_HEAD:
+	case HTTP_OPTIONS:
+	case HTTP_PUT:
+	case HTTP_DELETE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool response_keeps_conn(struct http_request *req)
+{
+	/* Body of a 5xx response is skipped by the parser, so the stream
+	 * position is unknown after it.
+	 */
+	return req->internal.response.message_complete &&
+	       req->internal.response.http_status_code < 500 &&
+	       http_should_keep_alive(&req->internal.parser);
+}
+
+int http_client_pool_req_pipelined(const struct http_client_endpoint *ep,
+				   struct http_request **reqs, size_t count,
+				   int32_t timeout, void *user_data)
+{
+	struct http_client_conn *conn;
+	int total_sent = 0;
+	bool keep = true;
+	int ret;
+
+	if (ep == NULL || ep->host == NULL || ep->port == NULL ||
+	    reqs == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	if (strlen(ep->host) >= CONFIG_HTTP_CLIENT_POOL_HOST_LEN) {
+		return -ENAMETOOLONG;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (count > 1 && !method_is_idempotent(reqs[i]->method)) {
+			NET_DBG("Cannot pipeline %s request",
+				http_method_str(reqs[i]->method));
+			return -EINVAL;
+		}
+
+		if (reqs[i]->host == NULL) {
+			reqs[i]->host = ep->host;
+		}
+
+		reqs[i]->internal.persistent = true;
+	}
+
+	ret = pool_acquire(ep, &conn);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		ret = http_client_send_req(conn->sock, reqs[i], timeout,
+					   user_data);
+		if (ret < 0) {
+			keep = false;
+			goto out;
+		}
+
+		total_sent += ret;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		ret = http_client_recv_rsp(conn->sock, reqs[i], &conn->carry);
+		if (ret < 0) {
+			keep = false;
+			goto out;
+		}
+
+		if (!response_keeps_conn(reqs[i])) {
+			keep = false;
+
+			if (!reqs[i]->internal.response.message_complete ||
+			    i < count - 1) {
+				ret = -ECONNABORTED;
+				goto out;
+			}
+		}
+	}
+
+	ret = total_sent;
+
+out:
+	pool_release(conn, keep);
+
+	return ret;
+}
+
+int http_client_pool_req(const struct http_client_endpoint *ep,
+			 struct http_request *req,
+			 int32_t timeout, void *user_data)
+{
+	return http_client_pool_req_pipelined(ep, &req, 1, timeout, user_data);
+}
+
+void http_client_pool_flush(void)
+{
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(conns); i++) {
+		if (!conns[i].in_use && conns[i].sock >= 0) {
+			conn_close(&conns[i]);
+		}
+	}
+
+	k_mutex_unlock(&pool_lock);
+}
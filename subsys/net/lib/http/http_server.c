@@ -0,0 +1,768 @@
+/** @file
+ * @brief HTTP server
+ *
+ * HTTP/1.1 server serving resources defined with the
+ * HTTP_RESOURCE_*_DEFINE() macros from a fixed pool of worker threads.
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <errno.h>
+#include <stdbool.h>
+
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http_server.h>
+
+#if defined(CONFIG_FILE_SYSTEM)
+#include <zephyr/fs/fs.h>
+#endif
+
+#include "net_private.h"
+
+#define HTTP_CRLF "\r\n"
+
+/* How often an idle keep-alive connection checks if other clients are
+ * waiting for a worker or if the server is being stopped.
+ */
+#define IDLE_CHECK_INTERVAL_MS 100
+
+#define MAX_LISTEN_SOCKS 2
+
+struct http_server_conn {
+	/** Request information given to dynamic resources */
+	struct http_server_req req;
+
+	struct http_parser parser;
+
+	/** Number of bytes of recv_buf fed to the parser */
+	size_t parsed;
+	/** Number of bytes in recv_buf */
+	size_t recv_len;
+
+	bool complete : 1;
+	bool bad_request : 1;
+	bool chunked : 1;
+
+	char url[CONFIG_HTTP_SERVER_MAX_URL_LEN + 1];
+	size_t url_len;
+
+	uint8_t recv_buf[CONFIG_HTTP_SERVER_RECV_BUF_SIZE];
+	uint8_t send_buf[CONFIG_HTTP_SERVER_SEND_BUF_SIZE];
+};
+
+static struct http_server_conn conns[CONFIG_HTTP_SERVER_WORKERS];
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, CONFIG_HTTP_SERVER_WORKERS,
+				   CONFIG_HTTP_SERVER_WORKER_STACK_SIZE);
+static struct k_thread worker_threads[CONFIG_HTTP_SERVER_WORKERS];
+
+static K_THREAD_STACK_DEFINE(listener_stack, CONFIG_HTTP_SERVER_LISTENER_STACK_SIZE);
+static struct k_thread listener_thread;
+
+/* Accepted connections waiting for a worker */
+K_MSGQ_DEFINE(http_server_accept_q, sizeof(int), CONFIG_HTTP_SERVER_BACKLOG, 4);
+
+static int listen_socks[MAX_LISTEN_SOCKS];
+static int listen_cnt;
+static bool running;
+
+static const char *status_str(int status)
+{
+	switch (status) {
+	case 200:
+		return "OK";
+	case 400:
+		return "Bad Request";
+	case 404:
+		return "Not Found";
+	case 405:
+		return "Method Not Allowed";
+	case 413:
+		return "Payload Too Large";
+	case 503:
+		return "Service Unavailable";
+	default:
+		return "Internal Server Error";
+	}
+}
+
+static int sendall(int sock, const void *buf, size_t len)
+{
+	while (len) {
+		ssize_t out_len = zsock_send(sock, buf, len, 0);
+
+		if (out_len < 0) {
+			return -errno;
+		}
+
+		buf = (const char *)buf + out_len;
+		len -= out_len;
+	}
+
+	return 0;
+}
+
+/* Send the header and the body without copying the body into a buffer
+ * first. Static resources are sent from where they are linked.
+ */
+static int sendmsg_all(int sock, const void *hdr, size_t hdr_len,
+		       const void *body, size_t body_len)
+{
+	struct iovec iov[2] = {
+		{ .iov_base = (void *)hdr, .iov_len = hdr_len },
+		{ .iov_base = (void *)body, .iov_len = body_len },
+	};
+	struct msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = body_len ? 2 : 1,
+	};
+
+	while (msg.msg_iovlen > 0) {
+		ssize_t out_len = zsock_sendmsg(sock, &msg, 0);
+
+		if (out_len < 0) {
+			return -errno;
+		}
+
+		while (out_len > 0 && msg.msg_iovlen > 0) {
+			if (out_len < msg.msg_iov->iov_len) {
+				msg.msg_iov->iov_base =
+					(uint8_t *)msg.msg_iov->iov_base + out_len;
+				msg.msg_iov->iov_len -= out_len;
+				break;
+			}
+
+			out_len -= msg.msg_iov->iov_len;
+			msg.msg_iov++;
+			msg.msg_iovlen--;
+		}
+	}
+
+	return 0;
+}
+
+static int on_url(struct http_parser *parser, const char *at, size_t length)
+{
+	struct http_server_conn *conn =
+		CONTAINER_OF(parser, struct http_server_conn, parser);
+
+	if (conn->url_len + length > CONFIG_HTTP_SERVER_MAX_URL_LEN) {
+		conn->bad_request = true;
+		return 0;
+	}
+
+	memcpy(conn->url + conn->url_len, at, length);
+	conn->url_len += length;
+	conn->url[conn->url_len] = '\0';
+
+	return 0;
+}
+
+static int on_body(struct http_parser *parser, const char *at, size_t length)
+{
+	struct http_server_conn *conn =
+		CONTAINER_OF(parser, struct http_server_conn, parser);
+
+	if (conn->req.body == NULL) {
+		conn->req.body = (const uint8_t *)at;
+	} else if (conn->req.body + conn->req.body_len != (const uint8_t *)at) {
+		/* Only contiguous (non chunked) request bodies are supported */
+		conn->bad_request = true;
+	}
+
+	conn->req.body_len += length;
+
+	return 0;
+}
+
+static int on_message_complete(struct http_parser *parser)
+{
+	struct http_server_conn *conn =
+		CONTAINER_OF(parser, struct http_server_conn, parser);
+
+	conn->complete = true;
+
+	/* Any following pipelined request is parsed after this one is served */
+	http_parser_pause(parser, 1);
+
+	return 0;
+}
+
+static const struct http_parser_settings parser_settings = {
+	.on_url = on_url,
+	.on_body = on_body,
+	.on_message_complete = on_message_complete,
+};
+
+static void request_reset(struct http_server_conn *conn)
+{
+	http_parser_init(&conn->parser, HTTP_REQUEST);
+
+	conn->parsed = 0;
+	conn->complete = false;
+	conn->bad_request = false;
+	conn->chunked = false;
+	conn->url_len = 0;
+	conn->url[0] = '\0';
+	conn->req.url = conn->url;
+	conn->req.body = NULL;
+	conn->req.body_len = 0;
+}
+
+static const struct http_resource *find_resource(const char *url)
+{
+	size_t len = strcspn(url, "?#");
+
+	STRUCT_SECTION_FOREACH(http_resource, res) {
+		if (strlen(res->url) == len && strncmp(res->url, url, len) == 0) {
+			return res;
+		}
+	}
+
+	return NULL;
+}
+
+static int send_header(struct http_server_conn *conn, int status,
+		       const struct http_resource *res, ssize_t content_len,
+		       bool keep_alive, bool send_now)
+{
+	char *buf = (char *)conn->send_buf;
+	size_t size = sizeof(conn->send_buf);
+	int len;
+
+	len = snprintk(buf, size, "HTTP/1.1 %d %s" HTTP_CRLF,
+		       status, status_str(status));
+
+	if (res && res->content_type && len < size) {
+		len += snprintk(buf + len, size - len,
+				"Content-Type: %s" HTTP_CRLF, res->content_type);
+	}
+
+	if (res && res->content_encoding && len < size) {
+		len += snprintk(buf + len, size - len,
+				"Content-Encoding: %s" HTTP_CRLF,
+				res->content_encoding);
+	}
+
+	if (content_len >= 0 && len < size) {
+		len += snprintk(buf + len, size - len,
+				"Content-Length: %zd" HTTP_CRLF, content_len);
+	} else if (conn->chunked && len < size) {
+		len += snprintk(buf + len, size - len,
+				"Transfer-Encoding: chunked" HTTP_CRLF);
+	}
+
+	if (len < size) {
+		len += snprintk(buf + len, size - len, "Connection: %s" HTTP_CRLF HTTP_CRLF,
+				keep_alive ? "keep-alive" : "close");
+	}
+
+	if (len >= size) {
+		NET_ERR("Send buffer too small for response header");
+		return -ENOMEM;
+	}
+
+	if (!send_now) {
+		return len;
+	}
+
+	return sendall(conn->req.sock, buf, len) < 0 ? -EIO : len;
+}
+
+static int send_error(struct http_server_conn *conn, int status)
+{
+	int ret;
+
+	ret = send_header(conn, status, NULL, 0, false, true);
+
+	return ret < 0 ? ret : -ECONNABORTED;
+}
+
+static int serve_static(struct http_server_conn *conn,
+			const struct http_resource *res, bool keep_alive)
+{
+	int hdr_len;
+
+	hdr_len = send_header(conn, 200, res, res->static_data.len,
+			      keep_alive, false);
+	if (hdr_len < 0) {
+		return hdr_len;
+	}
+
+	return sendmsg_all(conn->req.sock, conn->send_buf, hdr_len,
+			   res->static_data.data,
+			   conn->req.method == HTTP_HEAD ? 0 : res->static_data.len);
+}
+
+#if defined(CONFIG_FILE_SYSTEM)
+static int serve_fs(struct http_server_conn *conn,
+		    const struct http_resource *res, bool keep_alive)
+{
+	struct fs_dirent entry;
+	struct fs_file_t file;
+	ssize_t len;
+	int ret;
+
+	ret = fs_stat(res->fs_path, &entry);
+	if (ret < 0 || entry.type != FS_DIR_ENTRY_FILE) {
+		return send_error(conn, 404);
+	}
+
+	ret = send_header(conn, 200, res, entry.size, keep_alive, true);
+	if (ret < 0 || conn->req.method == HTTP_HEAD) {
+		return ret;
+	}
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, res->fs_path, FS_O_READ);
+	if (ret < 0) {
+		/* Header with the length is already out, only closing is left */
+		return ret;
+	}
+
+	/* File data is read straight into the buffer it is sent from */
+	while ((len = fs_read(&file, conn->send_buf, sizeof(conn->send_buf))) > 0) {
+		ret = sendall(conn->req.sock, conn->send_buf, len);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	if (len < 0) {
+		ret = len;
+	}
+
+	(void)fs_close(&file);
+
+	return ret;
+}
+#endif /* CONFIG_FILE_SYSTEM */
+
+int http_server_send_chunk(struct http_server_req *req, const void *data,
+			   size_t len)
+{
+	struct http_server_conn *conn =
+		CONTAINER_OF(req, struct http_server_conn, req);
+	char hdr[sizeof("ffffffff" HTTP_CRLF)];
+	int hdr_len;
+	int ret;
+
+	if (len == 0 || req->method == HTTP_HEAD) {
+		return 0;
+	}
+
+	if (!conn->chunked) {
+		/* HTTP/1.0 client, body is delimited by closing */
+		ret = sendall(req->sock, data, len);
+		return ret < 0 ? ret : len;
+	}
+
+	hdr_len = snprintk(hdr, sizeof(hdr), "%x" HTTP_CRLF, (unsigned int)len);
+
+	ret = sendmsg_all(req->sock, hdr, hdr_len, data, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = sendall(req->sock, HTTP_CRLF, sizeof(HTTP_CRLF) - 1);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return len;
+}
+
+static int serve_dynamic(struct http_server_conn *conn,
+			 const struct http_resource *res, bool keep_alive)
+{
+	static const char last_chunk[] = "0" HTTP_CRLF HTTP_CRLF;
+	int ret;
+
+	conn->chunked = conn->parser.http_major > 1 ||
+			(conn->parser.http_major == 1 && conn->parser.http_minor >= 1);
+
+	ret = send_header(conn, 200, res, -1, keep_alive && conn->chunked, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = res->dynamic.cb(&conn->req, res->dynamic.user_data);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (!conn->chunked) {
+		return -ECONNABORTED;
+	}
+
+	if (conn->req.method == HTTP_HEAD) {
+		return 0;
+	}
+
+	return sendall(conn->req.sock, last_chunk, sizeof(last_chunk) - 1);
+}
+
+/* Returns <0 if the connection is to be closed after the request */
+static int handle_request(struct http_server_conn *conn)
+{
+	const struct http_resource *res;
+	bool keep_alive;
+	int ret;
+
+	if (conn->bad_request) {
+		return send_error(conn, 400);
+	}
+
+	conn->req.method = conn->parser.method;
+	keep_alive = http_should_keep_alive(&conn->parser);
+
+	NET_DBG("[%d] %s %s", conn->req.sock, http_method_str(conn->req.method),
+		log_strdup(conn->url));
+
+	res = find_resource(conn->url);
+	if (res == NULL) {
+		ret = send_header(conn, 404, NULL, 0, keep_alive, true);
+		goto out;
+	}
+
+	if (res->type != HTTP_RESOURCE_TYPE_DYNAMIC &&
+	    conn->req.method != HTTP_GET && conn->req.method != HTTP_HEAD) {
+		ret = send_header(conn, 405, NULL, 0, keep_alive, true);
+		goto out;
+	}
+
+	switch (res->type) {
+	case HTTP_RESOURCE_TYPE_STATIC:
+		ret = serve_static(conn, res, keep_alive);
+		break;
+#if defined(CONFIG_FILE_SYSTEM)
+	case HTTP_RESOURCE_TYPE_FS:
+		ret = serve_fs(conn, res, keep_alive);
+		break;
+#endif
+	case HTTP_RESOURCE_TYPE_DYNAMIC:
+		ret = serve_dynamic(conn, res, keep_alive);
+		break;
+	default:
+		ret = send_error(conn, 500);
+		break;
+	}
+
+out:
+	if (ret < 0) {
+		return ret;
+	}
+
+	return keep_alive ? 0 : -ECONNABORTED;
+}
+
+/* Wait for data from the client. An idle connection is given up when
+ * other clients are waiting for a worker.
+ */
+static int wait_data(struct http_server_conn *conn)
+{
+	struct zsock_pollfd fds = {
+		.fd = conn->req.sock,
+		.events = ZSOCK_POLLIN,
+	};
+	int32_t remaining = conn->recv_len == 0 ?
+			    CONFIG_HTTP_SERVER_KEEPALIVE_TIMEOUT :
+			    CONFIG_HTTP_SERVER_REQUEST_TIMEOUT;
+	int ret;
+
+	while (remaining > 0 && running) {
+		int32_t timeout = MIN(remaining, IDLE_CHECK_INTERVAL_MS);
+
+		ret = zsock_poll(&fds, 1, timeout);
+		if (ret != 0) {
+			return ret < 0 ? -errno : 0;
+		}
+
+		if (conn->recv_len == 0 &&
+		    k_msgq_num_used_get(&http_server_accept_q) > 0) {
+			NET_DBG("[%d] Closing idle connection", conn->req.sock);
+			break;
+		}
+
+		remaining -= timeout;
+	}
+
+	return -ETIMEDOUT;
+}
+
+static void serve_conn(struct http_server_conn *conn)
+{
+	ssize_t len;
+
+	conn->recv_len = 0;
+	request_reset(conn);
+
+	while (running) {
+		if (conn->parsed < conn->recv_len) {
+			conn->parsed += http_parser_execute(
+				&conn->parser, &parser_settings,
+				(const char *)conn->recv_buf + conn->parsed,
+				conn->recv_len - conn->parsed);
+
+			if (!conn->complete &&
+			    HTTP_PARSER_ERRNO(&conn->parser) != HPE_OK) {
+				(void)send_error(conn, 400);
+				break;
+			}
+		}
+
+		if (conn->complete) {
+			if (handle_request(conn) < 0) {
+				break;
+			}
+
+			/* Move the next pipelined request to the beginning */
+			conn->recv_len -= conn->parsed;
+			memmove(conn->recv_buf, conn->recv_buf + conn->parsed,
+				conn->recv_len);
+			request_reset(conn);
+			continue;
+		}
+
+		if (conn->recv_len == sizeof(conn->recv_buf)) {
+			(void)send_error(conn, 413);
+			break;
+		}
+
+		if (wait_data(conn) < 0) {
+			break;
+		}
+
+		len = zsock_recv(conn->req.sock, conn->recv_buf + conn->recv_len,
+				 sizeof(conn->recv_buf) - conn->recv_len, 0);
+		if (len <= 0) {
+			break;
+		}
+
+		conn->recv_len += len;
+	}
+
+	NET_DBG("[%d] Connection closed", conn->req.sock);
+
+	(void)zsock_close(conn->req.sock);
+}
+
+static void worker_main(void *p1, void *p2, void *p3)
+{
+	struct http_server_conn *conn = p1;
+	int sock;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get(&http_server_accept_q, &sock, K_FOREVER);
+		if (sock < 0) {
+			/* Server is stopping */
+			break;
+		}
+
+		conn->req.sock = sock;
+		serve_conn(conn);
+	}
+}
+
+static void reject_conn(int sock)
+{
+	static const char busy[] =
+		"HTTP/1.1 503 Service Unavailable" HTTP_CRLF
+		"Content-Length: 0" HTTP_CRLF
+		"Connection: close" HTTP_CRLF HTTP_CRLF;
+
+	(void)sendall(sock, busy, sizeof(busy) - 1);
+	(void)zsock_close(sock);
+}
+
+static void listener_main(void *p1, void *p2, void *p3)
+{
+	struct zsock_pollfd fds[MAX_LISTEN_SOCKS];
+	int i, ret, sock;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (i = 0; i < listen_cnt; i++) {
+		fds[i].fd = listen_socks[i];
+		fds[i].events = ZSOCK_POLLIN;
+	}
+
+	while (running) {
+		/* Closing the listening sockets in http_server_stop()
+		 * cancels the wait.
+		 */
+		ret = zsock_poll(fds, listen_cnt, -1);
+		if (ret < 0 || !running) {
+			continue;
+		}
+
+		for (i = 0; i < listen_cnt; i++) {
+			if (!(fds[i].revents & ZSOCK_POLLIN)) {
+				continue;
+			}
+
+			sock = zsock_accept(fds[i].fd, NULL, NULL);
+			if (sock < 0) {
+				continue;
+			}
+
+			if (k_msgq_put(&http_server_accept_q, &sock, K_NO_WAIT) != 0) {
+				NET_DBG("All workers busy, rejecting connection");
+				reject_conn(sock);
+			}
+		}
+	}
+}
+
+static int listen_on(int family, uint16_t port)
+{
+	struct sockaddr addr = { 0 };
+	socklen_t addrlen;
+	int sock, ret;
+
+	if (family == AF_INET6) {
+		net_sin6(&addr)->sin6_family = AF_INET6;
+		net_sin6(&addr)->sin6_port = htons(port);
+		addrlen = sizeof(struct sockaddr_in6);
+	} else {
+		net_sin(&addr)->sin_family = AF_INET;
+		net_sin(&addr)->sin_port = htons(port);
+		addrlen = sizeof(struct sockaddr_in);
+	}
+
+	sock = zsock_socket(family, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	ret = zsock_bind(sock, &addr, addrlen);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	ret = zsock_listen(sock, CONFIG_HTTP_SERVER_BACKLOG);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	listen_socks[listen_cnt++] = sock;
+
+	return 0;
+
+fail:
+	ret = -errno;
+	(void)zsock_close(sock);
+
+	return ret;
+}
+
+static void close_listen_socks(void)
+{
+	for (int i = 0; i < listen_cnt; i++) {
+		(void)zsock_close(listen_socks[i]);
+	}
+
+	listen_cnt = 0;
+}
+
+int http_server_start(uint16_t port)
+{
+	int ret = 0;
+
+	if (running) {
+		return -EALREADY;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4)) {
+		ret = listen_on(AF_INET, port);
+		if (ret < 0) {
+			NET_ERR("Cannot listen on IPv4 port %u (%d)", port, ret);
+			goto fail;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6)) {
+		ret = listen_on(AF_INET6, port);
+		if (ret < 0) {
+			NET_ERR("Cannot listen on IPv6 port %u (%d)", port, ret);
+			goto fail;
+		}
+	}
+
+	if (listen_cnt == 0) {
+		return -EAFNOSUPPORT;
+	}
+
+	running = true;
+
+	for (int i = 0; i < CONFIG_HTTP_SERVER_WORKERS; i++) {
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]),
+				worker_main, &conns[i], NULL, NULL,
+				CONFIG_HTTP_SERVER_THREAD_PRIO, 0, K_NO_WAIT);
+		k_thread_name_set(&worker_threads[i], "http_worker");
+	}
+
+	k_thread_create(&listener_thread, listener_stack,
+			K_THREAD_STACK_SIZEOF(listener_stack),
+			listener_main, NULL, NULL, NULL,
+			CONFIG_HTTP_SERVER_THREAD_PRIO, 0, K_NO_WAIT);
+	k_thread_name_set(&listener_thread, "http_listener");
+
+	NET_DBG("HTTP server started on port %u", port);
+
+	return 0;
+
+fail:
+	close_listen_socks();
+
+	return ret;
+}
+
+int http_server_stop(void)
+{
+	const int stop = -1;
+	int sock;
+
+	if (!running) {
+		return -EALREADY;
+	}
+
+	running = false;
+
+	close_listen_socks();
+	(void)k_thread_join(&listener_thread, K_FOREVER);
+
+	/* Connections that were never served */
+	while (k_msgq_get(&http_server_accept_q, &sock, K_NO_WAIT) == 0) {
+		(void)zsock_close(sock);
+	}
+
+	for (int i = 0; i < CONFIG_HTTP_SERVER_WORKERS; i++) {
+		(void)k_msgq_put(&http_server_accept_q, &stop, K_FOREVER);
+	}
+
+	for (int i = 0; i < CONFIG_HTTP_SERVER_WORKERS; i++) {
+		(void)k_thread_join(&worker_threads[i], K_FOREVER);
+	}
+
+	NET_DBG("HTTP server stopped");
+
+	return 0;
+}
@@ -5681,34 +5681,119 @@ static int64_t engine_observe_shedule_next_event(struct observe_node *obs, uint1
 	return t_s;
 }
 
+static bool engine_observe_is_due(struct observe_node *obs, const int64_t timestamp)
+{
+	return obs->event_timestamp && timestamp >= obs->event_timestamp;
+}
+
+bool lwm2m_engine_notify_can_advance(const int64_t timestamp, int64_t event_timestamp,
+				     int64_t last_timestamp, int32_t pmin)
+{
+	if (!event_timestamp ||
+	    timestamp + CONFIG_LWM2M_ENGINE_NOTIFY_BATCH_WINDOW_MS < event_timestamp) {
+		return false;
+	}
+
+	/* Already notified in this pass, or pmin not elapsed */
+	return timestamp > last_timestamp &&
+	       timestamp >= last_timestamp + MSEC_PER_SEC * pmin;
+}
+
+/* Periodic (pmax driven) notifications may be sent early, so that they
+ * share a wakeup with a notification generated in the same engine pass.
+ * Value change notifications are gated by pmin and are never advanced.
+ */
+static bool engine_observe_can_advance(struct observe_node *obs, uint16_t srv_obj_inst,
+				       const int64_t timestamp)
+{
+	struct notification_attrs attrs;
+
+	if (obs->resource_update) {
+		return false;
+	}
+
+	if (engine_observe_attribute_list_get(&obs->path_list, &attrs, srv_obj_inst) < 0) {
+		return false;
+	}
+
+	return lwm2m_engine_notify_can_advance(timestamp, obs->event_timestamp,
+					       obs->last_timestamp, attrs.pmin);
+}
+
+static int engine_observe_notify(struct lwm2m_ctx *ctx, struct observe_node *obs,
+				 const int64_t timestamp)
+{
+	int rc;
+
+	/* Check That There is not pending process and client is registred */
+	if (obs->active_tx_operation || !lwm2m_rd_client_is_registred(ctx)) {
+		return -EBUSY;
+	}
+
+	rc = generate_notify_message(ctx, obs, NULL);
+	if (rc == -ENOMEM) {
+		return rc;
+	}
+
+	obs->event_timestamp =
+		engine_observe_shedule_next_event(obs, ctx->srv_obj_inst, timestamp);
+	obs->last_timestamp = timestamp;
+
+	return rc;
+}
+
 static void check_notifications(struct lwm2m_ctx *ctx,
 				const int64_t timestamp)
 {
 	struct observe_node *obs;
+	int batched = 0;
 	int rc;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
-		if (!obs->event_timestamp || timestamp < obs->event_timestamp) {
-			continue;
-		}
-		/* Check That There is not pending process and client is registred */
-		if (obs->active_tx_operation || !lwm2m_rd_client_is_registred(ctx)) {
+		if (!engine_observe_is_due(obs, timestamp)) {
 			continue;
 		}
 
-		rc = generate_notify_message(ctx, obs, NULL);
+		rc = engine_observe_notify(ctx, obs, timestamp);
 		if (rc == -ENOMEM) {
 			/* no memory/messages available, retry later */
 			return;
 		}
-		obs->event_timestamp =
-			engine_observe_shedule_next_event(obs, ctx->srv_obj_inst, timestamp);
-		obs->last_timestamp = timestamp;
+
 		if (!rc) {
-			/* create at most one notification */
-			return;
+			batched++;
+			if (!CONFIG_LWM2M_ENGINE_NOTIFY_BATCH_WINDOW_MS) {
+				/* create at most one notification */
+				return;
+			}
 		}
 	}
+
+	if (!batched) {
+		return;
+	}
+
+	/* This pass wakes the radio up anyway, let the periodic notifications
+	 * due soon join it
+	 */
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
+		if (!engine_observe_can_advance(obs, ctx->srv_obj_inst, timestamp)) {
+			continue;
+		}
+
+		rc = engine_observe_notify(ctx, obs, timestamp);
+		if (rc == -ENOMEM) {
+			break;
+		}
+
+		if (!rc) {
+			batched++;
+		}
+	}
+
+	if (batched > 1) {
+		LOG_DBG("%d notifications coalesced into one engine pass", batched);
+	}
 }
 
 static int socket_recv_message(struct lwm2m_ctx *client_ctx)
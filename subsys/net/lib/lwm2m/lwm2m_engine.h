@@ -152,6 +152,12 @@ enum coap_block_size lwm2m_default_block_size(void);
 
 int lwm2m_engine_add_service(k_work_handler_t service, uint32_t period_ms);
 
+/* Whether a periodic notification due at event_timestamp may be advanced to
+ * timestamp, to join a notification generated in the same engine pass
+ */
+bool lwm2m_engine_notify_can_advance(const int64_t timestamp, int64_t event_timestamp,
+				     int64_t last_timestamp, int32_t pmin);
+
 int lwm2m_engine_get_resource(const char *pathstr,
 			      struct lwm2m_engine_res **res);
 
@@ -42,6 +42,10 @@ struct cbor_out_fmt_data {
 		size_t name_sz; /* Name buff size */
 		uint8_t name_cnt;
 	};
+
+	/* Basename in effect for the following records */
+	const char *basename;
+	int basename_len;
 };
 
 struct cbor_in_fmt_data {
@@ -139,6 +143,20 @@ static int put_basename(struct lwm2m_output_context *out, struct lwm2m_obj_path
 		return len;
 	}
 
+	if ((len < sizeof("0/0") - 1) || (len >= sizeof("65535/999"))) {
+		__ASSERT_NO_MSG(false);
+		return -EINVAL;
+	}
+
+	/* A basename applies to all succeeding records, so when several
+	 * paths of the same object instance are packed into one payload
+	 * (composite read, composite observe, send) it is emitted only once.
+	 */
+	if (fd->basename && len == fd->basename_len &&
+	    strncmp(basename, fd->basename, len) == 0) {
+		return 0;
+	}
+
 	/* Tell CBOR encoder where to find the name */
 	struct record *record = GET_CBOR_FD_REC(fd);
 
@@ -146,11 +164,8 @@ static int put_basename(struct lwm2m_output_context *out, struct lwm2m_obj_path
 	record->_record_bn._record_bn.len = len;
 	record->_record_bn_present = 1;
 
-	if ((len < sizeof("0/0") - 1) || (len >= sizeof("65535/999"))) {
-		__ASSERT_NO_MSG(false);
-		return -EINVAL;
-	}
-
+	fd->basename = basename;
+	fd->basename_len = len;
 	fd->name_cnt++;
 
 	return 0;
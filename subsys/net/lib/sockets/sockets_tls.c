@@ -165,6 +165,11 @@ __net_socket struct tls_context {
 		/** Session cache enabled on a socket. */
 		bool cache_enabled;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_COALESCE)
+		/** TCP_NODELAY set on a socket, do not hold back any data. */
+		bool nodelay;
+#endif
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 		/* DTLS handshake timeout */
 		uint32_t dtls_handshake_timeout_min;
@@ -186,6 +191,19 @@ __net_socket struct tls_context {
 	socklen_t dtls_peer_addrlen;
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(CONFIG_NET_SOCKETS_TLS_COALESCE)
+	/** Application data waiting to be sent in one TLS record. */
+	uint8_t coalesce_buf[CONFIG_NET_SOCKETS_TLS_COALESCE_BUF_SIZE];
+
+	/** Amount of data in coalesce_buf. */
+	size_t coalesce_len;
+
+	/** Sending coalesce_buf was interrupted, mbedTLS requires it to be
+	 *  resumed with the same data before anything else is written.
+	 */
+	bool coalesce_stalled;
+#endif /* CONFIG_NET_SOCKETS_TLS_COALESCE */
+
 #if defined(CONFIG_MBEDTLS)
 	/** mbedTLS context. */
 	mbedtls_ssl_context ssl;
@@ -220,6 +238,10 @@ static mbedtls_ssl_cache_context server_cache;
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_COALESCE)
+static int tls_coalesce_flush(struct tls_context *ctx);
+#endif
+
 static void tls_session_cache_reset(void)
 {
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
@@ -1089,6 +1111,11 @@ static int tls_mbedtls_reset(struct tls_context *context)
 
 	k_sem_reset(&context->tls_established);
 
+#if defined(CONFIG_NET_SOCKETS_TLS_COALESCE)
+	context->coalesce_len = 0;
+	context->coalesce_stalled = false;
+#endif
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	/* Server role: reset the address so that a new
 	 *              client can connect w/o a need to reopen a socket
@@ -1794,6 +1821,12 @@ int ztls_close_ctx(struct tls_context *ctx)
 	/* Try to send close notification. */
 	ctx->flags = 0;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_COALESCE)
+	if (ctx->coalesce_len > 0) {
+		(void)tls_coalesce_flush(ctx);
+	}
+#endif
+
 	(void)mbedtls_ssl_close_notify(&ctx->ssl);
 
 	err = tls_release(ctx);
@@ -1945,6 +1978,131 @@ static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_COALESCE)
+/* Send the coalesced data. If mbedTLS cannot complete the write, the data
+ * left is moved to the beginning of the buffer, so that the next attempt
+ * is made with the same data as the interrupted one.
+ */
+static int tls_coalesce_flush(struct tls_context *ctx)
+{
+	size_t sent = 0;
+	ssize_t ret;
+
+	while (sent < ctx->coalesce_len) {
+		ret = send_tls(ctx, ctx->coalesce_buf + sent,
+			       ctx->coalesce_len - sent, ctx->flags);
+		if (ret < 0) {
+			if (errno != EAGAIN) {
+				return -errno;
+			}
+
+			memmove(ctx->coalesce_buf, ctx->coalesce_buf + sent,
+				ctx->coalesce_len - sent);
+			ctx->coalesce_len -= sent;
+			ctx->coalesce_stalled = true;
+
+			return -EAGAIN;
+		}
+
+		sent += ret;
+	}
+
+	ctx->coalesce_len = 0;
+	ctx->coalesce_stalled = false;
+
+	return 0;
+}
+
+static ssize_t send_tls_coalesce(struct tls_context *ctx, const void *buf,
+				 size_t len, int flags)
+{
+	int sock_flags = zsock_fcntl(ctx->sock, F_GETFL, 0);
+	size_t space = sizeof(ctx->coalesce_buf) - ctx->coalesce_len;
+	bool is_block, more;
+	int ret;
+
+	/* Data is held back only on blocking sockets, where the flush done
+	 * by a later call is not expected to fail.
+	 */
+	is_block = !((flags & ZSOCK_MSG_DONTWAIT) || (sock_flags & O_NONBLOCK));
+	more = is_block && (flags & ZSOCK_MSG_MORE) && !ctx->options.nodelay;
+
+	if (ctx->coalesce_stalled) {
+		ret = tls_coalesce_flush(ctx);
+		if (ret < 0) {
+			goto error;
+		}
+
+		space = sizeof(ctx->coalesce_buf);
+	}
+
+	/* Last part of coalesced data, send it all in one record */
+	if (!more && is_block && ctx->coalesce_len > 0 && len <= space) {
+		memcpy(ctx->coalesce_buf + ctx->coalesce_len, buf, len);
+		ctx->coalesce_len += len;
+
+		ret = tls_coalesce_flush(ctx);
+		if (ret < 0 && ret != -EAGAIN) {
+			goto error;
+		}
+
+		/* The data is accepted even if the flush was interrupted,
+		 * the next call resumes it.
+		 */
+		return len;
+	}
+
+	if (ctx->coalesce_len > 0 && (!more || len > space)) {
+		ret = tls_coalesce_flush(ctx);
+		if (ret < 0) {
+			goto error;
+		}
+	}
+
+	if (more && len <= sizeof(ctx->coalesce_buf) - ctx->coalesce_len) {
+		memcpy(ctx->coalesce_buf + ctx->coalesce_len, buf, len);
+		ctx->coalesce_len += len;
+
+		return len;
+	}
+
+	/* Too large to be worth copying, encrypt from the user buffer */
+	return send_tls(ctx, buf, len, flags);
+
+error:
+	errno = -ret;
+	return -1;
+}
+
+static int tls_opt_nodelay_set(struct tls_context *context,
+			       const void *optval, socklen_t optlen)
+{
+	int nodelay;
+	int ret;
+
+	if (!optval) {
+		return -EINVAL;
+	}
+
+	if (optlen != sizeof(int)) {
+		return -EINVAL;
+	}
+
+	nodelay = *(int *)optval;
+	context->options.nodelay = nodelay != 0;
+
+	/* Setting TCP_NODELAY pushes out any held back data */
+	if (context->options.nodelay && context->coalesce_len > 0) {
+		ret = tls_coalesce_flush(context);
+		if (ret < 0 && ret != -EAGAIN) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_COALESCE */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 				  size_t len, int flags,
@@ -2032,7 +2190,11 @@ ssize_t ztls_sendto_ctx(struct tls_context *ctx, const void *buf, size_t len,
 
 	/* TLS */
 	if (ctx->type == SOCK_STREAM) {
+#if defined(CONFIG_NET_SOCKETS_TLS_COALESCE)
+		return send_tls_coalesce(ctx, buf, len, flags);
+#else
 		return send_tls(ctx, buf, len, flags);
+#endif
 	}
 
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
@@ -2071,8 +2233,23 @@ ssize_t ztls_sendmsg_ctx(struct tls_context *ctx, const struct msghdr *msg,
 
 	len = 0;
 	if (msg) {
+		int last = -1;
+
+		if (IS_ENABLED(CONFIG_NET_SOCKETS_TLS_COALESCE) &&
+		    ctx->type == SOCK_STREAM) {
+			/* All but the last buffer are sent with MSG_MORE so
+			 * that the message goes out in one record.
+			 */
+			for (i = 0; i < msg->msg_iovlen; i++) {
+				if (msg->msg_iov[i].iov_len > 0) {
+					last = i;
+				}
+			}
+		}
+
 		for (i = 0; i < msg->msg_iovlen; i++) {
 			struct iovec *vec = msg->msg_iov + i;
+			int vec_flags = i < last ? flags | ZSOCK_MSG_MORE : flags;
 			size_t sent = 0;
 
 			if (vec->iov_len == 0) {
@@ -2083,7 +2260,7 @@ ssize_t ztls_sendmsg_ctx(struct tls_context *ctx, const struct msghdr *msg,
 				uint8_t *ptr = (uint8_t *)vec->iov_base + sent;
 
 				ret = ztls_sendto_ctx(ctx, ptr,
-					    vec->iov_len - sent, flags,
+					    vec->iov_len - sent, vec_flags,
 					    msg->msg_name, msg->msg_namelen);
 				if (ret < 0) {
 					return ret;
@@ -2350,6 +2527,19 @@ ssize_t ztls_recvfrom_ctx(struct tls_context *ctx, void *buf, size_t max_len,
 
 	/* TLS */
 	if (ctx->type == SOCK_STREAM) {
+#if defined(CONFIG_NET_SOCKETS_TLS_COALESCE)
+		/* Peer is likely waiting for the held back data before it
+		 * replies.
+		 */
+		if (ctx->coalesce_len > 0) {
+			int ret = tls_coalesce_flush(ctx);
+
+			if (ret < 0 && ret != -EAGAIN) {
+				errno = -ret;
+				return -1;
+			}
+		}
+#endif
 		return recv_tls(ctx, buf, max_len, flags);
 	}
 
@@ -2827,6 +3017,17 @@ int ztls_setsockopt_ctx(struct tls_context *ctx, int level, int optname,
 {
 	int err;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_COALESCE)
+	if (level == IPPROTO_TCP && optname == TCP_NODELAY &&
+	    ctx->type == SOCK_STREAM) {
+		err = tls_opt_nodelay_set(ctx, optval, optlen);
+		if (err < 0) {
+			errno = -err;
+			return -1;
+		}
+	}
+#endif
+
 	if (level != SOL_TLS) {
 		return zsock_setsockopt(ctx->sock, level, optname,
 					optval, optlen);
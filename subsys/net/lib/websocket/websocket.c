@@ -55,6 +55,7 @@ static const struct socket_op_vtable websocket_fd_op_vtable;
 
 #if defined(CONFIG_NET_TEST)
 int verify_sent_and_received_msg(struct msghdr *msg, bool split_msg);
+int verify_streamed_msg(struct msghdr *msg);
 #endif
 
 static const char *opcode2str(enum websocket_opcode opcode)
@@ -79,6 +80,54 @@ static const char *opcode2str(enum websocket_opcode opcode)
 	return NULL;
 }
 
+static bool websocket_opcode_is_valid(enum websocket_opcode opcode)
+{
+	return opcode2str(opcode) != NULL;
+}
+
+/* Apply the masking value to len bytes of payload located at the given
+ * offset from the start of the frame payload. The src and dst may point
+ * to the same buffer. Once dst is aligned, the data is processed a word
+ * at a time.
+ */
+static void websocket_mask(uint8_t *dst, const uint8_t *src, size_t len,
+			   uint32_t masking_value, uint64_t offset)
+{
+	uint8_t key[sizeof(uint32_t)];
+	uint8_t word_key[sizeof(uint32_t)];
+	uint32_t key_word;
+	size_t i = 0;
+	int j;
+
+	/* key[n] is applied to payload bytes at offset n modulo 4 */
+	for (j = 0; j < sizeof(key); j++) {
+		key[j] = masking_value >> (8 * (3 - (offset + j) % 4));
+	}
+
+	while (i < len && !IS_PTR_ALIGNED(&dst[i], uint32_t)) {
+		dst[i] = src[i] ^ key[i % 4];
+		i++;
+	}
+
+	if (len - i >= sizeof(uint32_t)) {
+		for (j = 0; j < sizeof(word_key); j++) {
+			word_key[j] = key[(i + j) % 4];
+		}
+
+		memcpy(&key_word, word_key, sizeof(key_word));
+
+		for (; len - i >= sizeof(uint32_t); i += sizeof(uint32_t)) {
+			*(uint32_t *)&dst[i] =
+				UNALIGNED_GET((const uint32_t *)&src[i]) ^
+				key_word;
+		}
+	}
+
+	for (; i < len; i++) {
+		dst[i] = src[i] ^ key[i % 4];
+	}
+}
+
 static int websocket_context_ref(struct websocket_context *ctx)
 {
 	int old_rc = atomic_inc(&ctx->refcount);
@@ -389,6 +438,7 @@ int websocket_connect(int sock, struct websocket_request *wreq,
 	 * in order that to work the amount of data in buffer must be set to 0
 	 */
 	ctx->tmp_buf_pos = 0;
+	ctx->send_remaining = 0;
 
 	return fd;
 
@@ -561,6 +611,19 @@ static int sendmsg_all(int sock, const struct msghdr *message, int flags)
 
 	return total_len;
 }
+
+static int websocket_sendmsg(struct websocket_context *ctx,
+			     struct msghdr *msg, int32_t timeout)
+{
+	k_timeout_t tout = K_FOREVER;
+
+	if (timeout != SYS_FOREVER_MS) {
+		tout = K_MSEC(timeout);
+	}
+
+	return sendmsg_all(ctx->real_sock, msg,
+			   K_TIMEOUT_EQ(tout, K_NO_WAIT) ? MSG_DONTWAIT : 0);
+}
 #endif /* !defined(CONFIG_NET_TEST) */
 
 static int websocket_prepare_and_send(struct websocket_context *ctx,
@@ -592,34 +655,13 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 	 */
 	return verify_sent_and_received_msg(&msg, !(header[1] & BIT(7)));
 #else
-	k_timeout_t tout = K_FOREVER;
-
-	if (timeout != SYS_FOREVER_MS) {
-		tout = K_MSEC(timeout);
-	}
-
-	return sendmsg_all(ctx->real_sock, &msg,
-			   K_TIMEOUT_EQ(tout, K_NO_WAIT) ? MSG_DONTWAIT : 0);
+	return websocket_sendmsg(ctx, &msg, timeout);
 #endif /* CONFIG_NET_TEST */
 }
 
-int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
-		       enum websocket_opcode opcode, bool mask, bool final,
-		       int32_t timeout)
+static struct websocket_context *websocket_ctx_get(int ws_sock, int *err)
 {
 	struct websocket_context *ctx;
-	uint8_t header[MAX_HEADER_LEN], hdr_len = 2;
-	uint8_t *data_to_send = (uint8_t *)payload;
-	int ret;
-
-	if (opcode != WEBSOCKET_OPCODE_DATA_TEXT &&
-	    opcode != WEBSOCKET_OPCODE_DATA_BINARY &&
-	    opcode != WEBSOCKET_OPCODE_CONTINUE &&
-	    opcode != WEBSOCKET_OPCODE_CLOSE &&
-	    opcode != WEBSOCKET_OPCODE_PING &&
-	    opcode != WEBSOCKET_OPCODE_PONG) {
-		return -EINVAL;
-	}
 
 #if defined(CONFIG_NET_TEST)
 	/* Websocket unit test does not use socket layer but feeds
@@ -629,18 +671,28 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 #else
 	ctx = z_get_fd_obj(ws_sock, NULL, 0);
 	if (ctx == NULL) {
-		return -EBADF;
+		*err = -EBADF;
+		return NULL;
 	}
 
 	if (!PART_OF_ARRAY(contexts, ctx)) {
-		return -ENOENT;
+		*err = -ENOENT;
+		return NULL;
 	}
 #endif /* CONFIG_NET_TEST */
 
-	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
-		mask, final ? "final" : "more");
+	return ctx;
+}
 
-	memset(header, 0, sizeof(header));
+/* Write the frame header, return the length of the header. */
+static size_t websocket_build_header(uint8_t *header,
+				     enum websocket_opcode opcode,
+				     uint64_t payload_len, bool mask,
+				     uint32_t masking_value, bool final)
+{
+	size_t hdr_len = 2;
+
+	memset(header, 0, MAX_HEADER_LEN);
 
 	/* Is this the last packet? */
 	header[0] = final ? BIT(7) : 0;
@@ -655,46 +707,61 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		header[1] |= payload_len;
 	} else if (payload_len < 65536) {
 		header[1] |= 126;
-		header[2] = payload_len >> 8;
-		header[3] = payload_len;
+		sys_put_be16(payload_len, &header[2]);
 		hdr_len += 2;
 	} else {
 		header[1] |= 127;
-		header[2] = 0;
-		header[3] = 0;
-		header[4] = 0;
-		header[5] = 0;
-		header[6] = payload_len >> 24;
-		header[7] = payload_len >> 16;
-		header[8] = payload_len >> 8;
-		header[9] = payload_len;
+		sys_put_be64(payload_len, &header[2]);
 		hdr_len += 8;
 	}
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
+		sys_put_be32(masking_value, &header[hdr_len]);
+		hdr_len += 4;
+	}
 
-		ctx->masking_value = sys_rand32_get();
+	return hdr_len;
+}
+
+int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
+		       enum websocket_opcode opcode, bool mask, bool final,
+		       int32_t timeout)
+{
+	struct websocket_context *ctx;
+	uint8_t header[MAX_HEADER_LEN];
+	uint8_t *data_to_send = (uint8_t *)payload;
+	size_t hdr_len;
+	int ret;
+
+	if (!websocket_opcode_is_valid(opcode)) {
+		return -EINVAL;
+	}
+
+	ctx = websocket_ctx_get(ws_sock, &ret);
+	if (ctx == NULL) {
+		return ret;
+	}
 
-		header[hdr_len++] |= ctx->masking_value >> 24;
-		header[hdr_len++] |= ctx->masking_value >> 16;
-		header[hdr_len++] |= ctx->masking_value >> 8;
-		header[hdr_len++] |= ctx->masking_value;
+	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
+		mask, final ? "final" : "more");
+
+	if (mask) {
+		ctx->masking_value = sys_rand32_get();
 
 		data_to_send = k_malloc(payload_len);
 		if (!data_to_send) {
 			return -ENOMEM;
 		}
 
-		memcpy(data_to_send, payload, payload_len);
-
-		for (i = 0; i < payload_len; i++) {
-			data_to_send[i] ^=
-				ctx->masking_value >> (8 * (3 - i % 4));
-		}
+		/* Mask while copying so the payload is only walked once */
+		websocket_mask(data_to_send, payload, payload_len,
+			       ctx->masking_value, 0);
 	}
 
+	hdr_len = websocket_build_header(header, opcode, payload_len, mask,
+					 ctx->masking_value, final);
+
 	ret = websocket_prepare_and_send(ctx, header, hdr_len,
 					 data_to_send, payload_len, timeout);
 	if (ret < 0) {
@@ -710,6 +777,133 @@ quit:
 	return ret - hdr_len;
 }
 
+static int websocket_send_stream(struct websocket_context *ctx,
+				 struct msghdr *msg, int32_t timeout)
+{
+#if defined(CONFIG_NET_TEST)
+	ARG_UNUSED(timeout);
+
+	return verify_streamed_msg(msg);
+#else
+	return websocket_sendmsg(ctx, msg, timeout);
+#endif
+}
+
+int websocket_send_frame_begin(int ws_sock, uint64_t payload_len,
+			       enum websocket_opcode opcode, bool mask,
+			       bool final, int32_t timeout)
+{
+	struct websocket_context *ctx;
+	uint8_t header[MAX_HEADER_LEN];
+	struct iovec io_vector;
+	struct msghdr msg;
+	int ret;
+
+	if (!websocket_opcode_is_valid(opcode)) {
+		return -EINVAL;
+	}
+
+	ctx = websocket_ctx_get(ws_sock, &ret);
+	if (ctx == NULL) {
+		return ret;
+	}
+
+	if (ctx->send_remaining > 0) {
+		NET_DBG("[%p] Previous frame not complete (%zd left)", ctx,
+			(size_t)ctx->send_remaining);
+		return -EALREADY;
+	}
+
+	NET_DBG("[%p] Stream len %zd %s/%d/%s", ctx, (size_t)payload_len,
+		opcode2str(opcode), mask, final ? "final" : "more");
+
+	ctx->send_masking_value = mask ? sys_rand32_get() : 0;
+
+	io_vector.iov_base = header;
+	io_vector.iov_len = websocket_build_header(header, opcode, payload_len,
+						   mask,
+						   ctx->send_masking_value,
+						   final);
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = &io_vector;
+	msg.msg_iovlen = 1;
+
+	ret = websocket_send_stream(ctx, &msg, timeout);
+	if (ret < 0) {
+		NET_DBG("[%p] Cannot send ws header (%d)", ctx, ret);
+		return ret;
+	}
+
+	ctx->send_masked = mask;
+	ctx->send_offset = 0;
+	ctx->send_remaining = payload_len;
+
+	return 0;
+}
+
+int websocket_send_frame_data(int ws_sock, struct iovec *iov, size_t iovcnt,
+			      int32_t timeout)
+{
+	struct websocket_context *ctx;
+	struct msghdr msg;
+	uint64_t offset;
+	size_t total_len = 0;
+	int ret, i;
+
+	if (iov == NULL && iovcnt > 0) {
+		return -EINVAL;
+	}
+
+	ctx = websocket_ctx_get(ws_sock, &ret);
+	if (ctx == NULL) {
+		return ret;
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		total_len += iov[i].iov_len;
+	}
+
+	if (total_len > ctx->send_remaining) {
+		return -EMSGSIZE;
+	}
+
+	if (total_len == 0) {
+		return 0;
+	}
+
+	if (ctx->send_masked) {
+		offset = ctx->send_offset;
+
+		for (i = 0; i < iovcnt; i++) {
+			websocket_mask(iov[i].iov_base, iov[i].iov_base,
+				       iov[i].iov_len, ctx->send_masking_value,
+				       offset);
+			offset += iov[i].iov_len;
+		}
+	}
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = iov;
+	msg.msg_iovlen = iovcnt;
+
+	ret = websocket_send_stream(ctx, &msg, timeout);
+	if (ret < 0) {
+		NET_DBG("[%p] Cannot send ws data (%d)", ctx, ret);
+
+		/* The peer cannot tell where the frame ends any more */
+		ctx->send_remaining = 0;
+		return ret;
+	}
+
+	ctx->send_offset += total_len;
+	ctx->send_remaining -= total_len;
+
+	return total_len;
+}
+
 static bool websocket_parse_header(uint8_t *buf, size_t buf_len, bool *masked,
 				   uint32_t *mask_value, uint64_t *message_length,
 				   uint32_t *message_type_flag,
@@ -901,17 +1095,49 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Now read the whole payload or parts of it */
 
-	if (ctx->tmp_buf_pos == 0) {
-		/* Read more data into temp buffer */
+	if (ctx->tmp_buf_pos > 0) {
+		if (ctx->tmp_buf_pos <= buf_len) {
+			/* Is there already any data in the temp buffer? If
+			 * yes, just return it to the caller.
+			 */
+			can_copy = MIN(ctx->message_len - ctx->total_read,
+				       ctx->tmp_buf_pos);
+		} else {
+			/* We have more data in tmp buffer that will fit into
+			 * user buffer.
+			 */
+			can_copy = MIN(ctx->message_len - ctx->total_read,
+				       buf_len);
+		}
+
+		left = ctx->tmp_buf_pos - can_copy;
+
+		NET_ASSERT(ctx->tmp_buf_pos >= can_copy);
+
+		memmove(buf, ctx->tmp_buf, can_copy);
+		recv_len = can_copy;
+
+		if (left > 0) {
+			memmove(ctx->tmp_buf, &ctx->tmp_buf[can_copy], left);
+		}
+
+		ctx->tmp_buf_pos = left;
+	} else if (ctx->total_read < ctx->message_len && buf_len > 0) {
+		/* Nothing is buffered, so read the payload directly into
+		 * the user buffer. The read is limited to the current
+		 * message so that the next header stays in the socket.
+		 */
+		can_copy = MIN(ctx->message_len - ctx->total_read, buf_len);
+
 #if defined(CONFIG_NET_TEST)
-		size_t input_len = MIN(ctx->tmp_buf_len, test_data->input_len);
+		size_t input_len = MIN(can_copy, test_data->input_len);
 
-		memcpy(ctx->tmp_buf, test_data->input_buf, input_len);
+		memcpy(buf, test_data->input_buf, input_len);
 		test_data->input_buf += input_len;
 
 		ret = input_len;
 #else
-		ret = recv(ctx->real_sock, ctx->tmp_buf, ctx->tmp_buf_len,
+		ret = recv(ctx->real_sock, buf, can_copy,
 			   K_TIMEOUT_EQ(tout, K_NO_WAIT) ? MSG_DONTWAIT : 0);
 #endif /* CONFIG_NET_TEST */
 
@@ -923,49 +1149,15 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 			return 0;
 		}
 
-		ctx->tmp_buf_pos = ret;
+		recv_len = ret;
 	}
 
-	if (ctx->tmp_buf_pos <= buf_len) {
-		/* Is there already any data in the temp buffer? If yes,
-		 * just return it to the caller.
-		 */
-		can_copy = MIN(ctx->message_len - ctx->total_read,
-			       ctx->tmp_buf_pos);
-	} else {
-		/* We have more data in tmp buffer that will fit into
-		 * user buffer.
-		 */
-		can_copy = MIN(ctx->message_len - ctx->total_read, buf_len);
-	}
-
-	left = ctx->tmp_buf_pos - can_copy;
-
-	NET_ASSERT(ctx->tmp_buf_pos >= can_copy);
-
-	memmove(buf, ctx->tmp_buf, can_copy);
-	recv_len = can_copy;
-
-	if (left > 0) {
-		memmove(ctx->tmp_buf, &ctx->tmp_buf[can_copy], left);
-	}
-
-	ctx->tmp_buf_pos = left;
 	ctx->total_read += recv_len;
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		/* As we might have less than 4 received bytes, we must select
-		 * which byte from masking value to take. The mask_shift will
-		 * tell that.
-		 */
-		int mask_shift = (ctx->total_read - recv_len) % sizeof(uint32_t);
-		int i;
-
-		for (i = 0; i < recv_len; i++) {
-			buf[i] ^= ctx->masking_value >>
-				(8 * (3 - (i + mask_shift) % 4));
-		}
+		websocket_mask(buf, buf, recv_len, ctx->masking_value,
+			       ctx->total_read - recv_len);
 	}
 
 #if HEXDUMP_RECV_PACKETS
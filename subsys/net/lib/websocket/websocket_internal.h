@@ -89,6 +89,15 @@ __net_socket struct websocket_context {
 	/** Message type */
 	uint32_t message_type;
 
+	/** Masking value of the frame being streamed to peer */
+	uint32_t send_masking_value;
+
+	/** Payload still to be sent in the frame being streamed to peer */
+	uint64_t send_remaining;
+
+	/** Payload already sent in the frame being streamed to peer */
+	uint64_t send_offset;
+
 	/** Is the message masked */
 	uint8_t masked : 1;
 
@@ -103,6 +112,9 @@ __net_socket struct websocket_context {
 
 	/** Header received */
 	uint8_t header_received : 1;
+
+	/** Is the frame being streamed to peer masked */
+	uint8_t send_masked : 1;
 };
 
 /**
@@ -218,6 +218,78 @@ static int cmd_kernel_stacks(const struct shell *shell,
 }
 #endif
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAM)
+static void shell_hist_dump(const struct shell *shell,
+			    const k_thread_runtime_stats_t *stats)
+{
+	int last = CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS - 1;
+
+	shell_print(shell, "\t%-14s %10s %10s %10s", "cycles", "ready",
+		    "run", "isr");
+
+	for (int i = 0; i <= last; i++) {
+		if (stats->ready_latency.count[i] == 0U &&
+		    stats->run_length.count[i] == 0U &&
+		    stats->isr_latency.count[i] == 0U) {
+			continue;
+		}
+
+		/* Bucket i counts times below 2^(SHIFT + i) cycles */
+		shell_print(shell, "\t%s 2^%-9d %10u %10u %10u",
+			    (i == last) ? ">=" : "< ",
+			    CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_SHIFT +
+			    ((i == last) ? i - 1 : i),
+			    stats->ready_latency.count[i],
+			    stats->run_length.count[i],
+			    stats->isr_latency.count[i]);
+	}
+}
+
+#if defined(CONFIG_THREAD_MONITOR)
+static void shell_thread_hist_dump(const struct k_thread *cthread,
+				   void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *shell = (const struct shell *)user_data;
+	k_thread_runtime_stats_t stats;
+	const char *tname = k_thread_name_get(thread);
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	shell_print(shell, "%p %-10s", thread, tname ? tname : "NA");
+	shell_hist_dump(shell, &stats);
+}
+#endif
+
+static int cmd_kernel_latency(const struct shell *shell,
+			      size_t argc, char **argv)
+{
+	k_thread_runtime_stats_t stats;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell, "Ready to running, running and ISR to running times:");
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (k_thread_runtime_stats_cpu_get(i, &stats) != 0) {
+			continue;
+		}
+
+		shell_print(shell, "CPU %d", i);
+		shell_hist_dump(shell, &stats);
+	}
+
+#if defined(CONFIG_THREAD_MONITOR)
+	k_thread_foreach(shell_thread_hist_dump, (void *)shell);
+#endif
+
+	return 0;
+}
+#endif
+
 #if defined(CONFIG_REBOOT)
 static int cmd_kernel_reboot_warm(const struct shell *shell,
 				  size_t argc, char **argv)
@@ -252,6 +324,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_reboot,
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 	SHELL_CMD(cycles, NULL, "Kernel cycles.", cmd_kernel_cycles),
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAM)
+	SHELL_CMD(latency, NULL, "Scheduling latency histograms.",
+		  cmd_kernel_latency),
+#endif
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
 #endif
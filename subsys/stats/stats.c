@@ -100,6 +100,12 @@ stats_walk(struct stats_hdr *hdr, stats_walk_fn *walk_func, void *arg)
 	int rc;
 	int i;
 
+#ifdef CONFIG_STATS_PERF
+	if (hdr->s_refresh != NULL) {
+		hdr->s_refresh(hdr);
+	}
+#endif
+
 	for (i = 0; i < hdr->s_cnt; i++) {
 		name = stats_get_name(hdr, i);
 		if (name == NULL) {
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/stats/stats.h>
+#include <zephyr/stats/stats_perf.h>
+
+#define SUB_BUCKET_MASK (STATS_PERF_SUB_BUCKETS - 1)
+
+STATS_NAME_START(perf_counter)
+STATS_NAME(perf_counter, count)
+STATS_NAME(perf_counter, min)
+STATS_NAME(perf_counter, max)
+STATS_NAME(perf_counter, mean)
+STATS_NAME(perf_counter, p50)
+STATS_NAME(perf_counter, p90)
+STATS_NAME(perf_counter, p99)
+STATS_NAME_END(perf_counter);
+
+/* Durations below STATS_PERF_SUB_BUCKETS cycles have a bucket each. Above,
+ * each power of two is split in STATS_PERF_SUB_BUCKETS buckets, indexed by
+ * the bits following the most significant one.
+ */
+static uint32_t bucket_index(uint32_t cycles)
+{
+	uint32_t shift;
+
+	if (cycles < STATS_PERF_SUB_BUCKETS) {
+		return cycles;
+	}
+
+	shift = 31 - __builtin_clz(cycles) - CONFIG_STATS_PERF_PRECISION;
+
+	return ((shift + 1) << CONFIG_STATS_PERF_PRECISION) +
+	       ((cycles >> shift) & SUB_BUCKET_MASK);
+}
+
+/* Largest duration counted in a bucket */
+static uint32_t bucket_upper(uint32_t index)
+{
+	uint32_t shift;
+
+	if (index < STATS_PERF_SUB_BUCKETS) {
+		return index;
+	}
+
+	shift = (index >> CONFIG_STATS_PERF_PRECISION) - 1;
+
+	return ((STATS_PERF_SUB_BUCKETS + (index & SUB_BUCKET_MASK)) << shift) +
+	       (BIT(shift) - 1);
+}
+
+void stats_perf_record(struct stats_perf *perf, uint32_t cycles)
+{
+	struct stats_perf_cpu *cpu;
+	k_spinlock_key_t key;
+	unsigned int irq;
+
+#ifdef CONFIG_USERSPACE
+	if (k_is_user_context()) {
+		return;
+	}
+#endif
+
+	/* The lock is only shared with readers, recordings on other CPUs
+	 * use their own histogram.
+	 */
+	irq = arch_irq_lock();
+	cpu = &perf->cpus[arch_curr_cpu()->id];
+	key = k_spin_lock(&cpu->lock);
+
+	if (cpu->count == 0U || cycles < cpu->min) {
+		cpu->min = cycles;
+	}
+	if (cycles > cpu->max) {
+		cpu->max = cycles;
+	}
+	cpu->count++;
+	cpu->sum += cycles;
+	cpu->buckets[bucket_index(cycles)]++;
+
+	k_spin_unlock(&cpu->lock, key);
+	arch_irq_unlock(irq);
+}
+
+void stats_perf_reset(struct stats_perf *perf)
+{
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct stats_perf_cpu *cpu = &perf->cpus[i];
+		k_spinlock_key_t key = k_spin_lock(&cpu->lock);
+
+		cpu->count = 0U;
+		cpu->min = 0U;
+		cpu->max = 0U;
+		cpu->sum = 0U;
+		(void)memset(cpu->buckets, 0, sizeof(cpu->buckets));
+
+		k_spin_unlock(&cpu->lock, key);
+	}
+}
+
+/* Sums the histograms of all the CPUs */
+static void perf_merge(struct stats_perf *perf, struct stats_perf_cpu *all)
+{
+	(void)memset(all, 0, sizeof(*all));
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct stats_perf_cpu *cpu = &perf->cpus[i];
+		k_spinlock_key_t key = k_spin_lock(&cpu->lock);
+
+		if (cpu->count != 0U) {
+			if (all->count == 0U || cpu->min < all->min) {
+				all->min = cpu->min;
+			}
+			all->max = MAX(all->max, cpu->max);
+			all->count += cpu->count;
+			all->sum += cpu->sum;
+
+			for (int j = 0; j < STATS_PERF_BUCKETS; j++) {
+				all->buckets[j] += cpu->buckets[j];
+			}
+		}
+
+		k_spin_unlock(&cpu->lock, key);
+	}
+}
+
+static uint32_t merged_percentile(const struct stats_perf_cpu *all,
+				  uint32_t permille)
+{
+	uint64_t rank;
+	uint32_t seen = 0U;
+
+	if (all->count == 0U) {
+		return 0U;
+	}
+
+	rank = MAX(ceiling_fraction((uint64_t)all->count * permille, 1000U), 1U);
+
+	for (int i = 0; i < STATS_PERF_BUCKETS; i++) {
+		seen += all->buckets[i];
+		if (seen >= rank) {
+			return CLAMP(bucket_upper(i), all->min, all->max);
+		}
+	}
+
+	return all->max;
+}
+
+uint32_t stats_perf_percentile(struct stats_perf *perf, uint32_t permille)
+{
+	struct stats_perf_cpu all;
+
+	perf_merge(perf, &all);
+
+	return merged_percentile(&all, permille);
+}
+
+static uint32_t cyc_to_ns(uint64_t cycles)
+{
+	return (uint32_t)MIN(k_cyc_to_ns_floor64(cycles), UINT32_MAX);
+}
+
+static void perf_refresh(struct stats_hdr *hdr)
+{
+	struct stats_perf *perf = CONTAINER_OF(hdr, struct stats_perf,
+					       group.s_hdr);
+	struct stats_perf_cpu all;
+
+	perf_merge(perf, &all);
+
+	STATS_SET(perf->group, count, all.count);
+	STATS_SET(perf->group, min, cyc_to_ns(all.min));
+	STATS_SET(perf->group, max, cyc_to_ns(all.max));
+	STATS_SET(perf->group, mean,
+		  all.count != 0U ? cyc_to_ns(all.sum / all.count) : 0U);
+	STATS_SET(perf->group, p50, cyc_to_ns(merged_percentile(&all, 500U)));
+	STATS_SET(perf->group, p90, cyc_to_ns(merged_percentile(&all, 900U)));
+	STATS_SET(perf->group, p99, cyc_to_ns(merged_percentile(&all, 990U)));
+}
+
+static int stats_perf_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	STRUCT_SECTION_FOREACH(stats_perf, perf) {
+		perf->group.s_hdr.s_refresh = perf_refresh;
+		(void)stats_init_and_reg(&perf->group.s_hdr, STATS_SIZE_32,
+					 (sizeof(perf->group) -
+					  sizeof(struct stats_hdr)) / STATS_SIZE_32,
+					 STATS_NAME_INIT_PARMS(perf_counter),
+					 perf->name);
+	}
+
+	return 0;
+}
+
+SYS_INIT(stats_perf_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
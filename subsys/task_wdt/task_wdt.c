@@ -8,6 +8,7 @@
 
 #include <zephyr/drivers/watchdog.h>
 #include <zephyr/sys/reboot.h>
+#include <zephyr/tracing/flight_recorder.h>
 #include <zephyr/device.h>
 #include <errno.h>
 
@@ -114,6 +115,8 @@ static void task_wdt_trigger(struct k_timer *timer_id)
 		return;
 	}
 
+	tracing_flight_recorder_freeze();
+
 	if (channels[channel_id].callback) {
 		channels[channel_id].callback(channel_id,
 			channels[channel_id].user_data);
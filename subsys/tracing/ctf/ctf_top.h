@@ -41,7 +41,9 @@
 		tracing_format_raw_data(epacket, sizeof(epacket));              \
 	}
 
-#ifdef CONFIG_TRACING_CTF_TIMESTAMP
+/* The per-CPU tracing buffers timestamp the events themselves */
+#if defined(CONFIG_TRACING_CTF_TIMESTAMP) && \
+	!defined(CONFIG_TRACING_PERCPU_BUFFERS)
 #define CTF_EVENT(...)                                                         \
 	{                                                                      \
 		const uint32_t tstamp = k_cyc_to_ns_floor64(k_cycle_get_32()); \
@@ -113,6 +113,39 @@ uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
  */
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data);
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+/**
+ * @brief Put an event to the tracing buffer of the current CPU.
+ *
+ * The event is stored in fixed-size records together with the cycle
+ * count elapsed since the previous event of the same CPU. No lock is
+ * shared with other CPUs.
+ *
+ * @param data Address of the event.
+ * @param length Event size (in bytes), at most 255.
+ * @param was_empty Set to true if no event was pending on any CPU.
+ *
+ * @return true if the event was stored, false if the buffer is full.
+ */
+bool tracing_percpu_put(const uint8_t *data, uint32_t length,
+			bool *was_empty);
+
+/**
+ * @brief Get the oldest event from the per-CPU tracing buffers.
+ *
+ * Events of all CPUs are merged in timestamp order. With
+ * CONFIG_TRACING_CTF_TIMESTAMP, the event is prefixed with its
+ * timestamp in nanoseconds, as expected by the CTF stream.
+ *
+ * @param data Address of the output buffer.
+ * @param size Output buffer size (in bytes), at least 4 + 255.
+ *
+ * @return Number of bytes written to the output buffer, 0 if all the
+ *         buffers are empty.
+ */
+uint32_t tracing_percpu_get(uint8_t *data, uint32_t size);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
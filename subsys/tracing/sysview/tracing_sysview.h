@@ -499,6 +499,20 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_msgq_get_enter(msgq, timeout)
 #define sys_port_trace_k_msgq_get_blocking(msgq, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_put_many_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_put_many_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_put_many_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_get_many_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_get_many_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_get_many_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_reserve_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_reserve_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_reserve_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_peek_slots_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_peek_slots_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_peek_slots_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_commit(msgq, ret)
+#define sys_port_trace_k_msgq_release(msgq, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret)
 #define sys_port_trace_k_msgq_purge(msgq)
 
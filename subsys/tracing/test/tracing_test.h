@@ -317,6 +317,32 @@
 	sys_trace_k_msgq_get_exit(msgq, data, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret) sys_trace_k_msgq_peek(msgq, data, ret)
 #define sys_port_trace_k_msgq_purge(msgq) sys_trace_k_msgq_purge(msgq)
+#define sys_port_trace_k_msgq_put_many_enter(msgq, timeout)                                        \
+	sys_trace_k_msgq_put_many_enter(msgq, data, count, timeout)
+#define sys_port_trace_k_msgq_put_many_blocking(msgq, timeout)                                     \
+	sys_trace_k_msgq_put_many_blocking(msgq, data, count, timeout)
+#define sys_port_trace_k_msgq_put_many_exit(msgq, timeout, ret)                                    \
+	sys_trace_k_msgq_put_many_exit(msgq, data, count, timeout, ret)
+#define sys_port_trace_k_msgq_get_many_enter(msgq, timeout)                                        \
+	sys_trace_k_msgq_get_many_enter(msgq, data, count, timeout)
+#define sys_port_trace_k_msgq_get_many_blocking(msgq, timeout)                                     \
+	sys_trace_k_msgq_get_many_blocking(msgq, data, count, timeout)
+#define sys_port_trace_k_msgq_get_many_exit(msgq, timeout, ret)                                    \
+	sys_trace_k_msgq_get_many_exit(msgq, data, count, timeout, ret)
+#define sys_port_trace_k_msgq_reserve_enter(msgq, timeout)                                         \
+	sys_trace_k_msgq_reserve_enter(msgq, slots, max_msgs, timeout)
+#define sys_port_trace_k_msgq_reserve_blocking(msgq, timeout)                                      \
+	sys_trace_k_msgq_reserve_blocking(msgq, slots, max_msgs, timeout)
+#define sys_port_trace_k_msgq_reserve_exit(msgq, timeout, ret)                                     \
+	sys_trace_k_msgq_reserve_exit(msgq, slots, max_msgs, timeout, ret)
+#define sys_port_trace_k_msgq_peek_slots_enter(msgq, timeout)                                      \
+	sys_trace_k_msgq_peek_slots_enter(msgq, slots, max_msgs, timeout)
+#define sys_port_trace_k_msgq_peek_slots_blocking(msgq, timeout)                                   \
+	sys_trace_k_msgq_peek_slots_blocking(msgq, slots, max_msgs, timeout)
+#define sys_port_trace_k_msgq_peek_slots_exit(msgq, timeout, ret)                                  \
+	sys_trace_k_msgq_peek_slots_exit(msgq, slots, max_msgs, timeout, ret)
+#define sys_port_trace_k_msgq_commit(msgq, ret) sys_trace_k_msgq_commit(msgq, count, ret)
+#define sys_port_trace_k_msgq_release(msgq, ret) sys_trace_k_msgq_release(msgq, count, ret)
 
 #define sys_port_trace_k_mbox_init(mbox) sys_trace_k_mbox_init(mbox)
 #define sys_port_trace_k_mbox_message_put_enter(mbox, timeout)                                     \
@@ -652,6 +678,32 @@ void sys_trace_k_msgq_get_blocking(struct k_msgq *msgq, const void *data, k_time
 void sys_trace_k_msgq_get_exit(struct k_msgq *msgq, const void *data, k_timeout_t timeout, int ret);
 void sys_trace_k_msgq_peek(struct k_msgq *msgq, void *data, int ret);
 void sys_trace_k_msgq_purge(struct k_msgq *msgq);
+void sys_trace_k_msgq_put_many_enter(struct k_msgq *msgq, const void *data, uint32_t count,
+				     k_timeout_t timeout);
+void sys_trace_k_msgq_put_many_blocking(struct k_msgq *msgq, const void *data, uint32_t count,
+					k_timeout_t timeout);
+void sys_trace_k_msgq_put_many_exit(struct k_msgq *msgq, const void *data, uint32_t count,
+				    k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_get_many_enter(struct k_msgq *msgq, const void *data, uint32_t count,
+				     k_timeout_t timeout);
+void sys_trace_k_msgq_get_many_blocking(struct k_msgq *msgq, const void *data, uint32_t count,
+					k_timeout_t timeout);
+void sys_trace_k_msgq_get_many_exit(struct k_msgq *msgq, const void *data, uint32_t count,
+				    k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_reserve_enter(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+				    k_timeout_t timeout);
+void sys_trace_k_msgq_reserve_blocking(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+				       k_timeout_t timeout);
+void sys_trace_k_msgq_reserve_exit(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+				   k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_peek_slots_enter(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+				       k_timeout_t timeout);
+void sys_trace_k_msgq_peek_slots_blocking(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+					  k_timeout_t timeout);
+void sys_trace_k_msgq_peek_slots_exit(struct k_msgq *msgq, void **slots, uint32_t max_msgs,
+				      k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_commit(struct k_msgq *msgq, uint32_t count, int ret);
+void sys_trace_k_msgq_release(struct k_msgq *msgq, uint32_t count, int ret);
 
 void sys_trace_k_heap_init(struct k_heap *h, void *mem, size_t bytes);
 void sys_trace_k_heap_alloc_enter(struct k_heap *h, size_t bytes, k_timeout_t timeout);
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/tracing/flight_recorder.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <tracing_backend.h>
+
+#define RECORDER_SIZE CONFIG_TRACING_FLIGHT_RECORDER_BUFFER_SIZE
+
+struct flight_recorder_hdr {
+	uint16_t length;
+	uint16_t stamp;
+} __packed;
+
+/* Not static, so that it can be found in a memory dump with a debugger */
+struct flight_recorder {
+	/* Offset of the oldest packet header */
+	uint32_t tail;
+	/* Number of bytes in use, packets are contiguous once frozen */
+	uint32_t used;
+	bool frozen;
+	uint8_t buf[RECORDER_SIZE];
+} tracing_flight_recorder;
+
+static void ring_copy_in(uint32_t off, const uint8_t *data, uint32_t length)
+{
+	uint32_t first = MIN(length, RECORDER_SIZE - off);
+
+	memcpy(&tracing_flight_recorder.buf[off], data, first);
+	memcpy(tracing_flight_recorder.buf, &data[first], length - first);
+}
+
+static void ring_copy_out(uint8_t *data, uint32_t off, uint32_t length)
+{
+	uint32_t first = MIN(length, RECORDER_SIZE - off);
+
+	memcpy(data, &tracing_flight_recorder.buf[off], first);
+	memcpy(&data[first], tracing_flight_recorder.buf, length - first);
+}
+
+static void oldest_hdr_get(struct flight_recorder_hdr *hdr)
+{
+	ring_copy_out((uint8_t *)hdr, tracing_flight_recorder.tail,
+		      sizeof(*hdr));
+	hdr->length = sys_le16_to_cpu(hdr->length);
+	hdr->stamp = sys_le16_to_cpu(hdr->stamp);
+}
+
+static void oldest_drop(void)
+{
+	struct flight_recorder_hdr hdr;
+	uint32_t size;
+
+	oldest_hdr_get(&hdr);
+	size = sizeof(hdr) + hdr.length;
+
+	tracing_flight_recorder.tail =
+		(tracing_flight_recorder.tail + size) % RECORDER_SIZE;
+	tracing_flight_recorder.used -= size;
+}
+
+static void reverse(uint8_t *start, uint8_t *end)
+{
+	uint8_t tmp;
+
+	while (start < end) {
+		tmp = *start;
+		*start++ = *--end;
+		*end = tmp;
+	}
+}
+
+/* Rotate the buffer in place, so that the oldest packet comes first */
+static void linearize(void)
+{
+	uint8_t *buf = tracing_flight_recorder.buf;
+	uint32_t tail = tracing_flight_recorder.tail;
+
+	reverse(buf, &buf[tail]);
+	reverse(&buf[tail], &buf[RECORDER_SIZE]);
+	reverse(buf, &buf[RECORDER_SIZE]);
+	tracing_flight_recorder.tail = 0;
+}
+
+/* Called with the tracing lock held, one packet at a time */
+static void tracing_backend_flight_recorder_output(
+		const struct tracing_backend *backend,
+		uint8_t *data, uint32_t length)
+{
+	struct flight_recorder_hdr hdr;
+	uint32_t head;
+
+	if (tracing_flight_recorder.frozen ||
+	    (sizeof(hdr) + length) > RECORDER_SIZE) {
+		return;
+	}
+
+	while ((RECORDER_SIZE - tracing_flight_recorder.used) <
+	       (sizeof(hdr) + length)) {
+		oldest_drop();
+	}
+
+	hdr.length = sys_cpu_to_le16(length);
+	hdr.stamp = sys_cpu_to_le16((uint16_t)k_uptime_get_32());
+
+	head = (tracing_flight_recorder.tail + tracing_flight_recorder.used) %
+	       RECORDER_SIZE;
+	ring_copy_in(head, (uint8_t *)&hdr, sizeof(hdr));
+	ring_copy_in((head + sizeof(hdr)) % RECORDER_SIZE, data, length);
+	tracing_flight_recorder.used += sizeof(hdr) + length;
+}
+
+void tracing_flight_recorder_freeze(void)
+{
+	struct flight_recorder_hdr hdr;
+	uint16_t now = (uint16_t)k_uptime_get_32();
+	unsigned int key = irq_lock();
+
+	if (tracing_flight_recorder.frozen) {
+		irq_unlock(key);
+		return;
+	}
+
+	tracing_flight_recorder.frozen = true;
+
+	while ((CONFIG_TRACING_FLIGHT_RECORDER_WINDOW_MS > 0) &&
+	       (tracing_flight_recorder.used > 0)) {
+		oldest_hdr_get(&hdr);
+		if ((uint16_t)(now - hdr.stamp) <=
+		    CONFIG_TRACING_FLIGHT_RECORDER_WINDOW_MS) {
+			break;
+		}
+
+		oldest_drop();
+	}
+
+	linearize();
+
+	irq_unlock(key);
+}
+
+void tracing_flight_recorder_resume(void)
+{
+	unsigned int key = irq_lock();
+
+	tracing_flight_recorder.tail = 0;
+	tracing_flight_recorder.used = 0;
+	tracing_flight_recorder.frozen = false;
+
+	irq_unlock(key);
+}
+
+bool tracing_flight_recorder_is_frozen(void)
+{
+	return tracing_flight_recorder.frozen;
+}
+
+size_t tracing_flight_recorder_data_get(const uint8_t **data)
+{
+	if (!tracing_flight_recorder.frozen) {
+		return 0;
+	}
+
+	*data = tracing_flight_recorder.buf;
+
+	return tracing_flight_recorder.used;
+}
+
+static void tracing_backend_flight_recorder_init(void)
+{
+	tracing_flight_recorder_resume();
+}
+
+const struct tracing_backend_api tracing_backend_flight_recorder_api = {
+	.init = tracing_backend_flight_recorder_init,
+	.output  = tracing_backend_flight_recorder_output
+};
+
+TRACING_BACKEND_DEFINE(tracing_backend_flight_recorder,
+		       tracing_backend_flight_recorder_api);
+
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER_SHELL
+#include <zephyr/shell/shell.h>
+
+static int cmd_freeze(const struct shell *sh, size_t argc, char **argv)
+{
+	tracing_flight_recorder_freeze();
+	shell_print(sh, "Frozen, %u bytes recorded",
+		    tracing_flight_recorder.used);
+
+	return 0;
+}
+
+static int cmd_resume(const struct shell *sh, size_t argc, char **argv)
+{
+	tracing_flight_recorder_resume();
+
+	return 0;
+}
+
+static int cmd_status(const struct shell *sh, size_t argc, char **argv)
+{
+	shell_print(sh, "%s, %u of %u bytes used",
+		    tracing_flight_recorder.frozen ? "frozen" : "recording",
+		    tracing_flight_recorder.used, RECORDER_SIZE);
+
+	return 0;
+}
+
+static int cmd_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	const uint8_t *data;
+	size_t length;
+
+	if (!tracing_flight_recorder_is_frozen()) {
+		shell_error(sh, "Flight recorder not frozen");
+		return -EBUSY;
+	}
+
+	length = tracing_flight_recorder_data_get(&data);
+	shell_hexdump(sh, data, length);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_flight_recorder,
+	SHELL_CMD(freeze, NULL, "Stop recording", cmd_freeze),
+	SHELL_CMD(resume, NULL, "Clear and resume recording", cmd_resume),
+	SHELL_CMD(status, NULL, "Show recorder state", cmd_status),
+	SHELL_CMD(dump, NULL, "Dump the frozen recorder in hex", cmd_dump),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(flight_recorder, &sub_flight_recorder,
+		   "Tracing flight recorder commands", NULL);
+#endif /* CONFIG_TRACING_FLIGHT_RECORDER_SHELL */
@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/ring_buffer.h>
 
 static struct ring_buf tracing_ring_buf;
@@ -67,3 +70,201 @@ uint32_t tracing_buffer_space_get(void)
 {
 	return ring_buf_space_get(&tracing_ring_buf);
 }
+
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+#define PERCPU_RECORDS \
+	(CONFIG_TRACING_PERCPU_BUFFER_SIZE / sizeof(struct tracing_record))
+#define PERCPU_RECORD_DATA \
+	(sizeof(struct tracing_record) - offsetof(struct tracing_record, data))
+
+/*
+ * Events take one record, followed by as many records of raw data as
+ * needed. When the cycles elapsed since the previous event of the CPU
+ * do not fit the delta, a sync record (slots == 0) holding the absolute
+ * cycle count comes first.
+ */
+struct tracing_record {
+	uint8_t slots;
+	uint8_t length;
+	uint16_t delta;
+	uint8_t data[12];
+};
+
+/*
+ * Single producer, single consumer ring: only its CPU writes to it with
+ * local interrupts masked, and only the tracing thread reads from it.
+ */
+struct tracing_percpu_ring {
+	struct tracing_record records[PERCPU_RECORDS];
+	atomic_t head;
+	uint32_t last;
+	atomic_t tail;
+	uint32_t stamp;
+};
+
+BUILD_ASSERT(IS_POWER_OF_TWO(PERCPU_RECORDS),
+	     "Per-CPU tracing buffer size must be a power of two");
+
+static struct tracing_percpu_ring percpu_rings[CONFIG_MP_NUM_CPUS];
+/* Set by the first event put after the tracing thread found no event */
+static atomic_t percpu_pending;
+
+static inline struct tracing_record *
+record_get(struct tracing_percpu_ring *ring, uint32_t idx)
+{
+	return &ring->records[idx & (PERCPU_RECORDS - 1)];
+}
+
+bool tracing_percpu_put(const uint8_t *data, uint32_t length,
+			bool *was_empty)
+{
+	struct tracing_percpu_ring *ring;
+	struct tracing_record *rec;
+	uint32_t now, delta, head, slots, need, off;
+	unsigned int key;
+	bool ret = false;
+
+	*was_empty = false;
+
+	if (length > UINT8_MAX) {
+		return false;
+	}
+
+	slots = 1 + DIV_ROUND_UP(MAX(length, PERCPU_RECORD_DATA) -
+				 PERCPU_RECORD_DATA,
+				 sizeof(struct tracing_record));
+
+	key = arch_irq_lock();
+
+	ring = &percpu_rings[_current_cpu->id];
+	now = k_cycle_get_32();
+	delta = now - ring->last;
+	need = slots + (delta > UINT16_MAX ? 1 : 0);
+	head = (uint32_t)atomic_get(&ring->head);
+
+	if (PERCPU_RECORDS - (head - (uint32_t)atomic_get(&ring->tail)) >= need) {
+		if (delta > UINT16_MAX) {
+			rec = record_get(ring, head++);
+			rec->slots = 0;
+			rec->length = 0;
+			rec->delta = 0;
+			memcpy(rec->data, &now, sizeof(now));
+			delta = 0;
+		}
+
+		rec = record_get(ring, head);
+		rec->slots = slots;
+		rec->length = length;
+		rec->delta = delta;
+		off = MIN(length, PERCPU_RECORD_DATA);
+		memcpy(rec->data, data, off);
+
+		for (uint32_t i = 1; i < slots; i++) {
+			uint32_t chunk = MIN(length - off,
+					     sizeof(struct tracing_record));
+
+			memcpy(record_get(ring, head + i), &data[off], chunk);
+			off += chunk;
+		}
+
+		ring->last = now;
+		atomic_set(&ring->head, head + slots);
+		ret = true;
+	}
+
+	arch_irq_unlock(key);
+
+	/* Only the first event after the buffers went empty touches the
+	 * shared flag, other events stay on their CPU.
+	 */
+	if (ret && atomic_get(&percpu_pending) == 0) {
+		*was_empty = atomic_cas(&percpu_pending, 0, 1);
+	}
+
+	return ret;
+}
+
+/* Skip sync records and get the timestamp of the next event, if any */
+static bool ring_peek(struct tracing_percpu_ring *ring, uint32_t *stamp)
+{
+	uint32_t tail = (uint32_t)atomic_get(&ring->tail);
+	struct tracing_record *rec;
+
+	while (tail != (uint32_t)atomic_get(&ring->head)) {
+		rec = record_get(ring, tail);
+		if (rec->slots != 0) {
+			*stamp = ring->stamp + rec->delta;
+			return true;
+		}
+
+		memcpy(&ring->stamp, rec->data, sizeof(ring->stamp));
+		atomic_set(&ring->tail, ++tail);
+	}
+
+	return false;
+}
+
+static struct tracing_percpu_ring *oldest_ring_get(uint32_t *stamp)
+{
+	struct tracing_percpu_ring *oldest = NULL;
+	uint32_t next;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (ring_peek(&percpu_rings[i], &next) &&
+		    (oldest == NULL || (int32_t)(next - *stamp) < 0)) {
+			oldest = &percpu_rings[i];
+			*stamp = next;
+		}
+	}
+
+	return oldest;
+}
+
+uint32_t tracing_percpu_get(uint8_t *data, uint32_t size)
+{
+	struct tracing_percpu_ring *ring;
+	struct tracing_record *rec;
+	uint32_t stamp, tail, length, off, out = 0;
+
+	ring = oldest_ring_get(&stamp);
+	if (ring == NULL) {
+		/* Clear the flag before looking again, so that an event put
+		 * in between either is seen here or triggers the output.
+		 */
+		atomic_clear(&percpu_pending);
+		ring = oldest_ring_get(&stamp);
+		if (ring == NULL) {
+			return 0;
+		}
+	}
+
+	tail = (uint32_t)atomic_get(&ring->tail);
+	rec = record_get(ring, tail);
+	length = rec->length;
+
+	__ASSERT_NO_MSG(size >= sizeof(uint32_t) + UINT8_MAX);
+
+	if (IS_ENABLED(CONFIG_TRACING_CTF_TIMESTAMP)) {
+		uint32_t ns = k_cyc_to_ns_floor64(stamp);
+
+		memcpy(data, &ns, sizeof(ns));
+		out = sizeof(ns);
+	}
+
+	off = MIN(length, PERCPU_RECORD_DATA);
+	memcpy(&data[out], rec->data, off);
+
+	for (uint32_t i = 1; i < rec->slots; i++) {
+		uint32_t chunk = MIN(length - off,
+				     sizeof(struct tracing_record));
+
+		memcpy(&data[out + off], record_get(ring, tail + i), chunk);
+		off += chunk;
+	}
+
+	ring->stamp = stamp;
+	atomic_set(&ring->tail, tail + rec->slots);
+
+	return out + length;
+}
+#endif /* CONFIG_TRACING_PERCPU_BUFFERS */
@@ -14,12 +14,14 @@
 #include <zephyr/kernel.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/tracing/tracing_filter.h>
 #include <tracing_core.h>
 #include <tracing_buffer.h>
 #include <tracing_backend.h>
 
 #define TRACING_CMD_ENABLE  "enable"
 #define TRACING_CMD_DISABLE "disable"
+#define TRACING_CMD_FILTER  "filter "
 
 #ifdef CONFIG_TRACING_BACKEND_UART
 #define TRACING_BACKEND_NAME "tracing_backend_uart"
@@ -29,6 +31,8 @@
 #define TRACING_BACKEND_NAME "tracing_backend_posix"
 #elif defined CONFIG_TRACING_BACKEND_RAM
 #define TRACING_BACKEND_NAME "tracing_backend_ram"
+#elif defined CONFIG_TRACING_BACKEND_FLIGHT_RECORDER
+#define TRACING_BACKEND_NAME "tracing_backend_flight_recorder"
 #else
 #define TRACING_BACKEND_NAME ""
 #endif
@@ -56,12 +60,25 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
 	uint32_t transferring_length, tracing_buffer_max_length;
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+	static uint8_t percpu_event[sizeof(uint32_t) + UINT8_MAX];
+#endif
 
 	tracing_thread_tid = k_current_get();
 
 	tracing_buffer_max_length = tracing_buffer_capacity_get();
 
 	while (true) {
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+		/* Events of all CPUs come out merged in timestamp order */
+		transferring_length = tracing_percpu_get(percpu_event,
+							 sizeof(percpu_event));
+		if (transferring_length > 0) {
+			tracing_buffer_handle(percpu_event,
+					      transferring_length);
+			continue;
+		}
+#endif
 		if (tracing_buffer_is_empty()) {
 			k_sem_take(&tracing_thread_sem, K_FOREVER);
 		} else {
@@ -143,6 +160,16 @@ bool is_tracing_enabled(void)
 
 void tracing_cmd_handle(uint8_t *buf, uint32_t length)
 {
+#ifdef CONFIG_TRACING_RUNTIME_FILTER
+	if (length > strlen(TRACING_CMD_FILTER) &&
+	    strncmp(buf, TRACING_CMD_FILTER, strlen(TRACING_CMD_FILTER)) == 0) {
+		(void)tracing_filter_cmd(
+			(const char *)&buf[strlen(TRACING_CMD_FILTER)],
+			length - strlen(TRACING_CMD_FILTER));
+		return;
+	}
+#endif
+
 	if (strncmp(buf, TRACING_CMD_ENABLE, length) == 0) {
 		tracing_set_state(TRACING_ENABLE);
 	} else if (strncmp(buf, TRACING_CMD_DISABLE, length) == 0) {
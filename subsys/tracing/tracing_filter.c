@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* k_current_get() must not be traced from the filter itself */
+#define DISABLE_SYSCALL_TRACING
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/tracing/tracing_filter.h>
+
+/*
+ * Small sets of addresses. The bloom word has a bit set for the hash of
+ * each member, so that most non-members are rejected without a scan.
+ */
+struct filter_set {
+	uint32_t bloom;
+	uint32_t count;
+	const void *items[CONFIG_TRACING_RUNTIME_FILTER_SET_SIZE];
+};
+
+struct z_tracing_filter z_tracing_filter = {
+	.classes = TRACING_CLASS_ALL,
+};
+
+static struct filter_set threads;
+static struct filter_set objects;
+static struct k_spinlock lock;
+
+static const char *const class_names[TRACING_CLASS_COUNT] = {
+	[TRACING_CLASS_THREAD] = "thread",
+	[TRACING_CLASS_WORK] = "work",
+	[TRACING_CLASS_SEM] = "sem",
+	[TRACING_CLASS_MUTEX] = "mutex",
+	[TRACING_CLASS_CONDVAR] = "condvar",
+	[TRACING_CLASS_QUEUE] = "queue",
+	[TRACING_CLASS_FIFO] = "fifo",
+	[TRACING_CLASS_LIFO] = "lifo",
+	[TRACING_CLASS_STACK] = "stack",
+	[TRACING_CLASS_MSGQ] = "msgq",
+	[TRACING_CLASS_MBOX] = "mbox",
+	[TRACING_CLASS_PIPE] = "pipe",
+	[TRACING_CLASS_HEAP] = "heap",
+	[TRACING_CLASS_MEM_SLAB] = "mem_slab",
+	[TRACING_CLASS_TIMER] = "timer",
+	[TRACING_CLASS_EVENT] = "event",
+	[TRACING_CLASS_POLL] = "poll",
+	[TRACING_CLASS_PM] = "pm",
+};
+
+static inline uint32_t hash_bit(const void *ptr)
+{
+	uintptr_t addr = (uintptr_t)ptr;
+
+	/* Kernel objects are at least word aligned */
+	return BIT(((addr >> 2) ^ (addr >> 7)) & 31);
+}
+
+static bool set_contains(const struct filter_set *set, const void *ptr)
+{
+	if ((set->bloom & hash_bit(ptr)) == 0U) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < set->count; i++) {
+		if (set->items[i] == ptr) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void narrowed_update(void)
+{
+	z_tracing_filter.narrowed = (threads.count != 0U) ||
+				    (objects.count != 0U);
+}
+
+static int set_add(struct filter_set *set, const void *ptr)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = 0;
+
+	if (!set_contains(set, ptr)) {
+		if (set->count == ARRAY_SIZE(set->items)) {
+			ret = -ENOMEM;
+		} else {
+			set->items[set->count++] = ptr;
+			set->bloom |= hash_bit(ptr);
+			narrowed_update();
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+static int set_remove(struct filter_set *set, const void *ptr)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = -ENOENT;
+
+	for (uint32_t i = 0; i < set->count; i++) {
+		if (set->items[i] == ptr) {
+			set->items[i] = set->items[--set->count];
+			ret = 0;
+			break;
+		}
+	}
+
+	if (ret == 0) {
+		set->bloom = 0U;
+		for (uint32_t i = 0; i < set->count; i++) {
+			set->bloom |= hash_bit(set->items[i]);
+		}
+
+		narrowed_update();
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+bool z_tracing_filter_match(const void *obj)
+{
+	if (threads.count != 0U &&
+	    (k_is_in_isr() || !set_contains(&threads, k_current_get()))) {
+		return false;
+	}
+
+	if (objects.count != 0U && obj != NULL &&
+	    !set_contains(&objects, obj)) {
+		return false;
+	}
+
+	return true;
+}
+
+void tracing_filter_class_set(uint32_t mask)
+{
+	z_tracing_filter.classes = mask & TRACING_CLASS_ALL;
+}
+
+uint32_t tracing_filter_class_get(void)
+{
+	return z_tracing_filter.classes;
+}
+
+const char *tracing_filter_class_name(enum tracing_class class)
+{
+	if ((unsigned int)class >= TRACING_CLASS_COUNT) {
+		return NULL;
+	}
+
+	return class_names[class];
+}
+
+int tracing_filter_thread_add(const struct k_thread *thread)
+{
+	return set_add(&threads, thread);
+}
+
+int tracing_filter_thread_remove(const struct k_thread *thread)
+{
+	return set_remove(&threads, thread);
+}
+
+int tracing_filter_object_add(const void *obj)
+{
+	return set_add(&objects, obj);
+}
+
+int tracing_filter_object_remove(const void *obj)
+{
+	return set_remove(&objects, obj);
+}
+
+void tracing_filter_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	threads.count = 0U;
+	threads.bloom = 0U;
+	objects.count = 0U;
+	objects.bloom = 0U;
+	narrowed_update();
+	z_tracing_filter.classes = TRACING_CLASS_ALL;
+
+	k_spin_unlock(&lock, key);
+}
+
+static int parse_hex(const char *str, uintptr_t *val)
+{
+	char *end;
+
+	if (str == NULL) {
+		return -EINVAL;
+	}
+
+	*val = (uintptr_t)strtoul(str, &end, 16);
+
+	return (end == str || *end != '\0') ? -EINVAL : 0;
+}
+
+int tracing_filter_cmd(const char *cmd, uint32_t length)
+{
+	char buf[CONFIG_TRACING_CMD_BUFFER_SIZE];
+	char *argv[3] = { NULL };
+	char *save;
+	uintptr_t val;
+	int argc = 0;
+	bool add;
+
+	if (length >= sizeof(buf)) {
+		return -EINVAL;
+	}
+
+	memcpy(buf, cmd, length);
+	buf[length] = '\0';
+
+	for (char *tok = strtok_r(buf, " \r\n", &save);
+	     tok != NULL && argc < ARRAY_SIZE(argv);
+	     tok = strtok_r(NULL, " \r\n", &save)) {
+		argv[argc++] = tok;
+	}
+
+	if (argc == 1 && strcmp(argv[0], "reset") == 0) {
+		tracing_filter_reset();
+		return 0;
+	}
+
+	if (argc == 2 && strcmp(argv[0], "class") == 0) {
+		if (parse_hex(argv[1], &val) != 0) {
+			return -EINVAL;
+		}
+
+		tracing_filter_class_set((uint32_t)val);
+		return 0;
+	}
+
+	if (argc != 3 || parse_hex(argv[2], &val) != 0) {
+		return -EINVAL;
+	}
+
+	if (strcmp(argv[1], "add") == 0) {
+		add = true;
+	} else if (strcmp(argv[1], "remove") == 0) {
+		add = false;
+	} else {
+		return -EINVAL;
+	}
+
+	if (strcmp(argv[0], "thread") == 0) {
+		return add ? tracing_filter_thread_add((void *)val) :
+			     tracing_filter_thread_remove((void *)val);
+	} else if (strcmp(argv[0], "object") == 0) {
+		return add ? tracing_filter_object_add((void *)val) :
+			     tracing_filter_object_remove((void *)val);
+	}
+
+	return -EINVAL;
+}
+
+#ifdef CONFIG_TRACING_RUNTIME_FILTER_SHELL
+#include <zephyr/shell/shell.h>
+
+static int cmd_class(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t mask = 0U;
+	int i;
+
+	if (argc == 1) {
+		mask = tracing_filter_class_get();
+		for (i = 0; i < TRACING_CLASS_COUNT; i++) {
+			shell_print(sh, "%-10s %s", class_names[i],
+				    (mask & BIT(i)) ? "on" : "off");
+		}
+
+		return 0;
+	}
+
+	for (size_t arg = 1; arg < argc; arg++) {
+		if (strcmp(argv[arg], "all") == 0) {
+			mask = TRACING_CLASS_ALL;
+			continue;
+		}
+
+		for (i = 0; i < TRACING_CLASS_COUNT; i++) {
+			if (strcmp(argv[arg], class_names[i]) == 0) {
+				mask |= BIT(i);
+				break;
+			}
+		}
+
+		if (i == TRACING_CLASS_COUNT) {
+			shell_error(sh, "Unknown class %s", argv[arg]);
+			return -EINVAL;
+		}
+	}
+
+	tracing_filter_class_set(mask);
+
+	return 0;
+}
+
+static int set_cmd(const struct shell *sh, char **argv, bool thread, bool add)
+{
+	uintptr_t val;
+	int ret;
+
+	if (parse_hex(argv[1], &val) != 0) {
+		shell_error(sh, "Invalid address %s", argv[1]);
+		return -EINVAL;
+	}
+
+	if (thread) {
+		ret = add ? tracing_filter_thread_add((void *)val) :
+			    tracing_filter_thread_remove((void *)val);
+	} else {
+		ret = add ? tracing_filter_object_add((void *)val) :
+			    tracing_filter_object_remove((void *)val);
+	}
+
+	if (ret != 0) {
+		shell_error(sh, "Failed: %d", ret);
+	}
+
+	return ret;
+}
+
+static int cmd_thread_add(const struct shell *sh, size_t argc, char **argv)
+{
+	return set_cmd(sh, argv, true, true);
+}
+
+static int cmd_thread_remove(const struct shell *sh, size_t argc, char **argv)
+{
+	return set_cmd(sh, argv, true, false);
+}
+
+static int cmd_object_add(const struct shell *sh, size_t argc, char **argv)
+{
+	return set_cmd(sh, argv, false, true);
+}
+
+static int cmd_object_remove(const struct shell *sh, size_t argc, char **argv)
+{
+	return set_cmd(sh, argv, false, false);
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	tracing_filter_reset();
+
+	return 0;
+}
+
+static void set_print(const struct shell *sh, const char *name,
+		      const struct filter_set *set)
+{
+	if (set->count == 0U) {
+		shell_print(sh, "%s: all", name);
+		return;
+	}
+
+	for (uint32_t i = 0; i < set->count; i++) {
+		shell_print(sh, "%s: %p", name, set->items[i]);
+	}
+}
+
+static int cmd_show(const struct shell *sh, size_t argc, char **argv)
+{
+	shell_print(sh, "classes: 0x%x", tracing_filter_class_get());
+	set_print(sh, "threads", &threads);
+	set_print(sh, "objects", &objects);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_filter_thread,
+	SHELL_CMD_ARG(add, NULL, "Trace this thread <address>",
+		      cmd_thread_add, 2, 0),
+	SHELL_CMD_ARG(remove, NULL, "Stop tracing this thread <address>",
+		      cmd_thread_remove, 2, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_filter_object,
+	SHELL_CMD_ARG(add, NULL, "Trace this object <address>",
+		      cmd_object_add, 2, 0),
+	SHELL_CMD_ARG(remove, NULL, "Stop tracing this object <address>",
+		      cmd_object_remove, 2, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_filter,
+	SHELL_CMD_ARG(class, NULL,
+		      "Show, or set the traced classes [all|<class>...]",
+		      cmd_class, 1, TRACING_CLASS_COUNT),
+	SHELL_CMD(thread, &sub_filter_thread, "Thread set commands", NULL),
+	SHELL_CMD(object, &sub_filter_object, "Object set commands", NULL),
+	SHELL_CMD(reset, NULL, "Trace all events", cmd_reset),
+	SHELL_CMD(show, NULL, "Show the filters", cmd_show),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(tracing_filter, &sub_filter,
+		   "Runtime tracing filter commands", NULL);
+#endif /* CONFIG_TRACING_RUNTIME_FILTER_SHELL */
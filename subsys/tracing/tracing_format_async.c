@@ -43,10 +43,14 @@ void tracing_format_raw_data(uint8_t *data, uint32_t length)
 		return;
 	}
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+	put_success = tracing_percpu_put(data, length, &before_put_is_empty);
+#else
 	TRACING_LOCK();
 	before_put_is_empty = tracing_buffer_is_empty();
 	put_success = tracing_format_raw_data_put(data, length);
 	TRACING_UNLOCK();
+#endif
 
 	if (put_success) {
 		tracing_trigger_output(before_put_is_empty);
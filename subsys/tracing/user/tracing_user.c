@@ -8,9 +8,15 @@
 #include <kernel_internal.h>
 #include <zephyr/kernel_structs.h>
 #include <ksched.h>
+#include <zephyr/stats/stats_perf.h>
 
 static int nested_interrupts[CONFIG_MP_NUM_CPUS];
 
+#ifdef CONFIG_STATS_PERF_ISR
+STATS_PERF_DEFINE(perf_isr);
+static uint32_t isr_start[CONFIG_MP_NUM_CPUS];
+#endif
+
 void __weak sys_trace_thread_switched_in_user(struct k_thread *thread) {}
 void __weak sys_trace_thread_switched_out_user(struct k_thread *thread) {}
 void __weak sys_trace_isr_enter_user(int nested_interrupts) {}
@@ -45,6 +51,12 @@ void sys_trace_isr_enter(void)
 	_cpu_t *curr_cpu = _current_cpu;
 
 	sys_trace_isr_enter_user(nested_interrupts[curr_cpu->id]);
+#ifdef CONFIG_STATS_PERF_ISR
+	/* Nested interrupts are part of the outermost one */
+	if (nested_interrupts[curr_cpu->id] == 0) {
+		isr_start[curr_cpu->id] = STATS_PERF_START();
+	}
+#endif
 	nested_interrupts[curr_cpu->id]++;
 
 	irq_unlock(key);
@@ -57,6 +69,11 @@ void sys_trace_isr_exit(void)
 
 	nested_interrupts[curr_cpu->id]--;
 	sys_trace_isr_exit_user(nested_interrupts[curr_cpu->id]);
+#ifdef CONFIG_STATS_PERF_ISR
+	if (nested_interrupts[curr_cpu->id] == 0) {
+		STATS_PERF_END(perf_isr, isr_start[curr_cpu->id]);
+	}
+#endif
 
 	irq_unlock(key);
 }
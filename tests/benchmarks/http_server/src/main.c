@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http_server.h>
+
+#define SERVER_PORT 8080
+#define NUM_CLIENTS CONFIG_HTTP_SERVER_WORKERS
+#define REQUESTS_PER_CLIENT 2000
+#define CLIENT_STACK_SIZE 2048
+#define CLIENT_PRIO 7
+
+#define STATIC_LEN 1024
+#define DYNAMIC_CHUNK_LEN 256
+#define DYNAMIC_CHUNKS 4
+
+static uint8_t static_data[STATIC_LEN] = {
+	[0 ... (STATIC_LEN - 1)] = 'a',
+};
+
+HTTP_RESOURCE_STATIC_DEFINE(bench_static, "/static", "text/plain", NULL,
+			    static_data, sizeof(static_data));
+
+static int dynamic_cb(struct http_server_req *req, void *user_data)
+{
+	int ret;
+
+	for (int i = 0; i < DYNAMIC_CHUNKS; i++) {
+		ret = http_server_send_chunk(req, static_data, DYNAMIC_CHUNK_LEN);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+HTTP_RESOURCE_DYNAMIC_DEFINE(bench_dynamic, "/dynamic", "text/plain",
+			     dynamic_cb, NULL);
+
+static K_THREAD_STACK_ARRAY_DEFINE(client_stacks, NUM_CLIENTS, CLIENT_STACK_SIZE);
+static struct k_thread client_threads[NUM_CLIENTS];
+
+/* Per request latency in cycles */
+static uint32_t latency[NUM_CLIENTS * REQUESTS_PER_CLIENT];
+
+static char rsp_bufs[NUM_CLIENTS][512];
+
+struct bench_case {
+	const char *name;
+	const char *request;
+};
+
+/* Read one response, either with a Content-Length or a chunked body. The
+ * client waits for each response before sending the next request, so
+ * nothing follows the end of the response.
+ */
+static int read_response(int sock, char *buf, size_t size)
+{
+	const char *last_chunk = "\r\n0\r\n\r\n";
+	const size_t tail_len = strlen(last_chunk) - 1;
+	char *hdr_end = NULL;
+	size_t content_len = 0;
+	bool chunked = false;
+	size_t len = 0;
+	ssize_t ret;
+
+	do {
+		ret = zsock_recv(sock, buf + len, size - len - 1, 0);
+		if (ret <= 0) {
+			return -EIO;
+		}
+
+		len += ret;
+		buf[len] = '\0';
+
+		if (hdr_end == NULL) {
+			char *cl;
+
+			hdr_end = strstr(buf, "\r\n\r\n");
+			if (hdr_end == NULL) {
+				continue;
+			}
+
+			cl = strstr(buf, "Content-Length: ");
+			if (cl != NULL && cl < hdr_end) {
+				content_len = strtoul(cl + 16, NULL, 10);
+			} else {
+				chunked = true;
+			}
+
+			/* Keep the header end, it may be part of the last chunk */
+			len -= hdr_end - buf;
+			memmove(buf, hdr_end, len + 1);
+			hdr_end = buf;
+		}
+
+		if (!chunked) {
+			/* Body is not inspected, count it and drop it */
+			if (len - 4 >= content_len) {
+				return 0;
+			}
+
+			content_len -= len - 4;
+			len = 4;
+			continue;
+		}
+
+		if (strstr(buf, last_chunk) != NULL) {
+			return 0;
+		}
+
+		/* Only the tail is needed to find the end of the body */
+		if (len > tail_len) {
+			memmove(buf, buf + len - tail_len, tail_len + 1);
+			len = tail_len;
+		}
+	} while (true);
+}
+
+static void client_main(void *p1, void *p2, void *p3)
+{
+	const struct bench_case *bench = p1;
+	int id = POINTER_TO_INT(p2);
+	uint32_t *samples = &latency[id * REQUESTS_PER_CLIENT];
+	char *buf = rsp_bufs[id];
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+	};
+	uint32_t start;
+	int sock;
+
+	ARG_UNUSED(p3);
+
+	(void)zsock_inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0 ||
+	    zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		printk("client %d: cannot connect (%d)\n", id, errno);
+		return;
+	}
+
+	for (int i = 0; i < REQUESTS_PER_CLIENT; i++) {
+		start = k_cycle_get_32();
+
+		if (zsock_send(sock, bench->request, strlen(bench->request), 0) < 0 ||
+		    read_response(sock, buf, sizeof(rsp_bufs[id])) < 0) {
+			printk("client %d: request %d failed (%d)\n", id, i, errno);
+			break;
+		}
+
+		samples[i] = k_cycle_get_32() - start;
+	}
+
+	(void)zsock_close(sock);
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static uint32_t cyc_to_us(uint32_t cycles)
+{
+	return (uint32_t)k_cyc_to_us_floor64(cycles);
+}
+
+static void run_bench(const struct bench_case *bench)
+{
+	const size_t total = ARRAY_SIZE(latency);
+	int64_t start_ms, elapsed_ms;
+
+	memset(latency, 0, sizeof(latency));
+
+	start_ms = k_uptime_get();
+
+	for (int i = 0; i < NUM_CLIENTS; i++) {
+		k_thread_create(&client_threads[i], client_stacks[i],
+				K_THREAD_STACK_SIZEOF(client_stacks[i]),
+				client_main, (void *)bench, INT_TO_POINTER(i), NULL,
+				CLIENT_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < NUM_CLIENTS; i++) {
+		k_thread_join(&client_threads[i], K_FOREVER);
+	}
+
+	elapsed_ms = MAX(k_uptime_get() - start_ms, 1);
+
+	qsort(latency, total, sizeof(latency[0]), cmp_u32);
+
+	printk("%s: %zu requests, %u requests/s\n", bench->name, total,
+	       (uint32_t)(total * MSEC_PER_SEC / elapsed_ms));
+	printk("%s: latency p50 %u us p90 %u us p99 %u us max %u us\n",
+	       bench->name,
+	       cyc_to_us(latency[total / 2]),
+	       cyc_to_us(latency[total * 90 / 100]),
+	       cyc_to_us(latency[total * 99 / 100]),
+	       cyc_to_us(latency[total - 1]));
+}
+
+static const struct bench_case benches[] = {
+	{
+		.name = "static",
+		.request = "GET /static HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n",
+	},
+	{
+		.name = "dynamic",
+		.request = "GET /dynamic HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n",
+	},
+};
+
+void main(void)
+{
+	int ret;
+
+	ret = http_server_start(SERVER_PORT);
+	if (ret < 0) {
+		printk("Cannot start server (%d)\n", ret);
+		return;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(benches); i++) {
+		run_bench(&benches[i]);
+	}
+
+	(void)http_server_stop();
+
+	printk("fin\n");
+}
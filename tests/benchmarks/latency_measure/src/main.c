@@ -28,6 +28,7 @@ extern int sema_test(void);
 extern int sema_context_switch(void);
 extern int suspend_resume(void);
 extern void heap_malloc_free(void);
+extern int user_lock_unlock(void);
 
 void test_thread(void *arg1, void *arg2, void *arg3)
 {
@@ -58,6 +59,8 @@ void test_thread(void *arg1, void *arg2, void *arg3)
 
 	mutex_lock_unlock();
 
+	user_lock_unlock();
+
 	heap_malloc_free();
 
 	TC_END_REPORT(error_count);
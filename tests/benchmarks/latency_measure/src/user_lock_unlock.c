@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for sys_mutex and sys_rwlock lock and unlock
+ *
+ * This file contains the tests that measure the lock and unlock time of
+ * the locks residing in user memory, without contention and when a
+ * higher priority thread waits for the lock.
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/mutex.h>
+#include <zephyr/sys/rwlock.h>
+#include "utils.h"
+
+/* the number of lock/unlock cycles */
+#define N_TEST_LOCK 1000
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+static K_THREAD_STACK_DEFINE(waiter_stack, STACK_SIZE);
+static struct k_thread waiter_data;
+
+SYS_MUTEX_DEFINE(test_sys_mutex);
+SYS_RWLOCK_DEFINE(test_rwlock);
+
+static timing_t timestamp_start_lock_c;
+static timing_t timestamp_end_unlock_c;
+
+struct lock_ops {
+	const char *name;
+	void (*lock)(void);
+	void (*unlock)(void);
+};
+
+static void sys_mutex_lock_forever(void)
+{
+	sys_mutex_lock(&test_sys_mutex, K_FOREVER);
+}
+
+static void sys_mutex_unlock_once(void)
+{
+	sys_mutex_unlock(&test_sys_mutex);
+}
+
+static void rwlock_read_lock(void)
+{
+	sys_rwlock_read_lock(&test_rwlock, K_FOREVER);
+}
+
+static void rwlock_read_unlock(void)
+{
+	sys_rwlock_read_unlock(&test_rwlock);
+}
+
+static void rwlock_write_lock(void)
+{
+	sys_rwlock_write_lock(&test_rwlock, K_FOREVER);
+}
+
+static void rwlock_write_unlock(void)
+{
+	sys_rwlock_write_unlock(&test_rwlock);
+}
+
+static const struct lock_ops sys_mutex_ops = {
+	.name = "sys_mutex",
+	.lock = sys_mutex_lock_forever,
+	.unlock = sys_mutex_unlock_once,
+};
+
+static const struct lock_ops rwlock_read_ops = {
+	.name = "sys_rwlock for reading",
+	.lock = rwlock_read_lock,
+	.unlock = rwlock_read_unlock,
+};
+
+static const struct lock_ops rwlock_write_ops = {
+	.name = "sys_rwlock for writing",
+	.lock = rwlock_write_lock,
+	.unlock = rwlock_write_unlock,
+};
+
+static void lock_unlock(const struct lock_ops *ops, bool recursive)
+{
+	char label[64];
+	int i;
+	uint32_t diff;
+	timing_t timestamp_start;
+	timing_t timestamp_end;
+
+	timing_start();
+
+	/* Locks which are not recursive are unlocked after each lock */
+	timestamp_start = timing_counter_get();
+
+	for (i = 0; i < N_TEST_LOCK; i++) {
+		ops->lock();
+		if (!recursive) {
+			ops->unlock();
+		}
+	}
+
+	timestamp_end = timing_counter_get();
+
+	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+	snprintk(label, sizeof(label), "Average time to lock %s%s", ops->name,
+		 recursive ? "" : " and unlock");
+	PRINT_STATS_AVG(label, diff, N_TEST_LOCK);
+
+	if (recursive) {
+		timestamp_start = timing_counter_get();
+
+		for (i = 0; i < N_TEST_LOCK; i++) {
+			ops->unlock();
+		}
+
+		timestamp_end = timing_counter_get();
+
+		diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+		snprintk(label, sizeof(label), "Average time to unlock %s",
+			 ops->name);
+		PRINT_STATS_AVG(label, diff, N_TEST_LOCK);
+	}
+
+	timing_stop();
+}
+
+static void waiter_thread(void *p1, void *p2, void *p3)
+{
+	const struct lock_ops *ops = p1;
+
+	timestamp_start_lock_c = timing_counter_get();
+	ops->lock();
+	timestamp_end_unlock_c = timing_counter_get();
+	ops->unlock();
+}
+
+static void lock_unlock_contended(const struct lock_ops *holder,
+				  const struct lock_ops *waiter)
+{
+	char label[64];
+	uint32_t diff;
+	timing_t timestamp_end;
+	timing_t timestamp_start;
+
+	timing_start();
+
+	holder->lock();
+
+	/* The waiter preempts this thread and blocks on the lock */
+	k_thread_create(&waiter_data, waiter_stack, STACK_SIZE,
+			waiter_thread, (void *)waiter, NULL, NULL,
+			K_PRIO_PREEMPT(3), 0, K_FOREVER);
+	k_thread_start(&waiter_data);
+
+	timestamp_end = timing_counter_get();
+	diff = timing_cycles_get(&timestamp_start_lock_c, &timestamp_end);
+	snprintk(label, sizeof(label), "Lock %s time (context switch)",
+		 waiter->name);
+	PRINT_STATS(label, diff);
+
+	timestamp_start = timing_counter_get();
+	holder->unlock();
+	diff = timing_cycles_get(&timestamp_start, &timestamp_end_unlock_c);
+	snprintk(label, sizeof(label), "Unlock %s time (context switch)",
+		 holder->name);
+	PRINT_STATS(label, diff);
+
+	k_thread_join(&waiter_data, K_FOREVER);
+
+	timing_stop();
+}
+
+/**
+ *
+ * @brief Test for the sys_mutex and sys_rwlock lock/unlock time
+ *
+ * The routine measures the uncontended lock and unlock time, then the time
+ * for a thread to block on a lock held by another one and the time to
+ * unlock it and switch to the waiting thread.
+ *
+ * @return 0 on success
+ */
+int user_lock_unlock(void)
+{
+	lock_unlock(&sys_mutex_ops, true);
+	lock_unlock(&rwlock_read_ops, false);
+	lock_unlock(&rwlock_write_ops, false);
+
+	lock_unlock_contended(&sys_mutex_ops, &sys_mutex_ops);
+	lock_unlock_contended(&rwlock_write_ops, &rwlock_read_ops);
+	lock_unlock_contended(&rwlock_read_ops, &rwlock_write_ops);
+
+	return 0;
+}
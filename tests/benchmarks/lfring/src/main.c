@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/lfring.h>
+#include <zephyr/sys/printk.h>
+
+#define NUM_MSGS 100000
+#define QUEUE_LEN 64
+
+#define STACK_SIZE 1024
+#define PRODUCER_PRIO K_PRIO_PREEMPT(5)
+
+/* A sensor sample */
+struct sample {
+	uint32_t timestamp;
+	uint32_t seq;
+	int16_t value[4];
+};
+
+struct fifo_item {
+	void *fifo_reserved;
+	struct sample sample;
+};
+
+K_MSGQ_DEFINE(bench_msgq, sizeof(struct sample), QUEUE_LEN, 4);
+
+static K_FIFO_DEFINE(bench_fifo);
+static K_FIFO_DEFINE(free_fifo);
+static struct fifo_item fifo_items[QUEUE_LEN];
+
+SYS_LFRING_SPSC_DEFINE(bench_spsc, struct sample, QUEUE_LEN);
+SYS_LFRING_MPMC_DEFINE(bench_mpmc, struct sample, QUEUE_LEN);
+
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static struct k_thread producer_thread;
+
+struct bench_case {
+	const char *name;
+	int (*put)(const struct sample *s);
+	int (*get)(struct sample *s);
+};
+
+/* Latency of the received messages, in cycles */
+static uint64_t latency_sum;
+static uint32_t latency_max;
+
+static int msgq_put(const struct sample *s)
+{
+	return k_msgq_put(&bench_msgq, s, K_FOREVER);
+}
+
+static int msgq_get(struct sample *s)
+{
+	return k_msgq_get(&bench_msgq, s, K_FOREVER);
+}
+
+static int fifo_put(const struct sample *s)
+{
+	struct fifo_item *item = k_fifo_get(&free_fifo, K_FOREVER);
+
+	item->sample = *s;
+	k_fifo_put(&bench_fifo, item);
+
+	return 0;
+}
+
+static int fifo_get(struct sample *s)
+{
+	struct fifo_item *item = k_fifo_get(&bench_fifo, K_FOREVER);
+
+	*s = item->sample;
+	k_fifo_put(&free_fifo, item);
+
+	return 0;
+}
+
+static int spsc_put(const struct sample *s)
+{
+	return sys_lfring_put(&bench_spsc, s, K_FOREVER);
+}
+
+static int spsc_get(struct sample *s)
+{
+	return sys_lfring_get(&bench_spsc, s, K_FOREVER);
+}
+
+static int mpmc_put(const struct sample *s)
+{
+	return sys_lfring_put(&bench_mpmc, s, K_FOREVER);
+}
+
+static int mpmc_get(struct sample *s)
+{
+	return sys_lfring_get(&bench_mpmc, s, K_FOREVER);
+}
+
+static void producer_main(void *p1, void *p2, void *p3)
+{
+	const struct bench_case *bench = p1;
+	struct sample s = { 0 };
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < NUM_MSGS; i++) {
+		s.seq = i;
+		s.value[0] = (int16_t)i;
+		s.timestamp = k_cycle_get_32();
+
+		if (bench->put(&s) < 0) {
+			return;
+		}
+	}
+}
+
+static void run_bench(const struct bench_case *bench)
+{
+	int64_t start_ms, elapsed_ms;
+	struct sample s;
+	uint32_t latency;
+
+	latency_sum = 0;
+	latency_max = 0;
+
+	start_ms = k_uptime_get();
+
+	k_thread_create(&producer_thread, producer_stack,
+			K_THREAD_STACK_SIZEOF(producer_stack), producer_main,
+			(void *)bench, NULL, NULL, PRODUCER_PRIO, 0, K_NO_WAIT);
+
+	for (uint32_t i = 0; i < NUM_MSGS; i++) {
+		if (bench->get(&s) < 0 || s.seq != i) {
+			printk("%s: failed at %u\n", bench->name, i);
+			k_thread_abort(&producer_thread);
+			return;
+		}
+
+		latency = k_cycle_get_32() - s.timestamp;
+		latency_sum += latency;
+		latency_max = MAX(latency_max, latency);
+	}
+
+	k_thread_join(&producer_thread, K_FOREVER);
+
+	elapsed_ms = MAX(k_uptime_get() - start_ms, 1);
+
+	printk("%s: %u msgs/s, latency avg %u us max %u us\n", bench->name,
+	       (uint32_t)((uint64_t)NUM_MSGS * MSEC_PER_SEC / elapsed_ms),
+	       (uint32_t)k_cyc_to_us_floor64(latency_sum / NUM_MSGS),
+	       (uint32_t)k_cyc_to_us_floor64(latency_max));
+}
+
+static const struct bench_case benches[] = {
+	{
+		.name = "msgq",
+		.put = msgq_put,
+		.get = msgq_get,
+	},
+	{
+		.name = "fifo",
+		.put = fifo_put,
+		.get = fifo_get,
+	},
+	{
+		.name = "lfring_spsc",
+		.put = spsc_put,
+		.get = spsc_get,
+	},
+	{
+		.name = "lfring_mpmc",
+		.put = mpmc_put,
+		.get = mpmc_get,
+	},
+};
+
+void main(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(fifo_items); i++) {
+		k_fifo_put(&free_fifo, &fifo_items[i]);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(benches); i++) {
+		run_bench(&benches[i]);
+	}
+
+	printk("fin\n");
+}
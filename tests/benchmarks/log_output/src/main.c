@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
+
+LOG_MODULE_REGISTER(bench, LOG_LEVEL_INF);
+
+#define NUM_MSGS 200
+
+/* Cost of each write to the output device */
+#define WRITE_COST_US 20
+
+struct sink {
+	const char *name;
+	const struct log_output *output;
+	uint32_t flags;
+	uint32_t msgs;
+	uint32_t writes;
+	uint32_t bytes;
+	uint32_t cycles;
+};
+
+static int sink_write(uint8_t *data, size_t length, void *ctx)
+{
+	struct sink *sink = ctx;
+
+	if (length != 0) {
+		k_busy_wait(WRITE_COST_US);
+		sink->writes++;
+		sink->bytes += length;
+	}
+
+	return length;
+}
+
+static uint8_t stream_buf[256];
+LOG_OUTPUT_DEFINE(stream_output, sink_write, stream_buf, sizeof(stream_buf));
+
+static uint8_t packet_buf[480];
+LOG_OUTPUT_DEFINE(packet_output, sink_write, packet_buf, sizeof(packet_buf));
+
+static struct sink stream = {
+	.name = "stream",
+	.output = &stream_output,
+	.flags = LOG_OUTPUT_FLAG_LEVEL | LOG_OUTPUT_FLAG_TIMESTAMP,
+};
+
+static struct sink packet = {
+	.name = "packet",
+	.output = &packet_output,
+	.flags = LOG_OUTPUT_FLAG_FORMAT_SYSLOG | LOG_OUTPUT_FLAG_TIMESTAMP,
+};
+
+static void process(const struct log_backend *const backend,
+		    union log_msg2_generic *msg)
+{
+	struct sink *sink = backend->cb->ctx;
+	uint32_t flags = sink->flags;
+	uint32_t start = k_cycle_get_32();
+
+	if (IS_ENABLED(CONFIG_LOG_OUTPUT_BATCH)) {
+		flags |= LOG_OUTPUT_FLAG_BATCH;
+	}
+
+	sink->msgs++;
+	log_output_msg2_process(sink->output, &msg->log, flags);
+	sink->cycles += k_cycle_get_32() - start;
+}
+
+static void flush(const struct log_backend *const backend)
+{
+	struct sink *sink = backend->cb->ctx;
+	uint32_t start = k_cycle_get_32();
+
+	log_backend_std_flush(sink->output);
+	sink->cycles += k_cycle_get_32() - start;
+}
+
+static void panic(const struct log_backend *const backend)
+{
+	struct sink *sink = backend->cb->ctx;
+
+	log_output_flush(sink->output);
+}
+
+static const struct log_backend_api sink_backend_api = {
+	.process = process,
+	.flush = flush,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(stream_backend, sink_backend_api, true, &stream);
+LOG_BACKEND_DEFINE(packet_backend, sink_backend_api, true, &packet);
+
+static void report(struct sink *sink)
+{
+	uint64_t rate = (uint64_t)sink->msgs * sys_clock_hw_cycles_per_sec() /
+			MAX(sink->cycles, 1U);
+
+	printk("%s: %u messages per second, %u writes, %u bytes for %u messages\n",
+	       sink->name, (uint32_t)rate, sink->writes, sink->bytes,
+	       sink->msgs);
+}
+
+void main(void)
+{
+	log_output_ctx_set(&stream_output, &stream);
+	log_output_ctx_set(&packet_output, &packet);
+
+	for (int i = 0; i < NUM_MSGS; i++) {
+		LOG_INF("message %d of %d", i, NUM_MSGS);
+	}
+
+	/* Each backend accounts for the time it spends on its messages */
+	while (log_process(false)) {
+	}
+
+	report(&stream);
+	report(&packet);
+
+	printk("fin\n");
+}
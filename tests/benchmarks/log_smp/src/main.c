@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+
+LOG_MODULE_REGISTER(bench, LOG_LEVEL_INF);
+
+#define NUM_THREADS CONFIG_MP_NUM_CPUS
+#define LOGS_PER_THREAD 20000
+
+#define STACK_SIZE 2048
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+static uint64_t cycles[NUM_THREADS];
+static atomic_t processed;
+static atomic_t dropped;
+
+static void process(const struct log_backend *const backend,
+		    union log_msg2_generic *msg)
+{
+	atomic_inc(&processed);
+}
+
+static void backend_dropped(const struct log_backend *const backend,
+			    uint32_t cnt)
+{
+	atomic_add(&dropped, cnt);
+}
+
+static void panic(const struct log_backend *const backend)
+{
+}
+
+static const struct log_backend_api null_backend_api = {
+	.process = process,
+	.dropped = backend_dropped,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(null_backend, null_backend_api, true);
+
+static void log_loop(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < LOGS_PER_THREAD; i++) {
+		LOG_INF("thread %d message %d", id, i);
+	}
+
+	cycles[id] = k_cycle_get_32() - start;
+}
+
+void main(void)
+{
+	uint64_t total = 0;
+	uint32_t size, usage, max;
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, log_loop,
+				INT_TO_POINTER(i), NULL, NULL, K_PRIO_PREEMPT(5),
+				0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		total += cycles[i];
+	}
+
+	/* Let the log processing thread drain the buffers */
+	while (log_data_pending()) {
+		k_msleep(10);
+	}
+
+	printk("%u threads: %u cycles per LOG_INF, %ld processed, %ld dropped\n",
+	       NUM_THREADS, (uint32_t)(total / (NUM_THREADS * LOGS_PER_THREAD)),
+	       atomic_get(&processed), atomic_get(&dropped));
+
+	(void)log_mem_get_usage(&size, &usage);
+	if (log_mem_get_max_usage(&max) == 0) {
+		printk("max buffer usage %u of %u bytes\n", max, size);
+	}
+
+	printk("fin\n");
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#define NUM_THREADS CONFIG_MP_NUM_CPUS
+#define BURST 4
+#define BURSTS_PER_THREAD 50000
+
+#define BLOCK_SIZE 128
+#define NUM_BLOCKS (NUM_THREADS * BURST * 4)
+
+#define STACK_SIZE 1024
+
+K_MEM_SLAB_DEFINE(bench_slab, BLOCK_SIZE, NUM_BLOCKS, 8);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+static atomic_t failures;
+
+static void alloc_free(void *p1, void *p2, void *p3)
+{
+	void *blocks[BURST];
+
+	for (int i = 0; i < BURSTS_PER_THREAD; i++) {
+		for (int j = 0; j < BURST; j++) {
+			if (k_mem_slab_alloc(&bench_slab, &blocks[j],
+					     K_FOREVER) != 0) {
+				atomic_inc(&failures);
+				return;
+			}
+
+			/* Touch the block, as its user would */
+			*(uint32_t *)blocks[j] = i;
+		}
+
+		for (int j = 0; j < BURST; j++) {
+			k_mem_slab_free(&bench_slab, &blocks[j]);
+		}
+	}
+}
+
+void main(void)
+{
+	uint32_t pairs = NUM_THREADS * BURSTS_PER_THREAD * BURST;
+	int64_t start, ms;
+
+	start = k_uptime_get();
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, alloc_free,
+				NULL, NULL, NULL, K_PRIO_PREEMPT(5), 0,
+				K_NO_WAIT);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	ms = k_uptime_get() - start;
+	if (ms == 0) {
+		ms = 1;
+	}
+
+	if (atomic_get(&failures) != 0) {
+		printk("%ld allocations failed\n", atomic_get(&failures));
+	}
+
+	printk("%u threads: %u alloc/free pairs in %u ms, %u pairs/s\n",
+	       NUM_THREADS, pairs, (uint32_t)ms,
+	       (uint32_t)(pairs * 1000ULL / ms));
+	printk("max used %u of %u blocks\n", k_mem_slab_max_used_get(&bench_slab),
+	       NUM_BLOCKS);
+
+	printk("fin\n");
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#define NUM_MSGS 100000
+#define QUEUE_LEN 64
+#define BATCH_LEN 16
+
+#define STACK_SIZE 1024
+#define PRODUCER_PRIO K_PRIO_PREEMPT(5)
+
+/* A sensor sample */
+struct sample {
+	uint32_t timestamp;
+	uint32_t seq;
+	int16_t value[4];
+};
+
+K_MSGQ_DEFINE(bench_msgq, sizeof(struct sample), QUEUE_LEN, 4);
+
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static struct k_thread producer_thread;
+
+struct bench_case {
+	const char *name;
+	void (*produce)(void);
+	int (*consume)(struct sample *samples, uint32_t max);
+};
+
+/* Latency of the received messages, in cycles */
+static uint64_t latency_sum;
+static uint32_t latency_max;
+
+static inline void sample_fill(struct sample *s, uint32_t seq)
+{
+	s->seq = seq;
+	s->value[0] = (int16_t)seq;
+	s->timestamp = k_cycle_get_32();
+}
+
+static void produce_single(void)
+{
+	struct sample s;
+
+	for (uint32_t i = 0; i < NUM_MSGS; i++) {
+		sample_fill(&s, i);
+		(void)k_msgq_put(&bench_msgq, &s, K_FOREVER);
+	}
+}
+
+static void produce_batch(void)
+{
+	struct sample s[BATCH_LEN];
+	uint32_t sent = 0;
+	int ret;
+
+	while (sent < NUM_MSGS) {
+		uint32_t count = MIN(BATCH_LEN, NUM_MSGS - sent);
+
+		for (uint32_t i = 0; i < count; i++) {
+			sample_fill(&s[i], sent + i);
+		}
+
+		for (uint32_t i = 0; i < count; i += ret) {
+			ret = k_msgq_put_many(&bench_msgq, &s[i], count - i,
+					      K_FOREVER);
+			if (ret < 0) {
+				return;
+			}
+		}
+
+		sent += count;
+	}
+}
+
+static void produce_in_place(void)
+{
+	struct sample *slots;
+	uint32_t sent = 0;
+	int ret;
+
+	while (sent < NUM_MSGS) {
+		ret = k_msgq_reserve(&bench_msgq, (void **)&slots,
+				     MIN(BATCH_LEN, NUM_MSGS - sent), K_FOREVER);
+		if (ret < 0) {
+			return;
+		}
+
+		for (int i = 0; i < ret; i++) {
+			sample_fill(&slots[i], sent + i);
+		}
+
+		(void)k_msgq_commit(&bench_msgq, ret);
+		sent += ret;
+	}
+}
+
+static void account(const struct sample *s, uint32_t now)
+{
+	uint32_t latency = now - s->timestamp;
+
+	latency_sum += latency;
+	latency_max = MAX(latency_max, latency);
+}
+
+static int consume_single(struct sample *samples, uint32_t max)
+{
+	int ret = k_msgq_get(&bench_msgq, &samples[0], K_FOREVER);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	account(&samples[0], k_cycle_get_32());
+
+	return 1;
+}
+
+static int consume_batch(struct sample *samples, uint32_t max)
+{
+	uint32_t now;
+	int ret;
+
+	ret = k_msgq_get_many(&bench_msgq, samples, max, K_FOREVER);
+	if (ret < 0) {
+		return ret;
+	}
+
+	now = k_cycle_get_32();
+	for (int i = 0; i < ret; i++) {
+		account(&samples[i], now);
+	}
+
+	return ret;
+}
+
+static int consume_in_place(struct sample *samples, uint32_t max)
+{
+	struct sample *slots;
+	uint32_t now;
+	int ret;
+
+	ARG_UNUSED(samples);
+
+	ret = k_msgq_peek_slots(&bench_msgq, (void **)&slots, max, K_FOREVER);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Messages are processed without being copied out */
+	now = k_cycle_get_32();
+	for (int i = 0; i < ret; i++) {
+		account(&slots[i], now);
+	}
+
+	(void)k_msgq_release(&bench_msgq, ret);
+
+	return ret;
+}
+
+static void producer_main(void *p1, void *p2, void *p3)
+{
+	const struct bench_case *bench = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	bench->produce();
+}
+
+static void run_bench(const struct bench_case *bench)
+{
+	static struct sample samples[BATCH_LEN];
+	int64_t start_ms, elapsed_ms;
+	uint32_t received = 0;
+	int ret;
+
+	latency_sum = 0;
+	latency_max = 0;
+
+	start_ms = k_uptime_get();
+
+	k_thread_create(&producer_thread, producer_stack,
+			K_THREAD_STACK_SIZEOF(producer_stack), producer_main,
+			(void *)bench, NULL, NULL, PRODUCER_PRIO, 0, K_NO_WAIT);
+
+	while (received < NUM_MSGS) {
+		uint32_t max = MIN(BATCH_LEN, NUM_MSGS - received);
+
+		ret = bench->consume(samples, max);
+		if (ret < 0) {
+			printk("%s: failed (%d)\n", bench->name, ret);
+			k_thread_abort(&producer_thread);
+			return;
+		}
+
+		received += ret;
+	}
+
+	k_thread_join(&producer_thread, K_FOREVER);
+
+	elapsed_ms = MAX(k_uptime_get() - start_ms, 1);
+
+	printk("%s: %u msgs/s, latency avg %u us max %u us\n", bench->name,
+	       (uint32_t)((uint64_t)NUM_MSGS * MSEC_PER_SEC / elapsed_ms),
+	       (uint32_t)k_cyc_to_us_floor64(latency_sum / NUM_MSGS),
+	       (uint32_t)k_cyc_to_us_floor64(latency_max));
+}
+
+static const struct bench_case benches[] = {
+	{
+		.name = "single",
+		.produce = produce_single,
+		.consume = consume_single,
+	},
+	{
+		.name = "batch",
+		.produce = produce_batch,
+		.consume = consume_batch,
+	},
+	{
+		.name = "in_place",
+		.produce = produce_in_place,
+		.consume = consume_in_place,
+	},
+};
+
+void main(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(benches); i++) {
+		run_bench(&benches[i]);
+	}
+
+	printk("fin\n");
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#define NUM_THREADS CONFIG_MP_NUM_CPUS
+#define LOCKS_PER_THREAD 20000
+
+/* Busy time inside and outside of the critical section */
+#define INSIDE_CYCLES 200
+#define OUTSIDE_CYCLES 400
+
+#define STACK_SIZE 1024
+
+static K_MUTEX_DEFINE(bench_mutex);
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+/* Protected by bench_mutex */
+static uint32_t shared_counter;
+
+static void busy_wait_cycles(uint32_t cycles)
+{
+	uint32_t start = k_cycle_get_32();
+
+	while (k_cycle_get_32() - start < cycles) {
+	}
+}
+
+static void locker(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < LOCKS_PER_THREAD; i++) {
+		k_mutex_lock(&bench_mutex, K_FOREVER);
+		shared_counter++;
+		busy_wait_cycles(INSIDE_CYCLES);
+		k_mutex_unlock(&bench_mutex);
+
+		busy_wait_cycles(OUTSIDE_CYCLES);
+	}
+}
+
+void main(void)
+{
+	uint32_t total = NUM_THREADS * LOCKS_PER_THREAD;
+	int64_t start, ms;
+
+	start = k_uptime_get();
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, locker,
+				NULL, NULL, NULL, K_PRIO_PREEMPT(5), 0,
+				K_NO_WAIT);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	ms = k_uptime_get() - start;
+	if (ms == 0) {
+		ms = 1;
+	}
+
+	if (shared_counter != total) {
+		printk("counter %u, expected %u\n", shared_counter, total);
+	}
+
+	printk("%u locks in %u ms, %u locks/s\n", total, (uint32_t)ms,
+	       (uint32_t)(total * 1000ULL / ms));
+
+#ifdef CONFIG_MUTEX_SPIN_STATS
+	struct k_mutex_spin_stats stats;
+
+	k_mutex_spin_stats_get(&stats, false);
+	printk("spins: %u, acquired: %u, avg %u cycles\n", stats.spins,
+	       stats.acquired,
+	       stats.spins != 0U ? (uint32_t)(stats.cycles / stats.spins) : 0U);
+#endif
+
+	printk("fin\n");
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#define NUM_MSGS 100
+
+/* Cost of each character written to the output device */
+#define CHAR_COST_US 1
+
+void __printk_hook_install(int (*fn)(int));
+void *__printk_get_hook(void);
+
+static volatile uint32_t lines;
+
+static int sink_out(int c)
+{
+	k_busy_wait(CHAR_COST_US);
+	if (c == '\n') {
+		lines++;
+	}
+
+	return c;
+}
+
+void main(void)
+{
+	int (*console_out)(int) = __printk_get_hook();
+	const char *mode = IS_ENABLED(CONFIG_PRINTK_DEFERRED) ? "deferred" :
+								"sync";
+	uint32_t cycles = 0U;
+	uint32_t output;
+
+	__printk_hook_install(sink_out);
+
+	for (int i = 0; i < NUM_MSGS; i++) {
+		uint32_t start = k_cycle_get_32();
+
+		printk("message %d of %d: %s\n", i, NUM_MSGS, mode);
+		cycles += k_cycle_get_32() - start;
+	}
+
+	/* Let the deferred messages drain, until no line is output for a
+	 * while.
+	 */
+	do {
+		output = lines;
+		k_msleep(100);
+	} while (lines != output);
+
+	__printk_hook_install(console_out);
+
+	printk("printk %s: %u cycles per call, %u of %u messages output\n",
+	       mode, cycles / NUM_MSGS, output, NUM_MSGS);
+
+	printk("fin\n");
+}
@@ -70,6 +70,84 @@ static inline int _stamp(int state)
 /* #define stamp(s) printk("%s @ %d\n", #s, _stamp(s)) */
 #define stamp(s) _stamp(s)
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/* Constant bandwidth server scenario: a periodic thread and a thread
+ * spinning forever share a priority, each with a budget of its own.
+ * The spinning thread overruns its budget every period, which must not
+ * make the periodic one miss its deadlines.
+ */
+#define CBS_PERIOD_MS 10
+#define CBS_WORK_US 2000
+#define CBS_RUN_MS 1000
+
+static K_THREAD_STACK_DEFINE(periodic_stack, 1024);
+static K_THREAD_STACK_DEFINE(hog_stack, 1024);
+static struct k_thread periodic_thread;
+static struct k_thread hog_thread;
+
+static uint32_t periodic_runs, periodic_late, periodic_max_lateness;
+
+static void periodic_fn(void *arg1, void *arg2, void *arg3)
+{
+	uint32_t period = k_ms_to_cyc_ceil32(CBS_PERIOD_MS);
+	uint32_t release = k_cycle_get_32();
+
+	while (true) {
+		uint32_t lateness;
+
+		k_busy_wait(CBS_WORK_US);
+		lateness = k_cycle_get_32() - release;
+
+		periodic_runs++;
+		if (lateness > period) {
+			periodic_late++;
+		}
+		periodic_max_lateness = MAX(periodic_max_lateness, lateness);
+
+		release += period;
+		if ((int32_t)(release - k_cycle_get_32()) > 0) {
+			k_usleep(k_cyc_to_us_floor32(release -
+						     k_cycle_get_32()));
+		}
+	}
+}
+
+static void hog_fn(void *arg1, void *arg2, void *arg3)
+{
+	while (true) {
+	}
+}
+
+static void cbs_scenario(int prio)
+{
+	uint32_t period = k_ms_to_cyc_ceil32(CBS_PERIOD_MS);
+	k_tid_t periodic, hog;
+
+	periodic = k_thread_create(&periodic_thread, periodic_stack,
+				   K_THREAD_STACK_SIZEOF(periodic_stack),
+				   periodic_fn, NULL, NULL, NULL,
+				   prio, 0, K_FOREVER);
+	hog = k_thread_create(&hog_thread, hog_stack,
+			      K_THREAD_STACK_SIZEOF(hog_stack),
+			      hog_fn, NULL, NULL, NULL,
+			      prio, 0, K_FOREVER);
+
+	/* The periodic thread needs a fifth of the CPU, and gets a quarter */
+	k_thread_deadline_budget_set(periodic, period / 4, period);
+	k_thread_deadline_budget_set(hog, period / 2, period);
+
+	k_thread_start(hog);
+	k_thread_start(periodic);
+	k_msleep(CBS_RUN_MS);
+	k_thread_abort(hog);
+	k_thread_abort(periodic);
+
+	printk("cbs periodic runs %u late %u max lateness %u hog overruns %u\n",
+	       periodic_runs, periodic_late, periodic_max_lateness,
+	       k_thread_deadline_overruns_get(hog));
+}
+#endif
+
 static void partner_fn(void *arg1, void *arg2, void *arg3)
 {
 	ARG_UNUSED(arg1);
@@ -148,5 +226,10 @@ void main(void)
 		       stamps[4] - stamps[3],
 		       whole, avg);
 	}
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	k_thread_abort(th);
+	cbs_scenario(main_prio + 1);
+#endif
 	printk("fin\n");
 }
@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/tls_credentials.h>
+
+#define SERVER_PORT 4242
+#define RELAY_PORT 4243
+#define THREAD_STACK_SIZE 3072
+#define THREAD_PRIO 7
+
+#define PSK_TAG 1
+
+/* Amount of data sent with each write pattern */
+#define TOTAL_LEN (64 * 1024)
+
+#define TLS_RECORD_HDR_LEN 5
+#define TLS_CONTENT_APP_DATA 23
+
+static const unsigned char psk[] = {
+	0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const char psk_id[] = "bench_identity";
+
+static K_THREAD_STACK_DEFINE(server_stack, THREAD_STACK_SIZE);
+static struct k_thread server_thread;
+static K_THREAD_STACK_DEFINE(relay_stack, THREAD_STACK_SIZE);
+static struct k_thread relay_thread;
+
+static K_SEM_DEFINE(server_ready, 0, 1);
+static K_SEM_DEFINE(relay_ready, 0, 1);
+static K_SEM_DEFINE(received_all, 0, 1);
+
+/* Application data records seen by the relay */
+static atomic_t records;
+/* Application data received by the server */
+static atomic_t received;
+
+static uint8_t server_buf[1024];
+static uint8_t relay_buf[1024];
+static uint8_t client_buf[4096];
+
+struct record_parser {
+	uint8_t hdr[TLS_RECORD_HDR_LEN];
+	size_t hdr_len;
+	size_t skip;
+};
+
+static int set_psk(int sock)
+{
+	sec_tag_t sec_tag_list[] = {
+		PSK_TAG
+	};
+
+	return zsock_setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST,
+				sec_tag_list, sizeof(sec_tag_list));
+}
+
+static int listen_on(int proto, uint16_t port)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(port),
+	};
+	int sock;
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, proto);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	if ((proto != IPPROTO_TCP && set_psk(sock) < 0) ||
+	    zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    zsock_listen(sock, 1) < 0) {
+		(void)zsock_close(sock);
+		return -errno;
+	}
+
+	return sock;
+}
+
+static int connect_to(int proto, uint16_t port)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(port),
+	};
+	int sock;
+
+	(void)zsock_inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, proto);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	if ((proto != IPPROTO_TCP && set_psk(sock) < 0) ||
+	    zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		(void)zsock_close(sock);
+		return -errno;
+	}
+
+	return sock;
+}
+
+static int send_all(int sock, const uint8_t *buf, size_t len)
+{
+	ssize_t ret;
+
+	while (len > 0) {
+		ret = zsock_send(sock, buf, len, 0);
+		if (ret < 0) {
+			return -errno;
+		}
+
+		buf += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static void server_main(void *p1, void *p2, void *p3)
+{
+	int serv, sock;
+	ssize_t ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	serv = listen_on(IPPROTO_TLS_1_2, SERVER_PORT);
+	if (serv < 0) {
+		printk("server: cannot listen (%d)\n", serv);
+		return;
+	}
+
+	k_sem_give(&server_ready);
+
+	sock = zsock_accept(serv, NULL, NULL);
+	(void)zsock_close(serv);
+
+	if (sock < 0) {
+		printk("server: cannot accept (%d)\n", errno);
+		return;
+	}
+
+	while (true) {
+		ret = zsock_recv(sock, server_buf, sizeof(server_buf), 0);
+		if (ret <= 0) {
+			break;
+		}
+
+		if (atomic_add(&received, ret) + ret >= TOTAL_LEN) {
+			k_sem_give(&received_all);
+		}
+	}
+
+	(void)zsock_close(sock);
+}
+
+/* Count the application data records in the client to server stream */
+static void count_records(struct record_parser *parser, const uint8_t *data,
+			  size_t len)
+{
+	while (len > 0) {
+		if (parser->skip > 0) {
+			size_t skip = MIN(parser->skip, len);
+
+			parser->skip -= skip;
+			data += skip;
+			len -= skip;
+			continue;
+		}
+
+		parser->hdr[parser->hdr_len++] = *data++;
+		len--;
+
+		if (parser->hdr_len == TLS_RECORD_HDR_LEN) {
+			if (parser->hdr[0] == TLS_CONTENT_APP_DATA) {
+				atomic_inc(&records);
+			}
+
+			parser->skip = sys_get_be16(&parser->hdr[3]);
+			parser->hdr_len = 0;
+		}
+	}
+}
+
+static void relay_main(void *p1, void *p2, void *p3)
+{
+	struct record_parser parser = { 0 };
+	struct zsock_pollfd fds[2];
+	int serv, client, server;
+	ssize_t ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	serv = listen_on(IPPROTO_TCP, RELAY_PORT);
+	if (serv < 0) {
+		printk("relay: cannot listen (%d)\n", serv);
+		return;
+	}
+
+	k_sem_give(&relay_ready);
+
+	client = zsock_accept(serv, NULL, NULL);
+	(void)zsock_close(serv);
+
+	if (client < 0) {
+		printk("relay: cannot accept (%d)\n", errno);
+		return;
+	}
+
+	server = connect_to(IPPROTO_TCP, SERVER_PORT);
+	if (server < 0) {
+		printk("relay: cannot connect (%d)\n", server);
+		(void)zsock_close(client);
+		return;
+	}
+
+	fds[0].fd = client;
+	fds[1].fd = server;
+
+	while (true) {
+		fds[0].events = ZSOCK_POLLIN;
+		fds[1].events = ZSOCK_POLLIN;
+
+		if (zsock_poll(fds, ARRAY_SIZE(fds), -1) < 0) {
+			break;
+		}
+
+		if (fds[0].revents) {
+			ret = zsock_recv(client, relay_buf, sizeof(relay_buf), 0);
+			if (ret <= 0) {
+				break;
+			}
+
+			count_records(&parser, relay_buf, ret);
+
+			if (send_all(server, relay_buf, ret) < 0) {
+				break;
+			}
+		}
+
+		if (fds[1].revents) {
+			ret = zsock_recv(server, relay_buf, sizeof(relay_buf), 0);
+			if (ret <= 0 || send_all(client, relay_buf, ret) < 0) {
+				break;
+			}
+		}
+	}
+
+	(void)zsock_close(server);
+	(void)zsock_close(client);
+}
+
+static int bench_write_16(int sock)
+{
+	for (int i = 0; i < TOTAL_LEN / 16; i++) {
+		if (zsock_send(sock, client_buf, 16, 0) != 16) {
+			return -errno;
+		}
+	}
+
+	return 0;
+}
+
+static int bench_write_16_more(int sock)
+{
+	int flags;
+
+	for (int i = 0; i < TOTAL_LEN / 16; i++) {
+		flags = (i % 16 == 15) ? 0 : ZSOCK_MSG_MORE;
+
+		if (zsock_send(sock, client_buf, 16, flags) != 16) {
+			return -errno;
+		}
+	}
+
+	return 0;
+}
+
+static int bench_sendmsg_8x32(int sock)
+{
+	struct msghdr msg = { 0 };
+	struct iovec iov[8];
+
+	for (int i = 0; i < ARRAY_SIZE(iov); i++) {
+		iov[i].iov_base = &client_buf[i * 32];
+		iov[i].iov_len = 32;
+	}
+
+	msg.msg_iov = iov;
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+
+	for (int i = 0; i < TOTAL_LEN / 256; i++) {
+		if (zsock_sendmsg(sock, &msg, 0) != 256) {
+			return -errno;
+		}
+	}
+
+	return 0;
+}
+
+static int bench_write_4096(int sock)
+{
+	for (int i = 0; i < TOTAL_LEN / 4096; i++) {
+		if (send_all(sock, client_buf, 4096) < 0) {
+			return -errno;
+		}
+	}
+
+	return 0;
+}
+
+static void run_bench(const char *name, int (*bench)(int sock), int sock)
+{
+	int64_t start_ms, elapsed_ms;
+	uint32_t count;
+	int ret;
+
+	atomic_set(&records, 0);
+	atomic_set(&received, 0);
+	k_sem_reset(&received_all);
+
+	start_ms = k_uptime_get();
+
+	ret = bench(sock);
+	if (ret < 0) {
+		printk("%s: failed (%d)\n", name, ret);
+		return;
+	}
+
+	if (k_sem_take(&received_all, K_SECONDS(30)) < 0) {
+		printk("%s: data not received\n", name);
+		return;
+	}
+
+	elapsed_ms = MAX(k_uptime_get() - start_ms, 1);
+	count = MAX(atomic_get(&records), 1);
+
+	printk("%s: %u KiB/s, %u records/s, %u bytes/record\n", name,
+	       (uint32_t)(TOTAL_LEN * MSEC_PER_SEC / 1024 / elapsed_ms),
+	       (uint32_t)(count * MSEC_PER_SEC / elapsed_ms),
+	       TOTAL_LEN / count);
+}
+
+void main(void)
+{
+	int sock;
+
+	if (tls_credential_add(PSK_TAG, TLS_CREDENTIAL_PSK, psk,
+			       sizeof(psk)) < 0 ||
+	    tls_credential_add(PSK_TAG, TLS_CREDENTIAL_PSK_ID, psk_id,
+			       strlen(psk_id)) < 0) {
+		printk("Cannot add credentials\n");
+		return;
+	}
+
+	k_thread_create(&server_thread, server_stack,
+			K_THREAD_STACK_SIZEOF(server_stack), server_main,
+			NULL, NULL, NULL, THREAD_PRIO, 0, K_NO_WAIT);
+	k_sem_take(&server_ready, K_FOREVER);
+
+	k_thread_create(&relay_thread, relay_stack,
+			K_THREAD_STACK_SIZEOF(relay_stack), relay_main,
+			NULL, NULL, NULL, THREAD_PRIO, 0, K_NO_WAIT);
+	k_sem_take(&relay_ready, K_FOREVER);
+
+	/* The handshake is done while connecting */
+	sock = connect_to(IPPROTO_TLS_1_2, RELAY_PORT);
+	if (sock < 0) {
+		printk("Cannot connect (%d)\n", sock);
+		return;
+	}
+
+	run_bench("write_16", bench_write_16, sock);
+	run_bench("write_16_more", bench_write_16_more, sock);
+	run_bench("sendmsg_8x32", bench_sendmsg_8x32, sock);
+	run_bench("write_4096", bench_write_4096, sock);
+
+	(void)zsock_close(sock);
+
+	printk("fin\n");
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#define NUM_PAIRS CONFIG_MP_NUM_CPUS
+#define ROUNDS 100
+
+#define STACK_SIZE 1024
+
+struct pair {
+	struct k_sem ping;
+	struct k_sem pong;
+	uint32_t cycles;
+};
+
+static struct pair pairs[NUM_PAIRS];
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2 * NUM_PAIRS, STACK_SIZE);
+static struct k_thread threads[2 * NUM_PAIRS];
+
+static void ping(void *p1, void *p2, void *p3)
+{
+	struct pair *pair = p1;
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < ROUNDS; i++) {
+		k_sem_give(&pair->ping);
+		k_sem_take(&pair->pong, K_FOREVER);
+	}
+
+	pair->cycles = k_cycle_get_32() - start;
+}
+
+static void pong(void *p1, void *p2, void *p3)
+{
+	struct pair *pair = p1;
+
+	for (int i = 0; i < ROUNDS; i++) {
+		k_sem_take(&pair->ping, K_FOREVER);
+		k_sem_give(&pair->pong);
+	}
+}
+
+static void start(int idx, k_thread_entry_t entry, struct pair *pair,
+		  int cpu, int prio)
+{
+	k_thread_create(&threads[idx], stacks[idx], STACK_SIZE, entry, pair,
+			NULL, NULL, K_PRIO_PREEMPT(prio), 0, K_FOREVER);
+	k_thread_cpu_pin(&threads[idx], cpu);
+	k_thread_start(&threads[idx]);
+}
+
+static void run(int num_pairs)
+{
+	uint64_t cycles = 0;
+
+	for (int i = 0; i < num_pairs; i++) {
+		k_sem_init(&pairs[i].ping, 0, 1);
+		k_sem_init(&pairs[i].pong, 0, 1);
+
+		/* The waiting thread has the higher priority, so that each
+		 * give switches to it.
+		 */
+		start(2 * i + 1, pong, &pairs[i], i, 4);
+		start(2 * i, ping, &pairs[i], i, 5);
+	}
+
+	for (int i = 0; i < 2 * num_pairs; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	for (int i = 0; i < num_pairs; i++) {
+		cycles += pairs[i].cycles;
+	}
+
+	printk("%d pairs: %u cycles per context switch\n", num_pairs,
+	       (uint32_t)(cycles / (num_pairs * 2 * ROUNDS)));
+}
+
+void main(void)
+{
+	run(1);
+	run(NUM_PAIRS);
+
+	printk("fin\n");
+}
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/base64.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/websocket.h>
+
+#include <mbedtls/sha1.h>
+
+#define SERVER_PORT 8080
+#define PEER_STACK_SIZE 2048
+#define PEER_PRIO 7
+
+#define FRAME_LEN 4096
+#define FRAMES 256
+#define STREAM_PARTS 4
+
+/* Header of an unmasked frame with a 16 bit payload length */
+#define PEER_HDR_LEN 4
+/* Header of a masked frame with a 16 bit payload length */
+#define CLIENT_HDR_LEN 8
+
+#define WS_MAGIC "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+enum peer_cmd {
+	PEER_SINK,
+	PEER_SOURCE,
+};
+
+static K_THREAD_STACK_DEFINE(peer_stack, PEER_STACK_SIZE);
+static struct k_thread peer_thread;
+static K_SEM_DEFINE(peer_ready, 0, 1);
+static K_SEM_DEFINE(peer_start, 0, 1);
+static K_SEM_DEFINE(peer_done, 0, 1);
+static enum peer_cmd peer_cmd;
+
+static uint8_t peer_buf[PEER_HDR_LEN + FRAME_LEN];
+static uint8_t client_buf[FRAME_LEN];
+static uint8_t ws_tmp_buf[512];
+
+static int send_all(int sock, const uint8_t *buf, size_t len)
+{
+	ssize_t ret;
+
+	while (len > 0) {
+		ret = zsock_send(sock, buf, len, 0);
+		if (ret < 0) {
+			return -errno;
+		}
+
+		buf += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static int peer_handshake(int sock)
+{
+	static const char key_field[] = "Sec-WebSocket-Key: ";
+	char req[512];
+	char key[64];
+	char accept[32];
+	char rsp[160];
+	uint8_t sha1[20];
+	size_t len = 0, key_len, olen;
+	char *start, *end;
+	ssize_t ret;
+
+	do {
+		ret = zsock_recv(sock, req + len, sizeof(req) - len - 1, 0);
+		if (ret <= 0) {
+			return -EIO;
+		}
+
+		len += ret;
+		req[len] = '\0';
+	} while (strstr(req, "\r\n\r\n") == NULL);
+
+	start = strstr(req, key_field);
+	if (start == NULL) {
+		return -EINVAL;
+	}
+
+	start += sizeof(key_field) - 1;
+	end = strstr(start, "\r\n");
+	key_len = end - start;
+
+	if (key_len + sizeof(WS_MAGIC) > sizeof(key)) {
+		return -EMSGSIZE;
+	}
+
+	memcpy(key, start, key_len);
+	memcpy(key + key_len, WS_MAGIC, sizeof(WS_MAGIC) - 1);
+
+	mbedtls_sha1((const unsigned char *)key,
+		     key_len + sizeof(WS_MAGIC) - 1, sha1);
+
+	if (base64_encode((uint8_t *)accept, sizeof(accept), &olen, sha1,
+			  sizeof(sha1)) != 0) {
+		return -EINVAL;
+	}
+
+	len = snprintk(rsp, sizeof(rsp),
+		       "HTTP/1.1 101 Switching Protocols\r\n"
+		       "Upgrade: websocket\r\n"
+		       "Connection: Upgrade\r\n"
+		       "Sec-WebSocket-Accept: %s\r\n\r\n", accept);
+
+	return send_all(sock, (uint8_t *)rsp, len);
+}
+
+/* Discard the frames sent by the client, they are not parsed as the
+ * amount of data is known beforehand.
+ */
+static int peer_sink(int sock)
+{
+	size_t left = FRAMES * (CLIENT_HDR_LEN + FRAME_LEN);
+	ssize_t ret;
+
+	while (left > 0) {
+		ret = zsock_recv(sock, peer_buf, MIN(left, sizeof(peer_buf)), 0);
+		if (ret <= 0) {
+			return -EIO;
+		}
+
+		left -= ret;
+	}
+
+	return 0;
+}
+
+static int peer_source(int sock)
+{
+	int ret;
+
+	peer_buf[0] = 0x80 | WEBSOCKET_OPCODE_DATA_BINARY;
+	peer_buf[1] = 126;
+	sys_put_be16(FRAME_LEN, &peer_buf[2]);
+
+	for (int i = 0; i < FRAMES; i++) {
+		ret = send_all(sock, peer_buf, sizeof(peer_buf));
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void peer_main(void *p1, void *p2, void *p3)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+	};
+	int serv, sock, ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	serv = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (serv < 0 ||
+	    zsock_bind(serv, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    zsock_listen(serv, 1) < 0) {
+		printk("peer: cannot listen (%d)\n", errno);
+		return;
+	}
+
+	k_sem_give(&peer_ready);
+
+	sock = zsock_accept(serv, NULL, NULL);
+	(void)zsock_close(serv);
+
+	if (sock < 0) {
+		printk("peer: cannot accept (%d)\n", errno);
+		return;
+	}
+
+	ret = peer_handshake(sock);
+	if (ret < 0) {
+		printk("peer: handshake failed (%d)\n", ret);
+		goto out;
+	}
+
+	while (true) {
+		k_sem_take(&peer_start, K_FOREVER);
+
+		if (peer_cmd == PEER_SINK) {
+			ret = peer_sink(sock);
+		} else {
+			ret = peer_source(sock);
+		}
+
+		k_sem_give(&peer_done);
+
+		if (ret < 0) {
+			printk("peer: transfer failed (%d)\n", ret);
+			break;
+		}
+	}
+
+out:
+	(void)zsock_close(sock);
+}
+
+static int bench_send(int ws)
+{
+	int ret;
+
+	for (int i = 0; i < FRAMES; i++) {
+		ret = websocket_send_msg(ws, client_buf, FRAME_LEN,
+					 WEBSOCKET_OPCODE_DATA_BINARY, true,
+					 true, SYS_FOREVER_MS);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int bench_send_stream(int ws)
+{
+	struct iovec iov[STREAM_PARTS];
+	int ret;
+
+	for (int i = 0; i < FRAMES; i++) {
+		ret = websocket_send_frame_begin(ws, FRAME_LEN,
+						 WEBSOCKET_OPCODE_DATA_BINARY,
+						 true, true, SYS_FOREVER_MS);
+		if (ret < 0) {
+			return ret;
+		}
+
+		for (int j = 0; j < STREAM_PARTS; j++) {
+			iov[j].iov_base = &client_buf[j * FRAME_LEN / STREAM_PARTS];
+			iov[j].iov_len = FRAME_LEN / STREAM_PARTS;
+		}
+
+		ret = websocket_send_frame_data(ws, iov, STREAM_PARTS,
+						SYS_FOREVER_MS);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int bench_recv(int ws)
+{
+	size_t left = FRAMES * FRAME_LEN;
+	uint64_t remaining;
+	uint32_t type;
+	int ret;
+
+	while (left > 0) {
+		ret = websocket_recv_msg(ws, client_buf, sizeof(client_buf),
+					 &type, &remaining, SYS_FOREVER_MS);
+		if (ret == -EAGAIN) {
+			continue;
+		}
+
+		if (ret <= 0) {
+			return ret < 0 ? ret : -EIO;
+		}
+
+		left -= ret;
+	}
+
+	return 0;
+}
+
+static void run_bench(const char *name, int (*bench)(int ws), int ws,
+		      enum peer_cmd cmd)
+{
+	int64_t start_ms, elapsed_ms;
+	int ret;
+
+	peer_cmd = cmd;
+
+	start_ms = k_uptime_get();
+
+	k_sem_give(&peer_start);
+
+	ret = bench(ws);
+	if (ret < 0) {
+		printk("%s: failed (%d)\n", name, ret);
+		return;
+	}
+
+	k_sem_take(&peer_done, K_FOREVER);
+
+	elapsed_ms = MAX(k_uptime_get() - start_ms, 1);
+
+	printk("%s: %u frames of %u bytes, %u KiB/s\n", name, FRAMES,
+	       FRAME_LEN,
+	       (uint32_t)((uint64_t)FRAMES * FRAME_LEN * MSEC_PER_SEC /
+			  1024 / elapsed_ms));
+}
+
+void main(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+	};
+	struct websocket_request req = {
+		.host = "127.0.0.1",
+		.url = "/",
+		.tmp_buf = ws_tmp_buf,
+		.tmp_buf_len = sizeof(ws_tmp_buf),
+	};
+	int sock, ws;
+
+	k_thread_create(&peer_thread, peer_stack,
+			K_THREAD_STACK_SIZEOF(peer_stack), peer_main,
+			NULL, NULL, NULL, PEER_PRIO, 0, K_NO_WAIT);
+
+	k_sem_take(&peer_ready, K_FOREVER);
+
+	(void)zsock_inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0 ||
+	    zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		printk("Cannot connect (%d)\n", errno);
+		return;
+	}
+
+	ws = websocket_connect(sock, &req, 3 * MSEC_PER_SEC, NULL);
+	if (ws < 0) {
+		printk("Cannot establish websocket (%d)\n", ws);
+		(void)zsock_close(sock);
+		return;
+	}
+
+	run_bench("send", bench_send, ws, PEER_SINK);
+	run_bench("send_stream", bench_send_stream, ws, PEER_SINK);
+	run_bench("recv", bench_recv, ws, PEER_SOURCE);
+
+	(void)websocket_disconnect(ws);
+
+	printk("fin\n");
+}
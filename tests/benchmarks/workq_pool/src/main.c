@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#define NUM_SUBMITTERS CONFIG_MP_NUM_CPUS
+#define NUM_WORKERS CONFIG_MP_NUM_CPUS
+#define ITEMS_PER_SUBMITTER 64
+#define ROUNDS 500
+#define SPIN_COUNT 100
+
+#define STACK_SIZE 1024
+#define PRIO K_PRIO_PREEMPT(5)
+
+struct submitter;
+
+struct bench_item {
+	struct k_work work;
+	struct submitter *owner;
+};
+
+struct submitter {
+	struct k_thread thread;
+	struct k_work_q *queue;
+	struct bench_item items[ITEMS_PER_SUBMITTER];
+	/* Items of the current round not processed yet */
+	atomic_t left;
+	struct k_sem round_done;
+};
+
+static K_THREAD_STACK_DEFINE(single_stack, STACK_SIZE);
+static struct k_work_q single_queue;
+
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_work_q_worker pool_workers[NUM_WORKERS];
+static struct k_work_q pool_queue;
+
+static K_THREAD_STACK_ARRAY_DEFINE(submitter_stacks, NUM_SUBMITTERS,
+				   STACK_SIZE);
+static struct submitter submitters[NUM_SUBMITTERS];
+
+static void item_handler(struct k_work *work)
+{
+	struct bench_item *item = CONTAINER_OF(work, struct bench_item, work);
+	struct submitter *owner = item->owner;
+	volatile uint32_t spin = 0;
+
+	while (spin < SPIN_COUNT) {
+		spin++;
+	}
+
+	if (atomic_dec(&owner->left) == 1) {
+		k_sem_give(&owner->round_done);
+	}
+}
+
+static void submitter_main(void *p1, void *p2, void *p3)
+{
+	struct submitter *sub = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int round = 0; round < ROUNDS; round++) {
+		atomic_set(&sub->left, ITEMS_PER_SUBMITTER);
+
+		for (int i = 0; i < ITEMS_PER_SUBMITTER; i++) {
+			if (k_work_submit_to_queue(sub->queue,
+						   &sub->items[i].work) < 0) {
+				printk("submission failed\n");
+				return;
+			}
+		}
+
+		k_sem_take(&sub->round_done, K_FOREVER);
+	}
+}
+
+static void run_bench(const char *name, struct k_work_q *queue)
+{
+	const uint32_t total = NUM_SUBMITTERS * ITEMS_PER_SUBMITTER * ROUNDS;
+	int64_t start_ms, elapsed_ms;
+
+	for (int i = 0; i < NUM_SUBMITTERS; i++) {
+		struct submitter *sub = &submitters[i];
+
+		sub->queue = queue;
+		k_sem_init(&sub->round_done, 0, 1);
+
+		for (int j = 0; j < ITEMS_PER_SUBMITTER; j++) {
+			k_work_init(&sub->items[j].work, item_handler);
+			sub->items[j].owner = sub;
+		}
+	}
+
+	start_ms = k_uptime_get();
+
+	for (int i = 0; i < NUM_SUBMITTERS; i++) {
+		k_thread_create(&submitters[i].thread, submitter_stacks[i],
+				K_THREAD_STACK_SIZEOF(submitter_stacks[i]),
+				submitter_main, &submitters[i], NULL, NULL,
+				PRIO, 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < NUM_SUBMITTERS; i++) {
+		k_thread_join(&submitters[i].thread, K_FOREVER);
+	}
+
+	elapsed_ms = MAX(k_uptime_get() - start_ms, 1);
+
+	printk("%s: %u items in %u ms, %u items/s\n", name, total,
+	       (uint32_t)elapsed_ms,
+	       (uint32_t)((uint64_t)total * MSEC_PER_SEC / elapsed_ms));
+}
+
+void main(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "bench_pool",
+		.pin_workers = IS_ENABLED(CONFIG_SCHED_CPU_MASK),
+	};
+
+	k_work_queue_start(&single_queue, single_stack,
+			   K_THREAD_STACK_SIZEOF(single_stack), PRIO, NULL);
+	k_work_queue_pool_start(&pool_queue, pool_workers, NUM_WORKERS,
+				pool_stacks[0], STACK_SIZE, PRIO, &cfg);
+
+	run_bench("single", &single_queue);
+	run_bench("pool", &pool_queue);
+
+	printk("fin\n");
+}
@@ -83,6 +83,12 @@ void k_sys_fatal_error_handler(unsigned int reason, const z_arch_esf_t *pEsf)
 #define HALF_BYTES	(HALF_PAGES * CONFIG_MMU_PAGE_SIZE)
 static const char *nums = "0123456789";
 
+/* Faults taken to touch paged out pages in sequence, with the following
+ * pages paged in ahead of each fault.
+ */
+#define SEQ_FAULTS(pages) \
+	DIV_ROUND_UP(pages, 1 + CONFIG_DEMAND_PAGING_FAULT_AHEAD)
+
 void test_map_anon_pages(void)
 {
 	arena_size = k_mem_free_get() + HALF_BYTES;
@@ -111,6 +117,16 @@ void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *scope)
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+	printk("* Fault-ahead (%s):\n", scope);
+	printk("    - Pages paged in ahead: %lu\n", stats->fault_ahead.cnt);
+	printk("    - Accessed: %lu\n", stats->fault_ahead.hits);
+	printk("    - Evicted unaccessed: %lu\n", stats->fault_ahead.misses);
+	if (stats->fault_ahead.hits + stats->fault_ahead.misses != 0UL) {
+		printk("    - Hit rate: %lu%%\n",
+		       stats->fault_ahead.hits * 100UL /
+		       (stats->fault_ahead.hits + stats->fault_ahead.misses));
+	}
 }
 
 void test_touch_anon_pages(void)
@@ -194,6 +210,9 @@ void test_k_mem_page_out(void)
 {
 	unsigned long faults;
 	int key, ret;
+#if CONFIG_DEMAND_PAGING_FAULT_AHEAD > 0
+	struct k_mem_paging_stats_t stats;
+#endif
 
 	/* Lock IRQs to prevent other pagefaults from happening while we
 	 * are measuring stuff
@@ -210,13 +229,22 @@ void test_k_mem_page_out(void)
 	faults = z_num_pagefaults_get() - faults;
 	irq_unlock(key);
 
-	zassert_equal(faults, HALF_PAGES,
+	zassert_equal(faults, SEQ_FAULTS(HALF_PAGES),
 		      "unexpected num pagefaults expected %lu got %d",
-		      HALF_PAGES, faults);
+		      SEQ_FAULTS(HALF_PAGES), faults);
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
 
+#if CONFIG_DEMAND_PAGING_FAULT_AHEAD > 0
+	/* The pages paged in ahead were written, and then evicted */
+	k_mem_paging_stats_get(&stats);
+	zassert_not_equal(stats.fault_ahead.cnt, 0UL,
+			  "no page paged in ahead");
+	zassert_not_equal(stats.fault_ahead.hits, 0UL,
+			  "no page paged in ahead accessed");
+#endif
+
 }
 
 void test_k_mem_page_in(void)
@@ -401,6 +429,12 @@ void test_user_get_hist(void)
 	zassert_true(print_histogram(&hist),
 		     "should have non-zero counts in histogram.");
 	printk("\n");
+
+	printk("Page Fault Histogram:\n");
+	k_mem_paging_histogram_page_fault_get(&hist);
+	zassert_true(print_histogram(&hist),
+		     "should have non-zero counts in histogram.");
+	printk("\n");
 }
 
 /* ztest main entry*/
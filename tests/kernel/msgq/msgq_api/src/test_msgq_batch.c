@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 8
+
+static struct k_msgq bmsgq;
+static char __aligned(4) bbuffer[BATCH_LEN * sizeof(uint32_t)];
+static K_THREAD_STACK_DEFINE(bstack, STACK_SIZE);
+static struct k_thread bdata;
+
+static void fill(uint32_t *msgs, uint32_t count, uint32_t first)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		msgs[i] = first + i;
+	}
+}
+
+static void check(const uint32_t *msgs, uint32_t count, uint32_t first)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_equal(msgs[i], first + i, "message %u", i);
+	}
+}
+
+/**
+ * @brief Test sending and receiving several messages at once
+ *
+ * @details Messages wrap around the end of the ring buffer, and a batch
+ * larger than the free space is partially sent.
+ *
+ * @ingroup kernel_message_queue_tests
+ *
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+void test_msgq_put_get_many(void)
+{
+	uint32_t tx[BATCH_LEN + 2], rx[BATCH_LEN + 2];
+
+	k_msgq_init(&bmsgq, bbuffer, sizeof(uint32_t), BATCH_LEN);
+
+	/* Move the ring pointers away from the start of the buffer */
+	fill(tx, 3, 0);
+	zassert_equal(k_msgq_put_many(&bmsgq, tx, 3, K_NO_WAIT), 3, NULL);
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, 3, K_NO_WAIT), 3, NULL);
+	check(rx, 3, 0);
+
+	/* Only the free space is used */
+	fill(tx, BATCH_LEN + 2, 100);
+	zassert_equal(k_msgq_put_many(&bmsgq, tx, BATCH_LEN + 2, K_NO_WAIT),
+		      BATCH_LEN, NULL);
+	zassert_equal(k_msgq_num_used_get(&bmsgq), BATCH_LEN, NULL);
+	zassert_equal(k_msgq_put_many(&bmsgq, tx, 1, K_NO_WAIT), -ENOMSG,
+		      NULL);
+
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, BATCH_LEN + 2, K_NO_WAIT),
+		      BATCH_LEN, NULL);
+	check(rx, BATCH_LEN, 100);
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, 1, K_NO_WAIT), -ENOMSG,
+		      NULL);
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, 1, TIMEOUT), -EAGAIN, NULL);
+}
+
+static void put_later(void *p1, void *p2, void *p3)
+{
+	uint32_t tx[2];
+
+	k_sleep(TIMEOUT);
+
+	fill(tx, 2, 200);
+	zassert_equal(k_msgq_put_many(&bmsgq, tx, 2, K_NO_WAIT), 2, NULL);
+}
+
+/**
+ * @brief Test that a receiver waiting for several messages gets the first
+ * one sent
+ *
+ * @ingroup kernel_message_queue_tests
+ *
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+void test_msgq_get_many_pend(void)
+{
+	uint32_t rx[BATCH_LEN];
+
+	k_msgq_init(&bmsgq, bbuffer, sizeof(uint32_t), BATCH_LEN);
+
+	k_thread_create(&bdata, bstack, STACK_SIZE, put_later, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, BATCH_LEN, K_FOREVER), 1,
+		      NULL);
+	zassert_equal(rx[0], 200, NULL);
+
+	k_thread_join(&bdata, K_FOREVER);
+
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, BATCH_LEN, K_NO_WAIT), 1,
+		      NULL);
+	zassert_equal(rx[0], 201, NULL);
+}
+
+/**
+ * @brief Test writing and reading messages in place
+ *
+ * @details Reserved slots and peeked messages are consecutive, so they
+ * stop at the end of the ring buffer.  Other send and receive operations
+ * are rejected while slots are accessed in place.
+ *
+ * @ingroup kernel_message_queue_tests
+ *
+ * @see k_msgq_reserve(), k_msgq_commit(), k_msgq_peek_slots(),
+ * k_msgq_release()
+ */
+void test_msgq_zero_copy(void)
+{
+	uint32_t *slots, msg = 0, rx[BATCH_LEN] = { 0 };
+
+	k_msgq_init(&bmsgq, bbuffer, sizeof(uint32_t), BATCH_LEN);
+
+	zassert_equal(k_msgq_commit(&bmsgq, 1), -EINVAL, NULL);
+	zassert_equal(k_msgq_release(&bmsgq, 1), -EINVAL, NULL);
+
+	/* Start writing at slot 5, so that the ring wraps after 3 slots */
+	zassert_equal(k_msgq_put_many(&bmsgq, rx, 5, K_NO_WAIT), 5, NULL);
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, 5, K_NO_WAIT), 5, NULL);
+
+	zassert_equal(k_msgq_reserve(&bmsgq, (void **)&slots, BATCH_LEN,
+				     K_NO_WAIT), 3, NULL);
+	zassert_equal_ptr(slots, &bbuffer[5 * sizeof(uint32_t)], NULL);
+	zassert_equal(k_msgq_num_free_get(&bmsgq), BATCH_LEN - 3, NULL);
+	zassert_equal(k_msgq_reserve(&bmsgq, (void **)&slots, 1, K_NO_WAIT),
+		      -EBUSY, NULL);
+	zassert_equal(k_msgq_put(&bmsgq, &msg, K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_msgq_put_many(&bmsgq, &msg, 1, K_NO_WAIT), -EBUSY,
+		      NULL);
+
+	/* Send two of the three reserved slots */
+	fill(slots, 2, 300);
+	zassert_equal(k_msgq_commit(&bmsgq, 2), 0, NULL);
+	zassert_equal(k_msgq_num_used_get(&bmsgq), 2, NULL);
+	zassert_equal(k_msgq_num_free_get(&bmsgq), BATCH_LEN - 2, NULL);
+
+	zassert_equal(k_msgq_reserve(&bmsgq, (void **)&slots, BATCH_LEN,
+				     K_NO_WAIT), 1, NULL);
+	fill(slots, 1, 302);
+	zassert_equal(k_msgq_commit(&bmsgq, 1), 0, NULL);
+
+	zassert_equal(k_msgq_reserve(&bmsgq, (void **)&slots, BATCH_LEN,
+				     K_NO_WAIT), 5, NULL);
+	zassert_equal_ptr(slots, bbuffer, NULL);
+	fill(slots, 5, 303);
+	zassert_equal(k_msgq_commit(&bmsgq, 5), 0, NULL);
+
+	zassert_equal(k_msgq_reserve(&bmsgq, (void **)&slots, 1, K_NO_WAIT),
+		      -ENOMSG, NULL);
+
+	/* Peeked messages stop at the end of the buffer too */
+	zassert_equal(k_msgq_peek_slots(&bmsgq, (void **)&slots, BATCH_LEN,
+					K_NO_WAIT), 3, NULL);
+	check(slots, 3, 300);
+	zassert_equal(k_msgq_peek_slots(&bmsgq, (void **)&slots, 1,
+					K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_msgq_get(&bmsgq, &msg, K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_msgq_release(&bmsgq, 4), -EINVAL, NULL);
+	zassert_equal(k_msgq_release(&bmsgq, 3), 0, NULL);
+
+	zassert_equal(k_msgq_peek_slots(&bmsgq, (void **)&slots, 2,
+					K_NO_WAIT), 2, NULL);
+	check(slots, 2, 303);
+	zassert_equal(k_msgq_release(&bmsgq, 1), 0, NULL);
+
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, BATCH_LEN, K_NO_WAIT), 4,
+		      NULL);
+	check(rx, 4, 304);
+
+	zassert_equal(k_msgq_peek_slots(&bmsgq, (void **)&slots, 1, TIMEOUT),
+		      -EAGAIN, NULL);
+}
+
+static void commit_later(void *p1, void *p2, void *p3)
+{
+	uint32_t *slots;
+
+	k_sleep(TIMEOUT);
+
+	zassert_equal(k_msgq_reserve(&bmsgq, (void **)&slots, 1, K_NO_WAIT),
+		      1, NULL);
+	*slots = 400;
+	zassert_equal(k_msgq_commit(&bmsgq, 1), 0, NULL);
+}
+
+/**
+ * @brief Test that a receiver waiting for messages gets a message
+ * committed in place
+ *
+ * @ingroup kernel_message_queue_tests
+ *
+ * @see k_msgq_reserve(), k_msgq_commit(), k_msgq_peek_slots()
+ */
+void test_msgq_zero_copy_pend(void)
+{
+	uint32_t *slots, msg;
+
+	k_msgq_init(&bmsgq, bbuffer, sizeof(uint32_t), BATCH_LEN);
+
+	k_thread_create(&bdata, bstack, STACK_SIZE, commit_later, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_msgq_get(&bmsgq, &msg, K_FOREVER), 0, NULL);
+	zassert_equal(msg, 400, NULL);
+	k_thread_join(&bdata, K_FOREVER);
+
+	k_thread_create(&bdata, bstack, STACK_SIZE, commit_later, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_msgq_peek_slots(&bmsgq, (void **)&slots, BATCH_LEN,
+					K_FOREVER), 1, NULL);
+	zassert_equal(*slots, 400, NULL);
+	zassert_equal(k_msgq_release(&bmsgq, 1), 0, NULL);
+	k_thread_join(&bdata, K_FOREVER);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Much shorter than CONFIG_MUTEX_SPIN_CYCLES */
+#define HOLD_CYCLES (CONFIG_MUTEX_SPIN_CYCLES / 20)
+
+static K_MUTEX_DEFINE(mutex);
+static K_THREAD_STACK_DEFINE(owner_stack, STACK_SIZE);
+static struct k_thread owner_thread;
+
+static volatile bool owner_locked;
+static volatile bool owner_hold;
+
+static void busy_wait_cycles(uint32_t cycles)
+{
+	uint32_t start = k_cycle_get_32();
+
+	while (k_cycle_get_32() - start < cycles) {
+	}
+}
+
+/* Holds the mutex while running, without ever being switched out */
+static void owner(void *p1, void *p2, void *p3)
+{
+	uint32_t hold = POINTER_TO_UINT(p1);
+
+	zassert_equal(k_mutex_lock(&mutex, K_FOREVER), 0, NULL);
+	owner_locked = true;
+
+	if (hold != 0U) {
+		busy_wait_cycles(hold);
+	} else {
+		while (owner_hold) {
+		}
+	}
+
+	zassert_equal(k_mutex_unlock(&mutex), 0, NULL);
+}
+
+static void start_owner(uint32_t hold)
+{
+	owner_locked = false;
+	owner_hold = true;
+
+	k_thread_create(&owner_thread, owner_stack, STACK_SIZE, owner,
+			UINT_TO_POINTER(hold), NULL, NULL,
+			K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	while (!owner_locked) {
+	}
+}
+
+/* A mutex released quickly by a thread running on another CPU is taken
+ * while spinning.
+ */
+static void test_mutex_spin_acquired(void)
+{
+	struct k_mutex_spin_stats stats;
+
+	k_mutex_spin_stats_get(&stats, true);
+
+	start_owner(HOLD_CYCLES);
+	zassert_equal(k_mutex_lock(&mutex, K_FOREVER), 0, NULL);
+	zassert_equal(mutex.owner, _current, NULL);
+	zassert_equal(k_mutex_unlock(&mutex), 0, NULL);
+	k_thread_join(&owner_thread, K_FOREVER);
+
+	k_mutex_spin_stats_get(&stats, false);
+	zassert_equal(stats.spins, 1, NULL);
+	zassert_equal(stats.acquired, 1, NULL);
+	zassert_true(stats.cycles > 0, NULL);
+}
+
+/* Spinning is bounded: a thread keeping the mutex longer than that makes
+ * the caller pend, and the timeout still applies.
+ */
+static void test_mutex_spin_bounded(void)
+{
+	struct k_mutex_spin_stats stats;
+
+	k_mutex_spin_stats_get(&stats, true);
+
+	start_owner(0U);
+	zassert_equal(k_mutex_lock(&mutex, K_MSEC(10)), -EAGAIN, NULL);
+	owner_hold = false;
+	k_thread_join(&owner_thread, K_FOREVER);
+
+	k_mutex_spin_stats_get(&stats, true);
+	zassert_equal(stats.spins, 1, NULL);
+	zassert_equal(stats.acquired, 0, NULL);
+
+	/* Nothing to spin on when the mutex is free */
+	zassert_equal(k_mutex_lock(&mutex, K_FOREVER), 0, NULL);
+	zassert_equal(k_mutex_unlock(&mutex), 0, NULL);
+	k_mutex_spin_stats_get(&stats, false);
+	zassert_equal(stats.spins, 0, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(mutex_spin,
+			 ztest_unit_test(test_mutex_spin_acquired),
+			 ztest_unit_test(test_mutex_spin_bounded));
+	ztest_run_test_suite(mutex_spin);
+}
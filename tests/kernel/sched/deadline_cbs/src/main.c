@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/zephyr.h>
+#include <ztest.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PRIORITY K_LOWEST_APPLICATION_THREAD_PRIO
+#define RUN_MS 200
+
+struct k_thread hog_thread, peer_thread;
+K_THREAD_STACK_DEFINE(hog_stack, STACK_SIZE);
+K_THREAD_STACK_DEFINE(peer_stack, STACK_SIZE);
+
+volatile bool done;
+volatile uint32_t hog_spins, peer_spins;
+
+void spinner(void *p1, void *p2, void *p3)
+{
+	volatile uint32_t *spins = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!done) {
+		(*spins)++;
+	}
+}
+
+static uint32_t period_cycles(void)
+{
+	/* 10 ms */
+	return sys_clock_hw_cycles_per_sec() / 100U;
+}
+
+/**
+ * @brief Test budgets are checked
+ *
+ * @ingroup kernel_sched_tests
+ *
+ * @see k_thread_deadline_budget_set()
+ */
+void test_cbs_invalid(void)
+{
+	zassert_equal(k_thread_deadline_budget_set(k_current_get(), 1, 0),
+		      -EINVAL, NULL);
+	zassert_equal(k_thread_deadline_budget_set(k_current_get(), 2, 1),
+		      -EINVAL, NULL);
+	zassert_equal(k_thread_deadline_budget_set(k_current_get(), 0, 0),
+		      0, NULL);
+}
+
+/**
+ * @brief Test a thread overrunning its budget lets its peer run
+ *
+ * Booting with budgets enabled also switches from the dummy threads the
+ * kernel starts each CPU with, which have no budget.
+ *
+ * @ingroup kernel_sched_tests
+ *
+ * @see k_thread_deadline_budget_set(), k_thread_deadline_overruns_get()
+ */
+void test_cbs_overrun(void)
+{
+	uint32_t period = period_cycles();
+	k_tid_t hog, peer;
+
+	hog = k_thread_create(&hog_thread, hog_stack, STACK_SIZE, spinner,
+			      (void *)&hog_spins, NULL, NULL, PRIORITY, 0,
+			      K_FOREVER);
+	peer = k_thread_create(&peer_thread, peer_stack, STACK_SIZE, spinner,
+			       (void *)&peer_spins, NULL, NULL, PRIORITY, 0,
+			       K_FOREVER);
+
+	zassert_equal(k_thread_deadline_budget_set(hog, period / 4U, period),
+		      0, NULL);
+	/* The peer is only reached once the hog is throttled */
+	k_thread_deadline_set(peer, 4 * period);
+
+	k_thread_start(hog);
+	k_thread_start(peer);
+
+	k_msleep(RUN_MS);
+	done = true;
+
+	zassert_ok(k_thread_join(hog, K_FOREVER), NULL);
+	zassert_ok(k_thread_join(peer, K_FOREVER), NULL);
+
+	zassert_true(hog_spins > 0U, "budgeted thread did not run");
+	zassert_true(peer_spins > 0U, "peer of budgeted thread did not run");
+	zassert_true(k_thread_deadline_overruns_get(hog) > 0U,
+		     "budget never overrun");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(suite_deadline_cbs,
+			 ztest_unit_test(test_cbs_invalid),
+			 ztest_unit_test(test_cbs_overrun));
+	ztest_run_test_suite(suite_deadline_cbs);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define LAX_DURATION_MS 20
+#define LAX_SLACK_MS 50
+#define STRICT_DURATION_MS 40
+
+static K_TIMER_DEFINE(lax_timer, NULL, NULL);
+static K_TIMER_DEFINE(strict_timer, NULL, NULL);
+
+static int64_t expiry_ticks(struct k_timer *timer)
+{
+	int64_t start = k_uptime_ticks();
+
+	zassert_equal(k_timer_status_sync(timer), 1, NULL);
+
+	return k_uptime_ticks() - start;
+}
+
+/* A timer with slack expires together with a timer due within its slack,
+ * in the same system timer interrupt.
+ */
+static void test_timer_slack_coalesce(void)
+{
+	struct k_timeout_slack_stats stats;
+	int64_t strict_ticks;
+
+	k_timer_slack_set(&lax_timer, K_MSEC(LAX_SLACK_MS));
+
+	k_usleep(1);
+	k_timeout_slack_stats_get(&stats, true);
+
+	k_timer_start(&lax_timer, K_MSEC(LAX_DURATION_MS), K_NO_WAIT);
+	k_timer_start(&strict_timer, K_MSEC(STRICT_DURATION_MS), K_NO_WAIT);
+
+	strict_ticks = expiry_ticks(&strict_timer);
+	zassert_true(strict_ticks >= k_ms_to_ticks_floor64(STRICT_DURATION_MS),
+		     "strict timer expired early");
+	zassert_equal(k_timer_status_get(&lax_timer), 1,
+		      "lax timer did not expire with the strict timer");
+
+	k_timeout_slack_stats_get(&stats, false);
+	zassert_true(stats.wakeups >= 1, NULL);
+	zassert_true(stats.saved >= 1, NULL);
+}
+
+/* Without any other timeout, a timer with slack is delayed by at most its
+ * slack.
+ */
+static void test_timer_slack_bounded(void)
+{
+	int64_t ticks;
+
+	k_timer_slack_set(&lax_timer, K_MSEC(LAX_SLACK_MS));
+
+	k_usleep(1);
+	k_timer_start(&lax_timer, K_MSEC(LAX_DURATION_MS), K_NO_WAIT);
+	ticks = expiry_ticks(&lax_timer);
+
+	zassert_true(ticks >= k_ms_to_ticks_floor64(LAX_DURATION_MS),
+		     "timer expired early");
+	zassert_true(ticks <= k_ms_to_ticks_ceil64(LAX_DURATION_MS +
+						   LAX_SLACK_MS) + 2,
+		     "timer delayed beyond its slack");
+
+	k_timer_slack_set(&lax_timer, K_NO_WAIT);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(timer_slack,
+			 ztest_unit_test(test_timer_slack_coalesce),
+			 ztest_unit_test(test_timer_slack_bounded));
+	ztest_run_test_suite(timer_slack);
+}
@@ -539,6 +539,81 @@ void test_thread_stats_usage(void)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+#define HIST_SLEEPS 10
+
+/**
+ * @brief Helper thread to test_thread_stats_histogram()
+ */
+void helper_sleep(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < HIST_SLEEPS; i++) {
+		k_sleep(K_TICKS(1));
+	}
+}
+
+static uint32_t hist_sum(const struct k_cycle_hist *hist)
+{
+	uint32_t sum = 0;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS; i++) {
+		sum += hist->count[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Test the scheduling latency histograms
+ *
+ * A helper thread sleeps repeatedly. Each time it is woken up by the
+ * timer interrupt, which should be counted in its ready to running and
+ * ISR to running histograms, and each time it runs until it sleeps again.
+ */
+void test_thread_stats_histogram(void)
+{
+	k_tid_t  tid;
+	k_thread_runtime_stats_t  helper_stats;
+	k_thread_runtime_stats_t  cpu_stats1;
+	k_thread_runtime_stats_t  cpu_stats2;
+
+	zassert_equal(k_thread_runtime_stats_cpu_get(CONFIG_MP_NUM_CPUS,
+						     &cpu_stats1),
+		      -EINVAL, NULL);
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats1);
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper_sleep, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(2), 0, K_NO_WAIT);
+
+	k_thread_join(tid, K_FOREVER);
+
+	k_thread_runtime_stats_get(tid, &helper_stats);
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats2);
+
+	/* Started once, then woken up by the timer after each sleep */
+
+	zassert_true(hist_sum(&helper_stats.ready_latency) >= HIST_SLEEPS + 1,
+		     NULL);
+	zassert_true(hist_sum(&helper_stats.isr_latency) >= HIST_SLEEPS,
+		     NULL);
+	zassert_true(hist_sum(&helper_stats.run_length) >= HIST_SLEEPS,
+		     NULL);
+
+	zassert_true(hist_sum(&cpu_stats2.ready_latency) >=
+		     hist_sum(&cpu_stats1.ready_latency) + HIST_SLEEPS + 1,
+		     NULL);
+	zassert_true(hist_sum(&cpu_stats2.isr_latency) >=
+		     hist_sum(&cpu_stats1.isr_latency) + HIST_SLEEPS,
+		     NULL);
+}
+#else
+void test_thread_stats_histogram(void)
+{
+}
+#endif
+
 /**
  * @brief - main entry point for thread runtime statistics (usage) test
  */
@@ -548,7 +623,8 @@ void test_main(void)
 		 ztest_1cpu_unit_test(test_all_stats_usage),
 		 ztest_1cpu_unit_test(test_thread_stats_enable_disable),
 		 ztest_1cpu_unit_test(test_sys_stats_enable_disable),
-		 ztest_1cpu_unit_test(test_thread_stats_usage)
+		 ztest_1cpu_unit_test(test_thread_stats_usage),
+		 ztest_1cpu_unit_test(test_thread_stats_histogram)
 		 );
 	ztest_run_test_suite(usage_api);
 }
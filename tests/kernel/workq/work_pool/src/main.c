@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define NUM_WORKERS 3
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIORITY K_PRIO_PREEMPT(1)
+#define NUM_ITEMS 16
+
+#define DELAY_MS 50
+#define DELAY_TIMEOUT K_MSEC(DELAY_MS)
+
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_work_q_worker pool_workers[NUM_WORKERS];
+static struct k_work_q pool;
+
+static K_THREAD_STACK_DEFINE(helper_stack, STACK_SIZE);
+static struct k_thread helper_thread;
+
+static struct k_work items[NUM_ITEMS];
+static struct k_work blocking;
+static struct k_work_delayable dwork;
+
+/* Work synchronization objects must be in cache-coherent memory,
+ * which excludes stacks on some architectures.
+ */
+static struct k_work_sync work_sync;
+
+/* Given by the blocking handler when it starts, and by the test to
+ * release it.
+ */
+static K_SEM_DEFINE(started_sem, 0, NUM_ITEMS);
+static K_SEM_DEFINE(rel_sem, 0, NUM_ITEMS);
+static K_SEM_DEFINE(done_sem, 0, NUM_ITEMS);
+
+static atomic_t run_count;
+static atomic_t active;
+static atomic_t max_active;
+
+static bool is_pool_thread(k_tid_t thread)
+{
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		if (thread == &pool_workers[i].thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void count_handler(struct k_work *work)
+{
+	zassert_true(is_pool_thread(k_current_get()), "not run by the pool");
+
+	atomic_inc(&run_count);
+	k_sem_give(&done_sem);
+}
+
+static void blocking_handler(struct k_work *work)
+{
+	atomic_val_t now = atomic_inc(&active) + 1;
+
+	if (now > atomic_get(&max_active)) {
+		atomic_set(&max_active, now);
+	}
+
+	k_sem_give(&started_sem);
+	k_sem_take(&rel_sem, K_FOREVER);
+
+	atomic_inc(&run_count);
+	atomic_dec(&active);
+	k_sem_give(&done_sem);
+}
+
+static void release_after_delay(void *p1, void *p2, void *p3)
+{
+	k_sleep(DELAY_TIMEOUT);
+	k_sem_give(&rel_sem);
+}
+
+static void reset_state(void)
+{
+	atomic_set(&run_count, 0);
+	atomic_set(&active, 0);
+	atomic_set(&max_active, 0);
+	k_sem_reset(&started_sem);
+	k_sem_reset(&rel_sem);
+	k_sem_reset(&done_sem);
+}
+
+static void test_pool_start(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "wq.pool",
+		.pin_workers = IS_ENABLED(CONFIG_SCHED_CPU_MASK),
+	};
+
+	k_work_queue_init(&pool);
+	k_work_queue_pool_start(&pool, pool_workers, NUM_WORKERS,
+				pool_stacks[0], STACK_SIZE, WORKER_PRIORITY,
+				&cfg);
+
+	zassert_equal(k_work_queue_drain(&pool, false), 0, NULL);
+}
+
+/* Every submitted item runs once, on one of the pool threads. */
+static void test_pool_submit(void)
+{
+	reset_state();
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], count_handler);
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i]), 1, NULL);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_sem_take(&done_sem, K_SECONDS(1)), 0, NULL);
+	}
+
+	zassert_equal(k_work_queue_drain(&pool, false), 0, NULL);
+	zassert_equal(atomic_get(&run_count), NUM_ITEMS, NULL);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_busy_get(&items[i]), 0, NULL);
+	}
+}
+
+/* An item submitted while it is running is not picked up by an idle
+ * worker until the first invocation completes.
+ */
+static void test_pool_not_reentrant(void)
+{
+	reset_state();
+	k_work_init(&blocking, blocking_handler);
+
+	zassert_equal(k_work_submit_to_queue(&pool, &blocking), 1, NULL);
+	zassert_equal(k_sem_take(&started_sem, K_SECONDS(1)), 0, NULL);
+
+	/* Running, so it is queued to the worker running it. */
+	zassert_equal(k_work_submit_to_queue(&pool, &blocking), 2, NULL);
+	zassert_equal(k_work_busy_get(&blocking),
+		      K_WORK_RUNNING | K_WORK_QUEUED, NULL);
+
+	/* Idle workers must leave it alone. */
+	zassert_equal(k_sem_take(&started_sem, DELAY_TIMEOUT), -EAGAIN, NULL);
+
+	k_sem_give(&rel_sem);
+	zassert_equal(k_sem_take(&started_sem, K_SECONDS(1)), 0, NULL);
+	k_sem_give(&rel_sem);
+
+	zassert_equal(k_work_queue_drain(&pool, false), 0, NULL);
+	zassert_equal(atomic_get(&run_count), 2, NULL);
+	zassert_equal(atomic_get(&max_active), 1, NULL);
+}
+
+/* Distinct items run concurrently on distinct workers. */
+static void test_pool_concurrent(void)
+{
+	reset_state();
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_init(&items[i], blocking_handler);
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i]), 1, NULL);
+	}
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_equal(k_sem_take(&started_sem, K_SECONDS(1)), 0, NULL);
+	}
+
+	zassert_equal(atomic_get(&active), NUM_WORKERS, NULL);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_sem_give(&rel_sem);
+	}
+
+	zassert_equal(k_work_queue_drain(&pool, false), 0, NULL);
+	zassert_equal(atomic_get(&run_count), NUM_WORKERS, NULL);
+}
+
+/* Flushing a running item waits for it to complete even though other
+ * workers are idle.
+ */
+static void test_pool_running_flush(void)
+{
+	reset_state();
+	k_work_init(&blocking, blocking_handler);
+
+	zassert_equal(k_work_submit_to_queue(&pool, &blocking), 1, NULL);
+	zassert_equal(k_sem_take(&started_sem, K_SECONDS(1)), 0, NULL);
+
+	k_thread_create(&helper_thread, helper_stack,
+			K_THREAD_STACK_SIZEOF(helper_stack),
+			release_after_delay, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(2), 0, K_NO_WAIT);
+
+	zassert_true(k_work_flush(&blocking, &work_sync), NULL);
+	zassert_equal(atomic_get(&run_count), 1, NULL);
+	zassert_equal(k_work_busy_get(&blocking), 0, NULL);
+
+	k_thread_join(&helper_thread, K_FOREVER);
+}
+
+/* Cancelling a running item waits for it to complete. */
+static void test_pool_running_cancel_sync(void)
+{
+	reset_state();
+	k_work_init(&blocking, blocking_handler);
+
+	zassert_equal(k_work_submit_to_queue(&pool, &blocking), 1, NULL);
+	zassert_equal(k_sem_take(&started_sem, K_SECONDS(1)), 0, NULL);
+	zassert_equal(k_work_submit_to_queue(&pool, &blocking), 2, NULL);
+
+	k_thread_create(&helper_thread, helper_stack,
+			K_THREAD_STACK_SIZEOF(helper_stack),
+			release_after_delay, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(2), 0, K_NO_WAIT);
+
+	/* The queued instance is removed, the running one completes. */
+	zassert_true(k_work_cancel_sync(&blocking, &work_sync), NULL);
+	zassert_equal(atomic_get(&run_count), 1, NULL);
+	zassert_equal(k_work_busy_get(&blocking), 0, NULL);
+
+	k_thread_join(&helper_thread, K_FOREVER);
+}
+
+static void test_pool_delayable(void)
+{
+	reset_state();
+	k_work_init_delayable(&dwork, count_handler);
+
+	zassert_equal(k_work_schedule_for_queue(&pool, &dwork, DELAY_TIMEOUT),
+		      1, NULL);
+	zassert_equal(k_sem_take(&done_sem, K_SECONDS(1)), 0, NULL);
+	zassert_equal(atomic_get(&run_count), 1, NULL);
+}
+
+static void test_pool_plugged_drain(void)
+{
+	reset_state();
+	k_work_init(&items[0], count_handler);
+
+	zassert_equal(k_work_queue_drain(&pool, true), 0, NULL);
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), -EBUSY, NULL);
+	zassert_equal(k_work_queue_unplug(&pool), 0, NULL);
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 1, NULL);
+	zassert_equal(k_sem_take(&done_sem, K_SECONDS(1)), 0, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(work_pool,
+			 ztest_unit_test(test_pool_start),
+			 ztest_unit_test(test_pool_submit),
+			 ztest_unit_test(test_pool_not_reentrant),
+			 ztest_unit_test(test_pool_concurrent),
+			 ztest_unit_test(test_pool_running_flush),
+			 ztest_unit_test(test_pool_running_cancel_sync),
+			 ztest_unit_test(test_pool_delayable),
+			 ztest_unit_test(test_pool_plugged_drain));
+	ztest_run_test_suite(work_pool);
+}
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/sys/lfring.h>
+
+#define RING_LEN 8
+#define NUM_THREADS 2
+#define MSGS_PER_THREAD 1000
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define TIMEOUT K_MSEC(100)
+
+SYS_LFRING_SPSC_DEFINE(spsc, uint32_t, RING_LEN);
+SYS_LFRING_MPMC_DEFINE(mpmc, uint32_t, RING_LEN);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2 * NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[2 * NUM_THREADS];
+
+static atomic_t received_sum;
+
+static void reset_rings(void)
+{
+	zassert_equal(sys_lfring_init(&spsc, spsc_buf, NULL, sizeof(uint32_t),
+				      RING_LEN), 0, NULL);
+	zassert_equal(sys_lfring_init(&mpmc, mpmc_buf, mpmc_seq,
+				      sizeof(uint32_t), RING_LEN), 0, NULL);
+}
+
+static void fill_and_drain(struct sys_lfring *ring, uint32_t first)
+{
+	uint32_t val;
+
+	for (uint32_t i = 0; i < RING_LEN; i++) {
+		val = first + i;
+		zassert_equal(sys_lfring_put(ring, &val, K_NO_WAIT), 0, NULL);
+	}
+
+	zassert_equal(sys_lfring_num_used_get(ring), RING_LEN, NULL);
+	zassert_equal(sys_lfring_put(ring, &val, K_NO_WAIT), -ENOMSG, NULL);
+	zassert_equal(sys_lfring_put(ring, &val, TIMEOUT), -EAGAIN, NULL);
+
+	for (uint32_t i = 0; i < RING_LEN; i++) {
+		zassert_equal(sys_lfring_get(ring, &val, K_NO_WAIT), 0, NULL);
+		zassert_equal(val, first + i, NULL);
+	}
+
+	zassert_equal(sys_lfring_num_used_get(ring), 0, NULL);
+	zassert_equal(sys_lfring_get(ring, &val, K_NO_WAIT), -ENOMSG, NULL);
+	zassert_equal(sys_lfring_get(ring, &val, TIMEOUT), -EAGAIN, NULL);
+}
+
+static void test_lfring_init(void)
+{
+	static uint32_t buf[RING_LEN];
+	struct sys_lfring ring;
+
+	zassert_equal(sys_lfring_init(&ring, buf, NULL, sizeof(uint32_t), 6),
+		      -EINVAL, NULL);
+	zassert_equal(sys_lfring_init(&ring, buf, NULL, sizeof(uint32_t), 0),
+		      -EINVAL, NULL);
+	zassert_equal(sys_lfring_init(&ring, buf, NULL, 0, RING_LEN),
+		      -EINVAL, NULL);
+	zassert_equal(sys_lfring_init(&ring, buf, NULL, sizeof(uint32_t),
+				      RING_LEN), 0, NULL);
+	zassert_equal(sys_lfring_capacity_get(&ring), RING_LEN, NULL);
+}
+
+/* The smallest rings keep every element until it is read, one lap being
+ * a single put for a SPSC ring.
+ */
+static void test_lfring_small(void)
+{
+	static uint32_t buf[2];
+	static atomic_t seq[2];
+	struct sys_lfring ring;
+	uint32_t val;
+
+	zassert_equal(sys_lfring_init(&ring, buf, seq, sizeof(uint32_t), 1),
+		      -EINVAL, NULL);
+
+	zassert_equal(sys_lfring_init(&ring, buf, NULL, sizeof(uint32_t), 1),
+		      0, NULL);
+	for (uint32_t i = 0; i < 3; i++) {
+		zassert_equal(sys_lfring_put(&ring, &i, K_NO_WAIT), 0, NULL);
+		zassert_equal(sys_lfring_put(&ring, &i, K_NO_WAIT), -ENOMSG,
+			      NULL);
+		zassert_equal(sys_lfring_get(&ring, &val, K_NO_WAIT), 0, NULL);
+		zassert_equal(val, i, NULL);
+	}
+
+	zassert_equal(sys_lfring_init(&ring, buf, seq, sizeof(uint32_t), 2),
+		      0, NULL);
+	for (uint32_t i = 0; i < 6; i += 2) {
+		val = i;
+		zassert_equal(sys_lfring_put(&ring, &val, K_NO_WAIT), 0, NULL);
+		val = i + 1;
+		zassert_equal(sys_lfring_put(&ring, &val, K_NO_WAIT), 0, NULL);
+		zassert_equal(sys_lfring_put(&ring, &val, K_NO_WAIT), -ENOMSG,
+			      NULL);
+		zassert_equal(sys_lfring_get(&ring, &val, K_NO_WAIT), 0, NULL);
+		zassert_equal(val, i, NULL);
+		zassert_equal(sys_lfring_get(&ring, &val, K_NO_WAIT), 0, NULL);
+		zassert_equal(val, i + 1, NULL);
+		zassert_equal(sys_lfring_get(&ring, &val, K_NO_WAIT), -ENOMSG,
+			      NULL);
+	}
+}
+
+/* Elements come out in order, across several laps of the ring. */
+static void test_lfring_spsc(void)
+{
+	reset_rings();
+
+	for (uint32_t lap = 0; lap < 3; lap++) {
+		fill_and_drain(&spsc, lap * 100);
+	}
+}
+
+static void test_lfring_mpmc(void)
+{
+	reset_rings();
+
+	for (uint32_t lap = 0; lap < 3; lap++) {
+		fill_and_drain(&mpmc, lap * 100);
+	}
+}
+
+static void put_later(void *p1, void *p2, void *p3)
+{
+	struct sys_lfring *ring = p1;
+	uint32_t val = POINTER_TO_UINT(p2);
+
+	k_sleep(TIMEOUT);
+	zassert_equal(sys_lfring_put(ring, &val, K_NO_WAIT), 0, NULL);
+}
+
+static void get_later(void *p1, void *p2, void *p3)
+{
+	struct sys_lfring *ring = p1;
+	uint32_t val;
+
+	k_sleep(TIMEOUT);
+	zassert_equal(sys_lfring_get(ring, &val, K_NO_WAIT), 0, NULL);
+}
+
+/* A consumer blocked on an empty ring is woken by the next put, and a
+ * producer blocked on a full ring by the next get.
+ */
+static void check_blocking(struct sys_lfring *ring)
+{
+	uint32_t val;
+
+	k_thread_create(&threads[0], stacks[0], STACK_SIZE, put_later, ring,
+			UINT_TO_POINTER(42), NULL, K_PRIO_PREEMPT(0), 0,
+			K_NO_WAIT);
+	zassert_equal(sys_lfring_get(ring, &val, K_FOREVER), 0, NULL);
+	zassert_equal(val, 42, NULL);
+	k_thread_join(&threads[0], K_FOREVER);
+
+	for (uint32_t i = 0; i < RING_LEN; i++) {
+		zassert_equal(sys_lfring_put(ring, &i, K_NO_WAIT), 0, NULL);
+	}
+
+	k_thread_create(&threads[0], stacks[0], STACK_SIZE, get_later, ring,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	val = RING_LEN;
+	zassert_equal(sys_lfring_put(ring, &val, K_SECONDS(1)), 0, NULL);
+	k_thread_join(&threads[0], K_FOREVER);
+
+	for (uint32_t i = 1; i <= RING_LEN; i++) {
+		zassert_equal(sys_lfring_get(ring, &val, K_NO_WAIT), 0, NULL);
+		zassert_equal(val, i, NULL);
+	}
+}
+
+static void test_lfring_blocking(void)
+{
+	reset_rings();
+
+	check_blocking(&spsc);
+	check_blocking(&mpmc);
+}
+
+static void isr_put(const void *arg)
+{
+	uint32_t val = 7;
+
+	zassert_equal(sys_lfring_put((struct sys_lfring *)arg, &val, K_NO_WAIT),
+		      0, NULL);
+}
+
+/* Non-blocking operations are allowed from ISRs. */
+static void test_lfring_isr(void)
+{
+	uint32_t val;
+
+	reset_rings();
+
+	irq_offload(isr_put, &spsc);
+	zassert_equal(sys_lfring_get(&spsc, &val, K_NO_WAIT), 0, NULL);
+	zassert_equal(val, 7, NULL);
+
+	irq_offload(isr_put, &mpmc);
+	zassert_equal(sys_lfring_get(&mpmc, &val, K_NO_WAIT), 0, NULL);
+	zassert_equal(val, 7, NULL);
+}
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	uint32_t first = POINTER_TO_UINT(p1);
+
+	for (uint32_t i = 0; i < MSGS_PER_THREAD; i++) {
+		uint32_t val = first + i;
+
+		zassert_equal(sys_lfring_put(&mpmc, &val, K_FOREVER), 0, NULL);
+	}
+}
+
+static void consumer(void *p1, void *p2, void *p3)
+{
+	uint32_t val;
+
+	for (uint32_t i = 0; i < MSGS_PER_THREAD; i++) {
+		zassert_equal(sys_lfring_get(&mpmc, &val, K_FOREVER), 0, NULL);
+		atomic_add(&received_sum, val);
+	}
+}
+
+/* Every element put by concurrent producers is got exactly once by
+ * concurrent consumers.
+ */
+static void test_lfring_mpmc_concurrent(void)
+{
+	atomic_val_t expected = 0;
+
+	reset_rings();
+	atomic_set(&received_sum, 0);
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, consumer,
+				NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0,
+				K_NO_WAIT);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		uint32_t first = i * MSGS_PER_THREAD;
+
+		for (uint32_t j = 0; j < MSGS_PER_THREAD; j++) {
+			expected += first + j;
+		}
+
+		k_thread_create(&threads[NUM_THREADS + i],
+				stacks[NUM_THREADS + i], STACK_SIZE, producer,
+				UINT_TO_POINTER(first), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < 2 * NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	zassert_equal(atomic_get(&received_sum), expected, NULL);
+	zassert_equal(sys_lfring_num_used_get(&mpmc), 0, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(lfring,
+			 ztest_unit_test(test_lfring_init),
+			 ztest_unit_test(test_lfring_small),
+			 ztest_unit_test(test_lfring_spsc),
+			 ztest_unit_test(test_lfring_mpmc),
+			 ztest_unit_test(test_lfring_blocking),
+			 ztest_unit_test(test_lfring_isr),
+			 ztest_unit_test(test_lfring_mpmc_concurrent));
+	ztest_run_test_suite(lfring);
+}
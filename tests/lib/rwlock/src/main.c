@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <zephyr/sys/rwlock.h>
+
+#define NUM_THREADS 3
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define TIMEOUT K_MSEC(100)
+
+SYS_RWLOCK_DEFINE(rwlock);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+static atomic_t readers;
+static atomic_t max_readers;
+static atomic_t writers;
+
+static void test_rwlock_uncontended(void)
+{
+	zassert_equal(sys_rwlock_init(&rwlock), 0, NULL);
+
+	zassert_equal(sys_rwlock_read_unlock(&rwlock), -EINVAL, NULL);
+	zassert_equal(sys_rwlock_write_unlock(&rwlock), -EINVAL, NULL);
+
+	/* Readers share the lock, and exclude writers */
+	zassert_equal(sys_rwlock_read_lock(&rwlock, K_NO_WAIT), 0, NULL);
+	zassert_equal(sys_rwlock_read_lock(&rwlock, K_NO_WAIT), 0, NULL);
+	zassert_equal(sys_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(sys_rwlock_write_lock(&rwlock, TIMEOUT), -EAGAIN, NULL);
+	zassert_equal(sys_rwlock_write_unlock(&rwlock), -EINVAL, NULL);
+	zassert_equal(sys_rwlock_read_unlock(&rwlock), 0, NULL);
+	zassert_equal(sys_rwlock_read_unlock(&rwlock), 0, NULL);
+
+	/* A writer excludes everybody */
+	zassert_equal(sys_rwlock_write_lock(&rwlock, K_NO_WAIT), 0, NULL);
+	zassert_equal(sys_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(sys_rwlock_read_lock(&rwlock, TIMEOUT), -EAGAIN, NULL);
+	zassert_equal(sys_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(sys_rwlock_read_unlock(&rwlock), -EINVAL, NULL);
+	zassert_equal(sys_rwlock_write_unlock(&rwlock), 0, NULL);
+
+	zassert_equal(sys_rwlock_write_lock(&rwlock, K_NO_WAIT), 0, NULL);
+	zassert_equal(sys_rwlock_write_unlock(&rwlock), 0, NULL);
+}
+
+static void reader(void *p1, void *p2, void *p3)
+{
+	atomic_val_t now;
+
+	zassert_equal(sys_rwlock_read_lock(&rwlock, K_FOREVER), 0, NULL);
+
+	zassert_equal(atomic_get(&writers), 0, NULL);
+	now = atomic_inc(&readers) + 1;
+	if (now > atomic_get(&max_readers)) {
+		atomic_set(&max_readers, now);
+	}
+
+	k_sleep(TIMEOUT);
+
+	atomic_dec(&readers);
+	zassert_equal(sys_rwlock_read_unlock(&rwlock), 0, NULL);
+}
+
+static void writer(void *p1, void *p2, void *p3)
+{
+	zassert_equal(sys_rwlock_write_lock(&rwlock, K_FOREVER), 0, NULL);
+
+	zassert_equal(atomic_inc(&writers), 0, NULL);
+	zassert_equal(atomic_get(&readers), 0, NULL);
+	k_sleep(K_MSEC(10));
+	atomic_dec(&writers);
+
+	zassert_equal(sys_rwlock_write_unlock(&rwlock), 0, NULL);
+}
+
+static void start(int i, k_thread_entry_t entry)
+{
+	k_thread_create(&threads[i], stacks[i], STACK_SIZE, entry, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+}
+
+static void join_all(void)
+{
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+}
+
+/* Waiting readers get the lock together once the writer unlocks it. */
+static void test_rwlock_readers_wait_writer(void)
+{
+	zassert_equal(sys_rwlock_init(&rwlock), 0, NULL);
+	atomic_set(&readers, 0);
+	atomic_set(&max_readers, 0);
+	atomic_set(&writers, 0);
+
+	zassert_equal(sys_rwlock_write_lock(&rwlock, K_NO_WAIT), 0, NULL);
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		start(i, reader);
+	}
+
+	k_sleep(K_MSEC(10));
+	zassert_equal(atomic_get(&readers), 0, NULL);
+	zassert_equal(sys_rwlock_write_unlock(&rwlock), 0, NULL);
+
+	join_all();
+	zassert_equal(atomic_get(&max_readers), NUM_THREADS, NULL);
+}
+
+/* A waiting writer gets the lock after the readers holding it, before
+ * readers arriving after it.
+ */
+static void test_rwlock_writer_wait_readers(void)
+{
+	zassert_equal(sys_rwlock_init(&rwlock), 0, NULL);
+	atomic_set(&readers, 0);
+	atomic_set(&writers, 0);
+
+	start(0, reader);
+	k_sleep(K_MSEC(10));
+	start(1, writer);
+	k_sleep(K_MSEC(10));
+
+	/* The writer waits, new readers wait behind it */
+	zassert_equal(sys_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY, NULL);
+	start(2, reader);
+
+	join_all();
+	zassert_equal(sys_rwlock_write_lock(&rwlock, K_NO_WAIT), 0, NULL);
+	zassert_equal(sys_rwlock_write_unlock(&rwlock), 0, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(rwlock,
+			 ztest_unit_test(test_rwlock_uncontended),
+			 ztest_unit_test(test_rwlock_readers_wait_writer),
+			 ztest_unit_test(test_rwlock_writer_wait_readers));
+	ztest_run_test_suite(rwlock);
+}
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_HTTP_LOG_LEVEL);
+
+#include <ztest.h>
+
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http_client.h>
+
+#define SERVER_ADDR "127.0.0.1"
+#define SERVER_PORT 8080
+#define SERVER_PORT_STR STRINGIFY(SERVER_PORT)
+#define SERVER_MAX_CLIENTS 3
+#define SERVER_BUF_LEN 512
+#define SERVER_STACK_SIZE 2048
+
+#define REQ_TIMEOUT 3000
+#define MAX_PIPELINED 3
+
+static const char response_ok[] =
+	"HTTP/1.1 200 OK\r\n"
+	"Content-Length: 2\r\n"
+	"\r\n"
+	"OK";
+
+static const char response_close[] =
+	"HTTP/1.1 200 OK\r\n"
+	"Content-Length: 2\r\n"
+	"Connection: close\r\n"
+	"\r\n"
+	"OK";
+
+struct server_client {
+	int sock;
+	size_t len;
+	char buf[SERVER_BUF_LEN];
+};
+
+static struct server_client clients[SERVER_MAX_CLIENTS];
+static atomic_t server_accepted;
+static atomic_t server_requests;
+static char server_last_body[SERVER_BUF_LEN];
+
+static K_THREAD_STACK_DEFINE(server_stack, SERVER_STACK_SIZE);
+static struct k_thread server_thread;
+static K_SEM_DEFINE(server_ready, 0, 1);
+
+static const struct http_client_endpoint endpoint = {
+	.host = SERVER_ADDR,
+	.port = SERVER_PORT_STR,
+	.sec_tag = -1,
+};
+
+/* Length of the first complete request in the buffer, 0 if there is none */
+static size_t server_request_len(struct server_client *client)
+{
+	char *hdr_end, *body_end;
+
+	client->buf[client->len] = '\0';
+
+	hdr_end = strstr(client->buf, "\r\n\r\n");
+	if (!hdr_end) {
+		return 0;
+	}
+
+	*hdr_end = '\0';
+	if (!strstr(client->buf, "Transfer-Encoding: chunked")) {
+		*hdr_end = '\r';
+		return hdr_end - client->buf + 4;
+	}
+
+	*hdr_end = '\r';
+
+	/* Chunked body ends with the zero length chunk */
+	body_end = strstr(hdr_end + 2, "\r\n0\r\n\r\n");
+	if (!body_end) {
+		return 0;
+	}
+
+	body_end += sizeof("\r\n0\r\n\r\n") - 1;
+	memcpy(server_last_body, hdr_end + 4, body_end - (hdr_end + 4));
+	server_last_body[body_end - (hdr_end + 4)] = '\0';
+
+	return body_end - client->buf;
+}
+
+static void server_client_close(struct server_client *client)
+{
+	(void)close(client->sock);
+	client->sock = -1;
+	client->len = 0;
+}
+
+static void server_client_handle(struct server_client *client)
+{
+	size_t req_len;
+	ssize_t len;
+	bool close_conn;
+
+	len = recv(client->sock, client->buf + client->len,
+		   sizeof(client->buf) - client->len - 1, 0);
+	if (len <= 0) {
+		server_client_close(client);
+		return;
+	}
+
+	client->len += len;
+
+	while ((req_len = server_request_len(client)) > 0) {
+		close_conn = strncmp(client->buf, "GET /close ", 11) == 0;
+
+		atomic_inc(&server_requests);
+
+		if (close_conn) {
+			(void)send(client->sock, response_close,
+				   sizeof(response_close) - 1, 0);
+			server_client_close(client);
+			return;
+		}
+
+		(void)send(client->sock, response_ok, sizeof(response_ok) - 1, 0);
+
+		client->len -= req_len;
+		memmove(client->buf, client->buf + req_len, client->len);
+	}
+}
+
+static void server_main(void *p1, void *p2, void *p3)
+{
+	struct pollfd fds[SERVER_MAX_CLIENTS + 1];
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+	};
+	int listen_sock;
+	int i;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (i = 0; i < SERVER_MAX_CLIENTS; i++) {
+		clients[i].sock = -1;
+	}
+
+	listen_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(listen_sock >= 0, "socket failed (%d)", errno);
+
+	zassert_equal(inet_pton(AF_INET, SERVER_ADDR, &addr.sin_addr), 1,
+		      "inet_pton failed");
+	zassert_equal(bind(listen_sock, (struct sockaddr *)&addr, sizeof(addr)),
+		      0, "bind failed (%d)", errno);
+	zassert_equal(listen(listen_sock, SERVER_MAX_CLIENTS), 0,
+		      "listen failed (%d)", errno);
+
+	k_sem_give(&server_ready);
+
+	while (true) {
+		fds[0].fd = listen_sock;
+		fds[0].events = POLLIN;
+
+		for (i = 0; i < SERVER_MAX_CLIENTS; i++) {
+			fds[i + 1].fd = clients[i].sock;
+			fds[i + 1].events = POLLIN;
+		}
+
+		if (poll(fds, ARRAY_SIZE(fds), -1) < 0) {
+			continue;
+		}
+
+		if (fds[0].revents & POLLIN) {
+			int sock = accept(listen_sock, NULL, NULL);
+
+			for (i = 0; sock >= 0 && i < SERVER_MAX_CLIENTS; i++) {
+				if (clients[i].sock < 0) {
+					clients[i].sock = sock;
+					clients[i].len = 0;
+					atomic_inc(&server_accepted);
+					break;
+				}
+			}
+
+			if (sock >= 0 && i == SERVER_MAX_CLIENTS) {
+				(void)close(sock);
+			}
+		}
+
+		for (i = 0; i < SERVER_MAX_CLIENTS; i++) {
+			if (clients[i].sock >= 0 && fds[i + 1].fd >= 0 &&
+			    fds[i + 1].revents) {
+				server_client_handle(&clients[i]);
+			}
+		}
+	}
+}
+
+static int responses_final;
+static uint16_t last_status;
+
+static void response_cb(struct http_response *rsp,
+			enum http_final_call final_data,
+			void *user_data)
+{
+	if (final_data == HTTP_DATA_FINAL) {
+		responses_final++;
+		last_status = rsp->http_status_code;
+	}
+}
+
+static uint8_t recv_bufs[MAX_PIPELINED][128];
+
+static void request_init(struct http_request *req, enum http_method method,
+			 const char *url, uint8_t *recv_buf, size_t recv_buf_len)
+{
+	memset(req, 0, sizeof(*req));
+
+	req->method = method;
+	req->url = url;
+	req->protocol = "HTTP/1.1";
+	req->response = response_cb;
+	req->recv_buf = recv_buf;
+	req->recv_buf_len = recv_buf_len;
+}
+
+static void test_prepare(void)
+{
+	http_client_pool_flush();
+
+	/* Let the server notice the closed connections */
+	k_msleep(100);
+
+	atomic_clear(&server_accepted);
+	atomic_clear(&server_requests);
+	responses_final = 0;
+	last_status = 0;
+}
+
+static void test_keep_alive_reuse(void)
+{
+	struct http_request req;
+	int ret;
+
+	for (int i = 0; i < 3; i++) {
+		request_init(&req, HTTP_GET, "/", recv_bufs[0],
+			     sizeof(recv_bufs[0]));
+
+		ret = http_client_pool_req(&endpoint, &req, REQ_TIMEOUT, NULL);
+		zassert_true(ret > 0, "Request %d failed (%d)", i, ret);
+		zassert_equal(last_status, 200, "Invalid status %d", last_status);
+	}
+
+	zassert_equal(responses_final, 3, "Missing responses");
+	zassert_equal(atomic_get(&server_requests), 3, "Missing requests");
+	zassert_equal(atomic_get(&server_accepted), 1,
+		      "Connection not reused (%d connections)",
+		      (int)atomic_get(&server_accepted));
+}
+
+static void test_pipelining(void)
+{
+	struct http_request reqs[MAX_PIPELINED];
+	struct http_request *req_list[MAX_PIPELINED];
+	int ret;
+
+	for (int i = 0; i < MAX_PIPELINED; i++) {
+		request_init(&reqs[i], HTTP_GET, "/", recv_bufs[i],
+			     sizeof(recv_bufs[i]));
+		req_list[i] = &reqs[i];
+	}
+
+	ret = http_client_pool_req_pipelined(&endpoint, req_list, MAX_PIPELINED,
+					     REQ_TIMEOUT, NULL);
+	zassert_true(ret > 0, "Pipelined request failed (%d)", ret);
+
+	for (int i = 0; i < MAX_PIPELINED; i++) {
+		zassert_true(reqs[i].internal.response.message_complete,
+			     "Response %d not complete", i);
+		zassert_equal(reqs[i].internal.response.http_status_code, 200,
+			      "Invalid status for response %d", i);
+		zassert_equal(reqs[i].internal.response.processed, 2,
+			      "Invalid body length for response %d", i);
+	}
+
+	zassert_equal(responses_final, MAX_PIPELINED, "Missing responses");
+	zassert_equal(atomic_get(&server_accepted), 1,
+		      "Requests not pipelined on one connection");
+}
+
+static void test_pipelining_not_idempotent(void)
+{
+	struct http_request reqs[2];
+	struct http_request *req_list[] = { &reqs[0], &reqs[1] };
+	int ret;
+
+	request_init(&reqs[0], HTTP_GET, "/", recv_bufs[0], sizeof(recv_bufs[0]));
+	request_init(&reqs[1], HTTP_POST, "/", recv_bufs[1], sizeof(recv_bufs[1]));
+
+	ret = http_client_pool_req_pipelined(&endpoint, req_list, 2,
+					     REQ_TIMEOUT, NULL);
+	zassert_equal(ret, -EINVAL, "POST must not be pipelined");
+}
+
+static void test_server_close(void)
+{
+	struct http_request req;
+	int ret;
+
+	request_init(&req, HTTP_GET, "/close", recv_bufs[0], sizeof(recv_bufs[0]));
+	ret = http_client_pool_req(&endpoint, &req, REQ_TIMEOUT, NULL);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+
+	request_init(&req, HTTP_GET, "/", recv_bufs[0], sizeof(recv_bufs[0]));
+	ret = http_client_pool_req(&endpoint, &req, REQ_TIMEOUT, NULL);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+
+	zassert_equal(responses_final, 2, "Missing responses");
+	zassert_equal(atomic_get(&server_accepted), 2,
+		      "Closed connection must not be reused");
+}
+
+static int chunked_payload_cb(int sock, struct http_request *req,
+			      void *user_data)
+{
+	int total = 0;
+	int ret;
+
+	ret = http_client_send_chunk(sock, "hello", 5);
+	if (ret < 0) {
+		return ret;
+	}
+
+	total += ret;
+
+	ret = http_client_send_chunk(sock, "world", 5);
+	if (ret < 0) {
+		return ret;
+	}
+
+	total += ret;
+
+	ret = http_client_send_chunk(sock, NULL, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return total + ret;
+}
+
+static void test_chunked_upload(void)
+{
+	static const char *headers[] = {
+		"Transfer-Encoding: chunked\r\n",
+		NULL
+	};
+	struct http_request req;
+	int ret;
+
+	request_init(&req, HTTP_POST, "/upload", recv_bufs[0],
+		     sizeof(recv_bufs[0]));
+	req.header_fields = headers;
+	req.payload_cb = chunked_payload_cb;
+	req.payload_len = 0;
+
+	ret = http_client_pool_req(&endpoint, &req, REQ_TIMEOUT, NULL);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	zassert_equal(last_status, 200, "Invalid status %d", last_status);
+	zassert_equal(strcmp(server_last_body,
+			     "5\r\nhello\r\n5\r\nworld\r\n0\r\n\r\n"), 0,
+		      "Invalid chunked body");
+}
+
+void test_main(void)
+{
+	k_thread_create(&server_thread, server_stack,
+			K_THREAD_STACK_SIZEOF(server_stack),
+			server_main, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(8), 0, K_NO_WAIT);
+	k_sem_take(&server_ready, K_FOREVER);
+
+	ztest_test_suite(http_client_pool,
+			 ztest_unit_test_setup_teardown(test_keep_alive_reuse,
+							test_prepare, unit_test_noop),
+			 ztest_unit_test_setup_teardown(test_pipelining,
+							test_prepare, unit_test_noop),
+			 ztest_unit_test_setup_teardown(test_pipelining_not_idempotent,
+							test_prepare, unit_test_noop),
+			 ztest_unit_test_setup_teardown(test_server_close,
+							test_prepare, unit_test_noop),
+			 ztest_unit_test_setup_teardown(test_chunked_upload,
+							test_prepare, unit_test_noop));
+
+	ztest_run_test_suite(http_client_pool);
+}
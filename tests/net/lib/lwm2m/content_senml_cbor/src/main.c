@@ -1508,6 +1508,103 @@ static void test_get_time_nodata(void)
 	zassert_equal(ret, -EBADMSG, "Invalid error code returned");
 }
 
+static void composite_path_list_init(sys_slist_t *path_list, sys_slist_t *free_list,
+				     struct lwm2m_obj_path_list *buf, size_t buf_len,
+				     const uint16_t *res_ids, size_t res_cnt)
+{
+	struct lwm2m_obj_path path = {
+		.obj_id = TEST_OBJ_ID,
+		.obj_inst_id = TEST_OBJ_INST_ID,
+		.level = LWM2M_PATH_LEVEL_RESOURCE,
+	};
+
+	lwm2m_engine_path_list_init(path_list, free_list, buf, buf_len);
+
+	for (int i = 0; i < res_cnt; i++) {
+		path.res_id = res_ids[i];
+		zassert_equal(lwm2m_engine_add_path_to_list(path_list, free_list, &path), 0,
+			      "Failed to add path");
+	}
+}
+
+static void test_put_composite_shared_basename(void)
+{
+	int ret;
+	struct lwm2m_obj_path_list path_buf[2];
+	sys_slist_t path_list, free_list;
+	const uint16_t res_ids[] = { TEST_RES_S8, TEST_RES_S32 };
+	struct test_payload_buffer expected_payload = {
+		.data = {
+			(0x04 << 5) | 2,
+			(0x05 << 5) | 3,
+			(0x01 << 5) | 1,
+			(0x03 << 5) | 9,
+			'/', '6', '5', '5', '3', '5', '/', '0', '/',
+			(0x00 << 5) | 0,
+			(0x03 << 5) | 1,
+			'0',
+			(0x00 << 5) | 2,
+			(0x00 << 5) | 0,
+			/* Second record inherits the basename */
+			(0x05 << 5) | 2,
+			(0x00 << 5) | 0,
+			(0x03 << 5) | 1,
+			'2',
+			(0x00 << 5) | 2,
+			(0x00 << 5) | 1
+		},
+		.len = 24
+	};
+
+	test_s8 = 0;
+	test_s32 = 1;
+
+	composite_path_list_init(&path_list, &free_list, path_buf, ARRAY_SIZE(path_buf),
+				 res_ids, ARRAY_SIZE(res_ids));
+
+	ret = do_composite_read_op_for_parsed_path_senml_cbor(&test_msg, &path_list);
+	zassert_true(ret >= 0, "Error reported");
+
+	zassert_mem_equal(test_msg.msg_data + TEST_PAYLOAD_OFFSET,
+			  expected_payload.data, expected_payload.len,
+			  "Invalid payload format");
+	zassert_equal(test_msg.cpkt.offset, expected_payload.len + TEST_PAYLOAD_OFFSET,
+		      "Invalid packet offset");
+}
+
+#define TEST_ENCODE_ITERATIONS 100
+
+static void test_put_composite_encode_cost(void)
+{
+	int ret;
+	uint32_t start, cycles = 0U;
+	size_t payload_len = 0;
+	struct lwm2m_obj_path_list path_buf[6];
+	sys_slist_t path_list, free_list;
+	const uint16_t res_ids[] = {
+		TEST_RES_S8, TEST_RES_S16, TEST_RES_S32,
+		TEST_RES_S64, TEST_RES_BOOL, TEST_RES_TIME
+	};
+
+	for (int i = 0; i < TEST_ENCODE_ITERATIONS; i++) {
+		context_reset();
+		composite_path_list_init(&path_list, &free_list, path_buf, ARRAY_SIZE(path_buf),
+					 res_ids, ARRAY_SIZE(res_ids));
+
+		start = k_cycle_get_32();
+		ret = do_composite_read_op_for_parsed_path_senml_cbor(&test_msg, &path_list);
+		cycles += k_cycle_get_32() - start;
+
+		zassert_true(ret >= 0, "Error reported");
+		payload_len = test_msg.cpkt.offset - TEST_PAYLOAD_OFFSET;
+	}
+
+	TC_PRINT("SenML-CBOR composite: %zu values, %zu bytes/value, %u ns/value\n",
+		 ARRAY_SIZE(res_ids), payload_len / ARRAY_SIZE(res_ids),
+		 (uint32_t)(k_cyc_to_ns_floor64(cycles) /
+			    (TEST_ENCODE_ITERATIONS * ARRAY_SIZE(res_ids))));
+}
+
 void test_main(void)
 {
 	test_obj_init();
@@ -1544,6 +1641,10 @@ void test_main(void)
 		ztest_unit_test_setup_teardown(test_put_time, test_prepare, unit_test_noop),
 		ztest_unit_test_setup_teardown(test_put_time_nomem,
 				  test_prepare_nomem, unit_test_noop),
+		ztest_unit_test_setup_teardown(test_put_composite_shared_basename,
+				  test_prepare, unit_test_noop),
+		ztest_unit_test_setup_teardown(test_put_composite_encode_cost,
+				  test_prepare, unit_test_noop),
 		ztest_unit_test_setup_teardown(test_get_s32, test_prepare, unit_test_noop),
 		ztest_unit_test_setup_teardown(test_get_s32_nodata,
 				  test_prepare_nodata, unit_test_noop),
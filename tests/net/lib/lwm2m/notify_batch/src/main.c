@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <ztest.h>
+
+#include "lwm2m_engine.h"
+
+#define WINDOW_MS CONFIG_LWM2M_ENGINE_NOTIFY_BATCH_WINDOW_MS
+
+/* Notifications due within the window are advanced, the others are not */
+static void test_advance_window(void)
+{
+	int64_t now = 100 * MSEC_PER_SEC;
+
+	zassert_true(lwm2m_engine_notify_can_advance(now, now + WINDOW_MS,
+						     0, 0), NULL);
+	zassert_true(lwm2m_engine_notify_can_advance(now, now + 1, 0, 0), NULL);
+	zassert_false(lwm2m_engine_notify_can_advance(now, now + WINDOW_MS + 1,
+						      0, 0), NULL);
+	/* No pmax, nothing scheduled */
+	zassert_false(lwm2m_engine_notify_can_advance(now, 0, 0, 0), NULL);
+}
+
+/* Notifications are never advanced before pmin has elapsed since the
+ * previous one, even when pmax minus the window is below pmin.
+ */
+static void test_advance_pmin(void)
+{
+	int64_t last = 100 * MSEC_PER_SEC;
+	int32_t pmin = 10;
+	int32_t pmax = 11;
+	int64_t due = last + pmax * MSEC_PER_SEC;
+
+	zassert_true(due - WINDOW_MS < last + pmin * MSEC_PER_SEC, NULL);
+
+	zassert_false(lwm2m_engine_notify_can_advance(due - WINDOW_MS, due,
+						      last, pmin), NULL);
+	zassert_false(lwm2m_engine_notify_can_advance(
+			      last + pmin * MSEC_PER_SEC - 1, due, last, pmin),
+		      NULL);
+	zassert_true(lwm2m_engine_notify_can_advance(
+			     last + pmin * MSEC_PER_SEC, due, last, pmin),
+		     NULL);
+}
+
+/* A notification generated in the pass is not generated again, even when
+ * its next period falls within the window
+ */
+static void test_advance_same_pass(void)
+{
+	int64_t now = 100 * MSEC_PER_SEC;
+
+	zassert_false(lwm2m_engine_notify_can_advance(now, now + 1, now, 0),
+		      NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(lwm2m_notify_batch,
+			 ztest_unit_test(test_advance_window),
+			 ztest_unit_test(test_advance_pmin),
+			 ztest_unit_test(test_advance_same_pass));
+	ztest_run_test_suite(lwm2m_notify_batch);
+}
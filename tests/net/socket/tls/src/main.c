@@ -611,6 +611,92 @@ void test_v6_dtls_sendmsg(void)
 			  (struct sockaddr *)&server_addr, sizeof(server_addr));
 }
 
+void test_v4_msg_more(void)
+{
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	uint8_t rx_buf[sizeof(TEST_STR_SMALL) - 1] = { 0 };
+	struct msghdr msg = { 0 };
+	struct iovec iov[2];
+	int optval = 1;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_SOCKETS_TLS_COALESCE)) {
+		ztest_test_skip();
+		return;
+	}
+
+	prepare_sock_tls_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, ANY_PORT,
+			    &c_sock, &c_saddr, IPPROTO_TLS_1_2);
+	prepare_sock_tls_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, ANY_PORT,
+			    &s_sock, &s_saddr, IPPROTO_TLS_1_2);
+
+	test_config_psk(s_sock, c_sock);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	spawn_client_connect_thread(c_sock, (struct sockaddr *)&s_saddr);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	k_thread_join(&client_connect_thread, K_FOREVER);
+
+	/* Data sent with MSG_MORE is held back... */
+	test_send(c_sock, TEST_STR_SMALL, 2, MSG_MORE);
+	k_msleep(10);
+
+	ret = recv(new_sock, rx_buf, sizeof(rx_buf), MSG_DONTWAIT);
+	zassert_equal(ret, -1, "Data sent with MSG_MORE not held back");
+	zassert_equal(errno, EAGAIN, "incorrect errno value");
+
+	/* ...and sent together with the data that follows */
+	test_send(c_sock, TEST_STR_SMALL + 2, sizeof(rx_buf) - 2, 0);
+
+	ret = recv(new_sock, rx_buf, sizeof(rx_buf), MSG_WAITALL);
+	zassert_equal(ret, sizeof(rx_buf), "Invalid length received");
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, sizeof(rx_buf),
+			  "Invalid data received");
+
+	/* Buffers of a message are sent together */
+	iov[0].iov_base = TEST_STR_SMALL;
+	iov[0].iov_len = 2;
+	iov[1].iov_base = TEST_STR_SMALL + 2;
+	iov[1].iov_len = sizeof(rx_buf) - 2;
+	msg.msg_iov = iov;
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+
+	test_sendmsg(c_sock, &msg, 0);
+
+	memset(rx_buf, 0, sizeof(rx_buf));
+	ret = recv(new_sock, rx_buf, sizeof(rx_buf), MSG_WAITALL);
+	zassert_equal(ret, sizeof(rx_buf), "Invalid length received");
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, sizeof(rx_buf),
+			  "Invalid data received");
+
+	/* TCP_NODELAY pushes out held back data */
+	test_send(c_sock, TEST_STR_SMALL, 2, MSG_MORE);
+
+	ret = setsockopt(c_sock, IPPROTO_TCP, TCP_NODELAY, &optval,
+			 sizeof(optval));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	memset(rx_buf, 0, sizeof(rx_buf));
+	ret = recv(new_sock, rx_buf, 2, MSG_WAITALL);
+	zassert_equal(ret, 2, "Invalid length received");
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, 2, "Invalid data received");
+
+	test_close(new_sock);
+	test_close(s_sock);
+	test_close(c_sock);
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
 void test_main(void)
 {
 	if (IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE)) {
@@ -629,7 +715,8 @@ void test_main(void)
 		ztest_unit_test(test_v4_msg_trunc),
 		ztest_unit_test(test_v6_msg_trunc),
 		ztest_unit_test(test_v4_dtls_sendmsg),
-		ztest_unit_test(test_v6_dtls_sendmsg)
+		ztest_unit_test(test_v6_dtls_sendmsg),
+		ztest_unit_test(test_v4_msg_more)
 		);
 
 	ztest_run_test_suite(socket_tls);
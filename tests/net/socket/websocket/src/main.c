@@ -373,6 +373,111 @@ static void test_recv_two_large_split_msg(void)
 		      test_msg_len, ret);
 }
 
+static uint8_t stream_buf[sizeof(lorem_ipsum) + MAX_HEADER_LEN];
+static uint8_t stream_data[sizeof(lorem_ipsum)];
+static size_t stream_len;
+
+int verify_streamed_msg(struct msghdr *msg)
+{
+	size_t len = 0;
+	int i;
+
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		zassert_true(stream_len + msg->msg_iov[i].iov_len <=
+			     sizeof(stream_buf), "Too much data streamed");
+
+		memcpy(&stream_buf[stream_len], msg->msg_iov[i].iov_base,
+		       msg->msg_iov[i].iov_len);
+		stream_len += msg->msg_iov[i].iov_len;
+		len += msg->msg_iov[i].iov_len;
+	}
+
+	return len;
+}
+
+static void test_send_stream_masked(void)
+{
+	/* Odd sized parts so that masking starts at every key offset and
+	 * at unaligned addresses.
+	 */
+	static const size_t parts[] = { 1, 3, 7, 64, 129 };
+	static struct websocket_context ctx;
+	struct iovec iov[ARRAY_SIZE(parts)];
+	uint32_t msg_type = -1;
+	uint64_t remaining = -1;
+	size_t hdr_len, offset = 0, total_read = 0;
+	int ret, i;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	stream_len = 0;
+	test_msg_len = sizeof(lorem_ipsum) - 1;
+	memcpy(stream_data, lorem_ipsum, test_msg_len);
+
+	ret = websocket_send_frame_begin(POINTER_TO_INT(&ctx), test_msg_len,
+					 WEBSOCKET_OPCODE_DATA_TEXT, true, true,
+					 SYS_FOREVER_MS);
+	zassert_equal(ret, 0, "Cannot start frame (%d)", ret);
+
+	/* 2 bytes of header, 2 bytes of length and 4 bytes of mask */
+	hdr_len = stream_len;
+	zassert_equal(hdr_len, 8, "Invalid header length %zd", hdr_len);
+	zassert_true(stream_buf[1] & BIT(7), "Frame not masked");
+
+	ret = websocket_send_frame_begin(POINTER_TO_INT(&ctx), test_msg_len,
+					 WEBSOCKET_OPCODE_DATA_TEXT, true, true,
+					 SYS_FOREVER_MS);
+	zassert_equal(ret, -EALREADY, "Frame started twice (%d)", ret);
+
+	while (offset < test_msg_len) {
+		for (i = 0; i < ARRAY_SIZE(parts) && offset < test_msg_len;
+		     i++) {
+			iov[i].iov_base = &stream_data[offset];
+			iov[i].iov_len = MIN(parts[i], test_msg_len - offset);
+			offset += iov[i].iov_len;
+		}
+
+		ret = websocket_send_frame_data(POINTER_TO_INT(&ctx), iov, i,
+						SYS_FOREVER_MS);
+		zassert_true(ret > 0, "Cannot send data (%d)", ret);
+	}
+
+	zassert_equal(stream_len, hdr_len + test_msg_len,
+		      "Invalid amount of data streamed (%zd)", stream_len);
+
+	iov[0].iov_base = stream_data;
+	iov[0].iov_len = 1;
+
+	ret = websocket_send_frame_data(POINTER_TO_INT(&ctx), iov, 1,
+					SYS_FOREVER_MS);
+	zassert_equal(ret, -EMSGSIZE, "Data past the frame accepted (%d)", ret);
+
+	/* Receive the frame and check that it is unmasked properly */
+	memset(&ctx, 0, sizeof(ctx));
+
+	ctx.tmp_buf = temp_recv_buf;
+	ctx.tmp_buf_len = sizeof(temp_recv_buf);
+
+	ret = test_recv_buf(stream_buf, hdr_len, &ctx, &msg_type, &remaining,
+			    recv_buf, sizeof(recv_buf));
+	zassert_equal(ret, -EAGAIN, "Msg header not found");
+
+	while (total_read < test_msg_len) {
+		ret = test_recv_buf(&stream_buf[hdr_len + total_read],
+				    stream_len - hdr_len - total_read,
+				    &ctx, &msg_type, &remaining,
+				    recv_buf + total_read,
+				    sizeof(recv_buf) - total_read);
+		zassert_true(ret > 0, "Cannot read data (%d)", ret);
+
+		total_read += ret;
+	}
+
+	zassert_equal(remaining, 0, "Msg not empty");
+	zassert_mem_equal(recv_buf, lorem_ipsum, test_msg_len,
+			  "Invalid message received");
+}
+
 void test_main(void)
 {
 	k_thread_system_pool_assign(k_current_get());
@@ -390,7 +495,8 @@ void test_main(void)
 			 ztest_unit_test(test_recv_whole_msg),
 			 ztest_unit_test(test_recv_two_msg),
 			 ztest_unit_test(test_send_and_recv_lorem_ipsum),
-			 ztest_unit_test(test_recv_two_large_split_msg)
+			 ztest_unit_test(test_recv_two_large_split_msg),
+			 ztest_unit_test(test_send_stream_masked)
 		);
 
 	ztest_run_test_suite(websocket);
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <zephyr/debug/profiler.h>
+
+#define BUSY_MS 200
+/* Upper bound of the size of busy_loop() */
+#define BUSY_LOOP_SIZE 512
+
+#if (defined(CONFIG_X86) && !defined(CONFIG_X86_64)) || \
+	defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+#define PC_SAMPLED 1
+#endif
+
+static volatile uint32_t counter;
+
+struct sample_count {
+	uint32_t total;
+	uint32_t busy;
+	uint32_t busy_with_caller;
+};
+
+static void __noinline busy_loop(void)
+{
+	int64_t end = k_uptime_get() + BUSY_MS;
+
+	while (k_uptime_get() < end) {
+		if (IS_ENABLED(CONFIG_ARCH_POSIX)) {
+			/* Time only passes in busy waits */
+			k_busy_wait(100);
+		}
+
+		for (int i = 0; i < 1000; i++) {
+			counter++;
+		}
+	}
+}
+
+static void count_cb(const uintptr_t *pcs, uint32_t count, void *user_data)
+{
+	struct sample_count *samples = user_data;
+	uintptr_t busy = (uintptr_t)busy_loop & ~1UL;
+
+	samples->total += count;
+
+	if (pcs[0] >= busy && pcs[0] < busy + BUSY_LOOP_SIZE) {
+		samples->busy += count;
+		if (PROFILER_SAMPLE_DEPTH > 1 && pcs[1] != 0U) {
+			samples->busy_with_caller += count;
+		}
+	}
+}
+
+static void test_profiler_start_stop(void)
+{
+	zassert_equal(profiler_stop(), -EALREADY, NULL);
+	zassert_equal(profiler_start(), 0, NULL);
+	zassert_equal(profiler_start(), -EALREADY, NULL);
+	zassert_equal(profiler_stop(), 0, NULL);
+	zassert_equal(profiler_stop(), -EALREADY, NULL);
+}
+
+static void test_profiler_samples(void)
+{
+	struct sample_count samples = { 0 };
+
+	profiler_reset();
+
+	zassert_equal(profiler_start(), 0, NULL);
+	busy_loop();
+	zassert_equal(profiler_stop(), 0, NULL);
+
+	profiler_foreach(count_cb, &samples);
+	profiler_print();
+
+	zassert_true(samples.total > 0, "no samples");
+
+#ifdef PC_SAMPLED
+	/* Most of the time is spent in the busy loop */
+	zassert_true(samples.busy * 2 > samples.total,
+		     "%u samples in busy loop out of %u", samples.busy,
+		     samples.total);
+	if (PROFILER_SAMPLE_DEPTH > 1) {
+		zassert_true(samples.busy_with_caller > 0, "no backtrace");
+	}
+#endif
+}
+
+static void test_profiler_reset(void)
+{
+	struct sample_count samples = { 0 };
+
+	profiler_reset();
+	profiler_foreach(count_cb, &samples);
+
+	zassert_equal(samples.total, 0, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(profiler,
+			 ztest_unit_test(test_profiler_start_stop),
+			 ztest_unit_test(test_profiler_samples),
+			 ztest_unit_test(test_profiler_reset));
+	ztest_run_test_suite(profiler);
+}
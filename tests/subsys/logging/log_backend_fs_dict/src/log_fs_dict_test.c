@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test framed dictionary log files of the file system backend
+ *
+ */
+
+#include <stdlib.h>
+#include <zephyr/zephyr.h>
+#include <ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/sys/byteorder.h>
+#include "ram_fs.h"
+
+#define MAX_PATH_LEN (256 + 7)
+#define MAX_FILE_NUM 9999
+
+#define DICT_ALIGN CONFIG_LOG_BACKEND_FS_DICT_WRITE_ALIGN
+#define FILE_HDR_LEN 8
+#define FRAME_HDR_LEN 4
+#define LZ4_MIN_MATCH 4
+
+#define MSG_LEN 40
+#define MSG_COUNT 100
+#define MSGS_PER_FRAME 3
+#define LARGE_MSG_LEN (2 * CONFIG_LOG_BACKEND_FS_DICT_BATCH_SIZE + 44)
+/* Frames of random data, which do not compress */
+#define RANDOM_FRAME_LEN \
+	ROUND_UP(FRAME_HDR_LEN + CONFIG_LOG_BACKEND_FS_DICT_BATCH_SIZE, DICT_ALIGN)
+#define RANDOM_FRAMES \
+	(CONFIG_LOG_BACKEND_FS_FILE_SIZE / RANDOM_FRAME_LEN + 1)
+
+static const char *log_prefix = CONFIG_LOG_BACKEND_FS_FILE_PREFIX;
+
+static struct fs_mount_t ram_fs_mnt = {
+	.type = RAM_FS_TYPE,
+	.mnt_point = CONFIG_LOG_BACKEND_FS_DIR,
+};
+
+/* Everything written to the backend, in order */
+static uint8_t stream[MSG_COUNT * MSG_LEN + LARGE_MSG_LEN +
+		      MSGS_PER_FRAME * MSG_LEN +
+		      RANDOM_FRAMES * CONFIG_LOG_BACKEND_FS_DICT_BATCH_SIZE];
+static size_t stream_len;
+static uint32_t msg_seed = 1U;
+
+/* Frames read so far, and how many of them were compressed */
+static int frames_read;
+static int frames_compressed;
+
+int write_log_to_batch(uint8_t *data, size_t length, void *ctx);
+void flush_log_batch(void);
+
+static uint8_t next_random(void)
+{
+	msg_seed = msg_seed * 1103515245U + 12345U;
+
+	return (uint8_t)(msg_seed >> 16);
+}
+
+/* Fills a message with random bytes and some text, so that it compresses
+ * but not to nothing.
+ */
+static void make_msg(uint8_t *msg, size_t len)
+{
+	static const char text[] = "dictionary log message";
+
+	for (size_t i = 0; i < len; i++) {
+		if ((i / 8) % 2 == 0) {
+			msg[i] = next_random();
+		} else {
+			msg[i] = text[i % (sizeof(text) - 1)];
+		}
+	}
+}
+
+static void make_random(uint8_t *msg, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		msg[i] = next_random();
+	}
+}
+
+static void log_msg(const uint8_t *msg, size_t len)
+{
+	size_t done = 0;
+
+	zassert_true(stream_len + len <= sizeof(stream), "Stream too long");
+	memcpy(&stream[stream_len], msg, len);
+	stream_len += len;
+
+	while (done < len) {
+		int rc = write_log_to_batch((uint8_t *)&msg[done], len - done,
+					    NULL);
+
+		zassert_true(rc > 0, "Batch did not take any data");
+		done += rc;
+	}
+}
+
+static size_t lz4_get_len(const uint8_t *src, size_t len, size_t *in,
+			  size_t val)
+{
+	uint8_t byte;
+
+	if (val != 15U) {
+		return val;
+	}
+
+	do {
+		zassert_true(*in < len, "Truncated length");
+		byte = src[(*in)++];
+		val += byte;
+	} while (byte == 255U);
+
+	return val;
+}
+
+/* Decompresses a block in the LZ4 block format */
+static size_t lz4_decompress(const uint8_t *src, size_t len, uint8_t *dst,
+			     size_t cap)
+{
+	size_t in = 0, out = 0;
+
+	while (in < len) {
+		uint8_t token = src[in++];
+		size_t lit_len = lz4_get_len(src, len, &in, token >> 4);
+		size_t offset, match_len;
+
+		zassert_true(in + lit_len <= len, "Truncated literals");
+		zassert_true(out + lit_len <= cap, "Literals overflow");
+		memcpy(&dst[out], &src[in], lit_len);
+		in += lit_len;
+		out += lit_len;
+
+		if (in == len) {
+			/* Last sequence only has literals */
+			break;
+		}
+
+		zassert_true(in + 2 <= len, "Truncated match offset");
+		offset = sys_get_le16(&src[in]);
+		in += 2;
+		match_len = lz4_get_len(src, len, &in, token & 0xF) +
+			    LZ4_MIN_MATCH;
+
+		zassert_true(offset != 0 && offset <= out, "Bad match offset");
+		zassert_true(out + match_len <= cap, "Match overflow");
+		/* Matches may overlap with the bytes being copied */
+		for (; match_len > 0; match_len--, out++) {
+			dst[out] = dst[out - offset];
+		}
+	}
+
+	return out;
+}
+
+/* Reads the log data held in the frames of a log file */
+static size_t read_log_file(int num, uint8_t *out, size_t cap)
+{
+	static uint8_t data[CONFIG_LOG_BACKEND_FS_FILE_SIZE];
+	char fname[MAX_PATH_LEN];
+	struct fs_file_t file;
+	size_t off = DICT_ALIGN;
+	size_t len = 0;
+	ssize_t size;
+
+	fs_file_t_init(&file);
+	sprintf(fname, "%s/%s%04d", CONFIG_LOG_BACKEND_FS_DIR, log_prefix,
+		num);
+
+	zassert_equal(fs_open(&file, fname, FS_O_READ), 0,
+		      "Can not open log file %s.", fname);
+	size = fs_read(&file, data, sizeof(data));
+	zassert_equal(fs_close(&file), 0, "Can not close log file.");
+
+	zassert_true(size >= DICT_ALIGN, "No file header in %s.", fname);
+	zassert_equal(size % DICT_ALIGN, 0, "Unaligned size of %s.", fname);
+	zassert_mem_equal(data, "ZLDF", 4, "Bad file magic.");
+	zassert_equal(data[4], 1, "Bad file version.");
+	zassert_equal(sys_get_le16(&data[6]), DICT_ALIGN,
+		      "Bad file alignment.");
+
+	while (off < size) {
+		uint16_t stored = sys_get_le16(&data[off]);
+		uint16_t raw = sys_get_le16(&data[off + 2]);
+		const uint8_t *payload = &data[off + FRAME_HDR_LEN];
+		size_t end = ROUND_UP(FRAME_HDR_LEN + stored, DICT_ALIGN);
+
+		zassert_true(stored != 0 && stored <= raw, "Bad frame header.");
+		zassert_true(off + end <= size, "Frame straddles files.");
+		zassert_true(len + raw <= cap, "Too much log data.");
+
+		if (stored < raw) {
+			zassert_equal(lz4_decompress(payload, stored, &out[len],
+						     raw),
+				      raw, "Bad compressed frame length.");
+			frames_compressed++;
+		} else {
+			memcpy(&out[len], payload, raw);
+		}
+
+		for (size_t i = FRAME_HDR_LEN + stored; i < end; i++) {
+			zassert_equal(data[off + i], 0, "Bad frame padding.");
+		}
+
+		frames_read++;
+		len += raw;
+		off += end;
+	}
+
+	return len;
+}
+
+static bool log_file_exists(int num)
+{
+	char fname[MAX_PATH_LEN];
+	struct fs_dirent entry;
+
+	sprintf(fname, "%s/%s%04d", CONFIG_LOG_BACKEND_FS_DIR, log_prefix,
+		num);
+
+	return fs_stat(fname, &entry) == 0;
+}
+
+/* Finds the range of log file numbers, returns the newest */
+static int log_files_find(int *first)
+{
+	int last = -1;
+
+	*first = MAX_FILE_NUM;
+	for (int num = 0; num <= MAX_FILE_NUM; num++) {
+		if (log_file_exists(num)) {
+			*first = MIN(*first, num);
+			last = num;
+		} else if (last >= 0) {
+			break;
+		}
+	}
+
+	return last;
+}
+
+static void test_dict_setup(void)
+{
+	int rc;
+
+	rc = fs_register(RAM_FS_TYPE, &ram_fs);
+	zassert_equal(rc, 0, "Can not register FS.");
+
+	rc = fs_mount(&ram_fs_mnt);
+	zassert_equal(rc, 0, "Can not mount FS.");
+}
+
+static void test_dict_frame(void)
+{
+	static uint8_t out[MSGS_PER_FRAME * MSG_LEN];
+	uint8_t msg[MSG_LEN];
+	size_t len;
+
+	for (int i = 0; i < MSGS_PER_FRAME; i++) {
+		make_msg(msg, sizeof(msg));
+		log_msg(msg, sizeof(msg));
+	}
+
+	zassert_false(log_file_exists(0), "Batch written too early.");
+	flush_log_batch();
+
+	len = read_log_file(0, out, sizeof(out));
+	zassert_equal(len, stream_len, "Unexpected length of log data.");
+	zassert_mem_equal(out, stream, len, "Unexpected log data.");
+	zassert_equal(frames_read, 1, "Unexpected number of frames.");
+	zassert_equal(frames_compressed,
+		      IS_ENABLED(CONFIG_LOG_BACKEND_FS_DICT_COMPRESS) ? 1 : 0,
+		      "Unexpected number of compressed frames.");
+}
+
+static void test_dict_large_msg(void)
+{
+	static uint8_t out[sizeof(stream)];
+	static uint8_t msg[LARGE_MSG_LEN];
+	size_t len;
+
+	/* A message larger than a batch is split over frames */
+	make_msg(msg, sizeof(msg));
+	log_msg(msg, sizeof(msg));
+	flush_log_batch();
+
+	frames_read = 0;
+	len = read_log_file(0, out, sizeof(out));
+	if (log_file_exists(1)) {
+		len += read_log_file(1, &out[len], sizeof(out) - len);
+	}
+
+	zassert_equal(len, stream_len, "Unexpected length of log data.");
+	zassert_mem_equal(out, stream, len, "Unexpected log data.");
+	zassert_equal(frames_read, 1 + DIV_ROUND_UP(LARGE_MSG_LEN,
+			CONFIG_LOG_BACKEND_FS_DICT_BATCH_SIZE),
+		      "Unexpected number of frames.");
+}
+
+static void test_dict_rotation(void)
+{
+	static uint8_t out[sizeof(stream)];
+	uint8_t msg[MSG_LEN];
+	int first, last;
+	size_t len = 0;
+
+	for (int i = 0; i < MSG_COUNT; i++) {
+		make_msg(msg, sizeof(msg));
+		log_msg(msg, sizeof(msg));
+
+		if ((i + 1) % MSGS_PER_FRAME == 0) {
+			flush_log_batch();
+		}
+	}
+	flush_log_batch();
+
+	last = log_files_find(&first);
+
+	zassert_true(last > first, "Log files were not rotated.");
+	zassert_true(last - first < CONFIG_LOG_BACKEND_FS_FILES_LIMIT,
+		     "Too many log files.");
+	zassert_false(log_file_exists(0), "Oldest log file not deleted.");
+
+	/* Each file is read on its own, and the newest ones hold the end
+	 * of the log data.
+	 */
+	for (int num = first; num <= last; num++) {
+		len += read_log_file(num, &out[len], sizeof(out) - len);
+	}
+
+	zassert_true(len > 0 && len < stream_len,
+		     "Unexpected length of log data.");
+	zassert_mem_equal(out, &stream[stream_len - len], len,
+			  "Unexpected log data.");
+}
+
+static void test_dict_short_write_rotation(void)
+{
+	static uint8_t out[CONFIG_LOG_BACKEND_FS_FILE_SIZE];
+	uint8_t msg[CONFIG_LOG_BACKEND_FS_DICT_BATCH_SIZE];
+	char fname[MAX_PATH_LEN];
+	struct fs_dirent entry;
+	int first, last;
+
+	/* Fill the newest file, up to where the next frame rotates */
+	last = log_files_find(&first);
+	sprintf(fname, "%s/%s%04d", CONFIG_LOG_BACKEND_FS_DIR, log_prefix,
+		last);
+
+	for (int i = 0; i < RANDOM_FRAMES; i++) {
+		zassert_equal(fs_stat(fname, &entry), 0,
+			      "Can not get file info.");
+		if (entry.size + RANDOM_FRAME_LEN >
+		    CONFIG_LOG_BACKEND_FS_FILE_SIZE) {
+			break;
+		}
+
+		make_random(msg, sizeof(msg));
+		log_msg(msg, sizeof(msg));
+		flush_log_batch();
+	}
+
+	/* The header of the new file is written in pieces of its first
+	 * bytes, then the frame write is cut short.  The partial frame is
+	 * dropped, and the frame written again in the same file.
+	 */
+	make_random(msg, sizeof(msg));
+	log_msg(msg, sizeof(msg));
+	ram_fs_short_write(DICT_ALIGN / FILE_HDR_LEN, RANDOM_FRAME_LEN / 2);
+	flush_log_batch();
+
+	zassert_equal(log_files_find(&first), last + 1,
+		      "Log file not rotated once.");
+
+	sprintf(fname, "%s/%s%04d", CONFIG_LOG_BACKEND_FS_DIR, log_prefix,
+		last + 1);
+	zassert_equal(fs_stat(fname, &entry), 0, "Can not get file info.");
+	zassert_equal(entry.size, DICT_ALIGN + RANDOM_FRAME_LEN,
+		      "Unexpected %s file size (%d B)", fname, entry.size);
+
+	frames_read = 0;
+	zassert_equal(read_log_file(last + 1, out, sizeof(out)), sizeof(msg),
+		      "Unexpected length of log data.");
+	zassert_mem_equal(out, msg, sizeof(msg), "Unexpected log data.");
+	zassert_equal(frames_read, 1, "Unexpected number of frames.");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(test_log_backend_fs_dict,
+			 ztest_unit_test(test_dict_setup),
+			 ztest_unit_test(test_dict_frame),
+			 ztest_unit_test(test_dict_large_msg),
+			 ztest_unit_test(test_dict_rotation),
+			 ztest_unit_test(test_dict_short_write_rotation)
+			 );
+	ztest_run_test_suite(test_log_backend_fs_dict);
+}
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Flat file system in RAM, whose writes can be made short
+ *
+ */
+
+#include <string.h>
+#include <zephyr/zephyr.h>
+#include <zephyr/fs/fs_sys.h>
+#include "ram_fs.h"
+
+#define RAM_FS_FILES 8
+#define RAM_FS_FILE_SIZE 1024
+#define RAM_FS_BLOCK_SIZE 64
+
+struct ram_file {
+	char name[MAX_FILE_NAME + 1];
+	uint8_t data[RAM_FS_FILE_SIZE];
+	size_t size;
+	bool used;
+};
+
+struct ram_file_handle {
+	struct ram_file *file;
+	size_t pos;
+};
+
+static struct ram_file files[RAM_FS_FILES];
+static struct ram_file_handle handles[RAM_FS_FILES];
+static size_t dir_pos;
+static unsigned int short_write_after;
+static size_t short_write = SIZE_MAX;
+
+void ram_fs_short_write(unsigned int after, size_t len)
+{
+	short_write_after = after;
+	short_write = len;
+}
+
+/* Files are all in the mount point, which is the only directory */
+static const char *file_name(const struct fs_mount_t *mp, const char *path)
+{
+	path += strlen(mp->mnt_point);
+
+	return (*path == '/') ? path + 1 : path;
+}
+
+static struct ram_file *file_find(const char *name)
+{
+	for (size_t i = 0; i < RAM_FS_FILES; i++) {
+		if (files[i].used && strcmp(files[i].name, name) == 0) {
+			return &files[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int ram_open(struct fs_file_t *filp, const char *fs_path,
+		    fs_mode_t flags)
+{
+	const char *name = file_name(filp->mp, fs_path);
+	struct ram_file *file = file_find(name);
+	struct ram_file_handle *handle = NULL;
+
+	for (size_t i = 0; i < RAM_FS_FILES; i++) {
+		if (handles[i].file == NULL) {
+			handle = &handles[i];
+			break;
+		}
+	}
+
+	if (handle == NULL || strlen(name) > MAX_FILE_NAME) {
+		return -ENOMEM;
+	}
+
+	if (file == NULL) {
+		if (!(flags & FS_O_CREATE)) {
+			return -ENOENT;
+		}
+
+		for (size_t i = 0; i < RAM_FS_FILES && file == NULL; i++) {
+			if (!files[i].used) {
+				file = &files[i];
+			}
+		}
+
+		if (file == NULL) {
+			return -ENOSPC;
+		}
+
+		strcpy(file->name, name);
+		file->size = 0;
+		file->used = true;
+	}
+
+	handle->file = file;
+	handle->pos = 0;
+	filp->filep = handle;
+
+	return 0;
+}
+
+static ssize_t ram_read(struct fs_file_t *filp, void *dest, size_t nbytes)
+{
+	struct ram_file_handle *handle = filp->filep;
+	size_t len = 0;
+
+	if (handle->pos < handle->file->size) {
+		len = MIN(nbytes, handle->file->size - handle->pos);
+	}
+
+	memcpy(dest, &handle->file->data[handle->pos], len);
+	handle->pos += len;
+
+	return len;
+}
+
+static ssize_t ram_write(struct fs_file_t *filp, const void *src,
+			 size_t nbytes)
+{
+	struct ram_file_handle *handle = filp->filep;
+	size_t len = nbytes;
+
+	if (short_write_after > 0U) {
+		short_write_after--;
+	} else {
+		len = MIN(nbytes, short_write);
+		short_write = SIZE_MAX;
+	}
+
+	if (handle->pos + len > RAM_FS_FILE_SIZE) {
+		return -ENOSPC;
+	}
+
+	memcpy(&handle->file->data[handle->pos], src, len);
+	handle->pos += len;
+	handle->file->size = MAX(handle->file->size, handle->pos);
+
+	return len;
+}
+
+static int ram_lseek(struct fs_file_t *filp, off_t off, int whence)
+{
+	struct ram_file_handle *handle = filp->filep;
+	off_t pos;
+
+	switch (whence) {
+	case FS_SEEK_SET:
+		pos = off;
+		break;
+	case FS_SEEK_CUR:
+		pos = handle->pos + off;
+		break;
+	case FS_SEEK_END:
+		pos = handle->file->size + off;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if (pos < 0 || pos > RAM_FS_FILE_SIZE) {
+		return -EINVAL;
+	}
+
+	handle->pos = pos;
+
+	return 0;
+}
+
+static off_t ram_tell(struct fs_file_t *filp)
+{
+	struct ram_file_handle *handle = filp->filep;
+
+	return handle->pos;
+}
+
+static int ram_truncate(struct fs_file_t *filp, off_t length)
+{
+	struct ram_file_handle *handle = filp->filep;
+	struct ram_file *file = handle->file;
+
+	if (length < 0 || length > RAM_FS_FILE_SIZE) {
+		return -EINVAL;
+	}
+
+	/* Files grow with zeros */
+	if (length > file->size) {
+		memset(&file->data[file->size], 0, length - file->size);
+	}
+	file->size = length;
+
+	return 0;
+}
+
+static int ram_sync(struct fs_file_t *filp)
+{
+	return 0;
+}
+
+static int ram_close(struct fs_file_t *filp)
+{
+	struct ram_file_handle *handle = filp->filep;
+
+	handle->file = NULL;
+
+	return 0;
+}
+
+static int ram_opendir(struct fs_dir_t *dirp, const char *fs_path)
+{
+	if (*file_name(dirp->mp, fs_path) != '\0') {
+		return -ENOENT;
+	}
+
+	dir_pos = 0;
+
+	return 0;
+}
+
+static int ram_readdir(struct fs_dir_t *dirp, struct fs_dirent *entry)
+{
+	while (dir_pos < RAM_FS_FILES && !files[dir_pos].used) {
+		dir_pos++;
+	}
+
+	if (dir_pos == RAM_FS_FILES) {
+		entry->name[0] = '\0';
+		return 0;
+	}
+
+	entry->type = FS_DIR_ENTRY_FILE;
+	entry->size = files[dir_pos].size;
+	strcpy(entry->name, files[dir_pos].name);
+	dir_pos++;
+
+	return 0;
+}
+
+static int ram_closedir(struct fs_dir_t *dirp)
+{
+	return 0;
+}
+
+static int ram_mount(struct fs_mount_t *mountp)
+{
+	return 0;
+}
+
+static int ram_unlink(struct fs_mount_t *mountp, const char *name)
+{
+	struct ram_file *file = file_find(file_name(mountp, name));
+
+	if (file == NULL) {
+		return -ENOENT;
+	}
+
+	file->used = false;
+
+	return 0;
+}
+
+static int ram_stat(struct fs_mount_t *mountp, const char *path,
+		    struct fs_dirent *entry)
+{
+	const char *name = file_name(mountp, path);
+	struct ram_file *file;
+
+	if (*name == '\0') {
+		entry->type = FS_DIR_ENTRY_DIR;
+		entry->size = 0;
+		entry->name[0] = '\0';
+		return 0;
+	}
+
+	file = file_find(name);
+	if (file == NULL) {
+		return -ENOENT;
+	}
+
+	entry->type = FS_DIR_ENTRY_FILE;
+	entry->size = file->size;
+	strcpy(entry->name, file->name);
+
+	return 0;
+}
+
+static int ram_statvfs(struct fs_mount_t *mountp, const char *path,
+		       struct fs_statvfs *stat)
+{
+	size_t used = 0;
+
+	for (size_t i = 0; i < RAM_FS_FILES; i++) {
+		if (files[i].used) {
+			used += DIV_ROUND_UP(files[i].size, RAM_FS_BLOCK_SIZE);
+		}
+	}
+
+	stat->f_bsize = RAM_FS_BLOCK_SIZE;
+	stat->f_frsize = RAM_FS_BLOCK_SIZE;
+	stat->f_blocks = RAM_FS_FILES * RAM_FS_FILE_SIZE / RAM_FS_BLOCK_SIZE;
+	stat->f_bfree = stat->f_blocks - used;
+
+	return 0;
+}
+
+const struct fs_file_system_t ram_fs = {
+	.open = ram_open,
+	.read = ram_read,
+	.write = ram_write,
+	.lseek = ram_lseek,
+	.tell = ram_tell,
+	.truncate = ram_truncate,
+	.sync = ram_sync,
+	.close = ram_close,
+	.opendir = ram_opendir,
+	.readdir = ram_readdir,
+	.closedir = ram_closedir,
+	.mount = ram_mount,
+	.unlink = ram_unlink,
+	.stat = ram_stat,
+	.statvfs = ram_statvfs,
+};
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef RAM_FS_H_
+#define RAM_FS_H_
+
+#include <zephyr/fs/fs.h>
+
+#define RAM_FS_TYPE FS_TYPE_EXTERNAL_BASE
+
+extern const struct fs_file_system_t ram_fs;
+
+/* Makes the write following the next @p after ones only write up to
+ * @p len bytes
+ */
+void ram_fs_short_write(unsigned int after, size_t len);
+
+#endif /* RAM_FS_H_ */
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_internal.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_INF);
+
+static uint32_t received;
+
+static void process(const struct log_backend *const backend,
+		    union log_msg2_generic *msg)
+{
+	if (log_msg2_get_source(&msg->log) == __log_current_dynamic_data) {
+		received++;
+	}
+}
+
+static void panic(const struct log_backend *const backend)
+{
+}
+
+static const struct log_backend_api count_backend_api = {
+	.process = process,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(count_backend, count_backend_api, true);
+
+static int16_t source_id(void)
+{
+	return (int16_t)log_dynamic_source_id(__log_current_dynamic_data);
+}
+
+static uint32_t log_n(int n)
+{
+	received = 0;
+
+	for (int i = 0; i < n; i++) {
+		LOG_INF("message %d", i);
+	}
+
+	while (log_process(false)) {
+	}
+
+	return received;
+}
+
+static void reset(void)
+{
+	zassert_equal(log_rate_limit_set(CONFIG_LOG_DOMAIN_ID, source_id(), 0, 0),
+		      0, NULL);
+	zassert_equal(log_sample_set(CONFIG_LOG_DOMAIN_ID, source_id(), 1), 0,
+		      NULL);
+	(void)log_rate_limit_suppressed_get(CONFIG_LOG_DOMAIN_ID, source_id(),
+					    true);
+}
+
+static void test_rate_limit_invalid(void)
+{
+	int16_t id = source_id();
+
+	zassert_equal(log_rate_limit_set(CONFIG_LOG_DOMAIN_ID, -1, 10, 1),
+		      -EINVAL, NULL);
+	zassert_equal(log_rate_limit_set(CONFIG_LOG_DOMAIN_ID,
+					 z_log_sources_count(), 10, 1),
+		      -EINVAL, NULL);
+	zassert_equal(log_rate_limit_set(CONFIG_LOG_DOMAIN_ID, id, 10, 0),
+		      -EINVAL, NULL);
+	zassert_equal(log_rate_limit_set(CONFIG_LOG_DOMAIN_ID, id,
+					 UINT16_MAX + 1, 1), -EINVAL, NULL);
+	zassert_equal(log_sample_set(CONFIG_LOG_DOMAIN_ID, id, UINT16_MAX + 1),
+		      -EINVAL, NULL);
+}
+
+/* Without settings, every message goes through. */
+static void test_rate_limit_none(void)
+{
+	reset();
+
+	zassert_equal(log_n(20), 20, NULL);
+	zassert_equal(log_rate_limit_suppressed_get(CONFIG_LOG_DOMAIN_ID,
+						    source_id(), false),
+		      0, NULL);
+}
+
+static void test_rate_limit_sample(void)
+{
+	uint32_t n;
+
+	reset();
+	zassert_equal(log_sample_set(CONFIG_LOG_DOMAIN_ID, source_id(), 4), 0,
+		      NULL);
+	zassert_equal(log_rate_limit_get(CONFIG_LOG_DOMAIN_ID, source_id(),
+					 NULL, NULL, &n), 0, NULL);
+	zassert_equal(n, 4, NULL);
+
+	/* The first message of each group of 4 is kept */
+	zassert_equal(log_n(20), 5, NULL);
+	zassert_equal(log_rate_limit_suppressed_get(CONFIG_LOG_DOMAIN_ID,
+						    source_id(), true),
+		      15, NULL);
+
+	reset();
+	zassert_equal(log_n(20), 20, NULL);
+}
+
+static void test_rate_limit_bucket(void)
+{
+	uint32_t rate, burst;
+
+	reset();
+	zassert_equal(log_rate_limit_set(CONFIG_LOG_DOMAIN_ID, source_id(),
+					 10, 5), 0, NULL);
+	zassert_equal(log_rate_limit_get(CONFIG_LOG_DOMAIN_ID, source_id(),
+					 &rate, &burst, NULL), 0, NULL);
+	zassert_equal(rate, 10, NULL);
+	zassert_equal(burst, 5, NULL);
+
+	/* A burst goes through, then the bucket is empty */
+	zassert_equal(log_n(20), 5, NULL);
+	zassert_equal(log_rate_limit_suppressed_get(CONFIG_LOG_DOMAIN_ID,
+						    source_id(), true),
+		      15, NULL);
+
+	/* The bucket refills at the rate, up to the burst */
+	k_msleep(300);
+	zassert_within(log_n(20), 3, 1, NULL);
+
+	k_msleep(2000);
+	zassert_equal(log_n(20), 5, NULL);
+
+	reset();
+	zassert_equal(log_n(20), 20, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(test_log_rate_limit,
+			 ztest_unit_test(test_rate_limit_invalid),
+			 ztest_unit_test(test_rate_limit_none),
+			 ztest_unit_test(test_rate_limit_sample),
+			 ztest_unit_test(test_rate_limit_bucket));
+	ztest_run_test_suite(test_log_rate_limit);
+}
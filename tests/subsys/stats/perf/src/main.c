@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <ztest.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/stats/stats.h>
+#include <zephyr/stats/stats_perf.h>
+#include <zephyr/sys/sys_heap.h>
+
+#define N_DURATIONS 100
+
+STATS_PERF_DEFINE(perf_test);
+STATS_PERF_DECLARE(perf_sys_heap_alloc);
+STATS_PERF_DECLARE(perf_sys_heap_free);
+
+static uint8_t heap_mem[1024];
+
+struct entry_lookup {
+	const char *name;
+	uint32_t value;
+	bool found;
+};
+
+static int lookup_cb(struct stats_hdr *hdr, void *arg, const char *name,
+		     uint16_t off)
+{
+	struct entry_lookup *lookup = arg;
+
+	if (strcmp(name, lookup->name) == 0) {
+		lookup->value = *(uint32_t *)((uint8_t *)hdr + off);
+		lookup->found = true;
+		return 1;
+	}
+
+	return 0;
+}
+
+static uint32_t entry_get(const char *group, const char *name)
+{
+	struct entry_lookup lookup = { .name = name };
+	struct stats_hdr *hdr = stats_group_find(group);
+
+	zassert_not_null(hdr, "group %s not registered", group);
+	(void)stats_walk(hdr, lookup_cb, &lookup);
+	zassert_true(lookup.found, "no entry %s", name);
+
+	return lookup.value;
+}
+
+static uint32_t to_ns(uint32_t cycles)
+{
+	return (uint32_t)k_cyc_to_ns_floor64(cycles);
+}
+
+static void test_perf_empty(void)
+{
+	stats_perf_reset(&perf_test);
+
+	zassert_equal(stats_perf_percentile(&perf_test, 500), 0, NULL);
+	zassert_equal(entry_get("perf_test", "count"), 0, NULL);
+	zassert_equal(entry_get("perf_test", "p99"), 0, NULL);
+}
+
+static void test_perf_percentiles(void)
+{
+	uint32_t p;
+
+	stats_perf_reset(&perf_test);
+
+	for (uint32_t i = 1; i <= N_DURATIONS; i++) {
+		stats_perf_record(&perf_test, i);
+	}
+
+	/* Percentiles are bucket upper bounds, within the bucket precision */
+	p = stats_perf_percentile(&perf_test, 500);
+	zassert_true(p >= 50 && p < 50 + (50 >> CONFIG_STATS_PERF_PRECISION) + 1,
+		     "p50 is %u", p);
+	p = stats_perf_percentile(&perf_test, 900);
+	zassert_true(p >= 90 && p <= N_DURATIONS, "p90 is %u", p);
+	zassert_equal(stats_perf_percentile(&perf_test, 1000), N_DURATIONS,
+		      NULL);
+	zassert_equal(stats_perf_percentile(&perf_test, 0), 1, NULL);
+
+	zassert_equal(entry_get("perf_test", "count"), N_DURATIONS, NULL);
+	zassert_equal(entry_get("perf_test", "min"), to_ns(1), NULL);
+	zassert_equal(entry_get("perf_test", "max"), to_ns(N_DURATIONS), NULL);
+	zassert_equal(entry_get("perf_test", "mean"),
+		      to_ns((N_DURATIONS + 1) / 2), NULL);
+	zassert_equal(entry_get("perf_test", "p50"),
+		      to_ns(stats_perf_percentile(&perf_test, 500)), NULL);
+}
+
+static void test_perf_large(void)
+{
+	stats_perf_reset(&perf_test);
+
+	stats_perf_record(&perf_test, 0);
+	stats_perf_record(&perf_test, UINT32_MAX);
+
+	zassert_equal(stats_perf_percentile(&perf_test, 500), 0, NULL);
+	zassert_equal(stats_perf_percentile(&perf_test, 990), UINT32_MAX, NULL);
+}
+
+static void isr_record(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	stats_perf_record(&perf_test, 10);
+}
+
+static void test_perf_isr(void)
+{
+	stats_perf_reset(&perf_test);
+
+	irq_offload(isr_record, NULL);
+	stats_perf_record(&perf_test, 10);
+
+	zassert_equal(entry_get("perf_test", "count"), 2, NULL);
+	zassert_equal(stats_perf_percentile(&perf_test, 500), 10, NULL);
+}
+
+static void test_perf_sys_heap(void)
+{
+	struct sys_heap heap;
+	void *mem;
+
+	stats_perf_reset(&perf_sys_heap_alloc);
+	stats_perf_reset(&perf_sys_heap_free);
+
+	sys_heap_init(&heap, heap_mem, sizeof(heap_mem));
+	mem = sys_heap_alloc(&heap, 32);
+	zassert_not_null(mem, NULL);
+	sys_heap_free(&heap, mem);
+
+	zassert_equal(entry_get("perf_sys_heap_alloc", "count"), 1, NULL);
+	zassert_equal(entry_get("perf_sys_heap_free", "count"), 1, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(stats_perf,
+			 ztest_unit_test(test_perf_empty),
+			 ztest_unit_test(test_perf_percentiles),
+			 ztest_unit_test(test_perf_large),
+			 ztest_unit_test(test_perf_isr),
+			 ztest_unit_test(test_perf_sys_heap));
+	ztest_run_test_suite(stats_perf);
+}
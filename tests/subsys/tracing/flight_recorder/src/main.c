@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/tracing/flight_recorder.h>
+#include <zephyr/tracing/tracing_format.h>
+
+#define HDR_SIZE 4
+#define PACKET_SIZE 60
+#define MARKER 0xA5
+
+/* Recorded packets are a marker, a sequence number and padding, so that
+ * they can be told from the kernel events recorded in between.
+ */
+static void record(uint32_t seq)
+{
+	uint8_t packet[PACKET_SIZE];
+
+	memset(packet, MARKER, sizeof(packet));
+	sys_put_le32(seq, &packet[1]);
+	tracing_format_raw_data(packet, sizeof(packet));
+}
+
+/* Check the frozen contents, return the number of own packets found */
+static uint32_t check_frozen(uint32_t first, uint32_t last)
+{
+	const uint8_t *data;
+	size_t len = tracing_flight_recorder_data_get(&data);
+	uint32_t seq, expected = first, found = 0;
+	size_t off = 0;
+
+	zassert_true(tracing_flight_recorder_is_frozen(), NULL);
+	zassert_true(len <= CONFIG_TRACING_FLIGHT_RECORDER_BUFFER_SIZE, NULL);
+
+	while (off < len) {
+		uint16_t plen = sys_get_le16(&data[off]);
+
+		off += HDR_SIZE;
+		zassert_true(off + plen <= len, "truncated packet");
+
+		if (plen == PACKET_SIZE && data[off] == MARKER) {
+			seq = sys_get_le32(&data[off + 1]);
+			if (found == 0) {
+				zassert_true(seq >= first, NULL);
+				expected = seq;
+			}
+
+			zassert_equal(seq, expected, "packets out of order");
+			expected++;
+			found++;
+		}
+
+		off += plen;
+	}
+
+	zassert_equal(off, len, NULL);
+	zassert_equal(expected, last + 1, "latest packet missing");
+
+	return found;
+}
+
+static void test_flight_recorder_overwrite(void)
+{
+	uint32_t n = 3 * CONFIG_TRACING_FLIGHT_RECORDER_BUFFER_SIZE /
+		     PACKET_SIZE;
+	uint32_t found;
+
+	tracing_flight_recorder_resume();
+	zassert_false(tracing_flight_recorder_is_frozen(), NULL);
+
+	for (uint32_t i = 0; i < n; i++) {
+		record(i);
+	}
+
+	tracing_flight_recorder_freeze();
+
+	/* The oldest packets were overwritten by the latest ones */
+	found = check_frozen(1, n - 1);
+	zassert_true(found < n, NULL);
+	zassert_true(found >= (CONFIG_TRACING_FLIGHT_RECORDER_BUFFER_SIZE /
+			       (HDR_SIZE + PACKET_SIZE)) / 2, NULL);
+}
+
+static void test_flight_recorder_frozen(void)
+{
+	const uint8_t *data;
+	size_t len;
+
+	tracing_flight_recorder_resume();
+	zassert_equal(tracing_flight_recorder_data_get(&data), 0, NULL);
+
+	record(0);
+	record(1);
+	tracing_flight_recorder_freeze();
+	len = tracing_flight_recorder_data_get(&data);
+	zassert_equal(check_frozen(0, 1), 2, NULL);
+
+	/* Nothing is recorded while frozen, freezing again has no effect */
+	record(2);
+	tracing_flight_recorder_freeze();
+	zassert_equal(tracing_flight_recorder_data_get(&data), len, NULL);
+	zassert_equal(check_frozen(0, 1), 2, NULL);
+}
+
+static void test_flight_recorder_window(void)
+{
+	if (CONFIG_TRACING_FLIGHT_RECORDER_WINDOW_MS == 0) {
+		ztest_test_skip();
+	}
+
+	tracing_flight_recorder_resume();
+
+	record(0);
+	k_busy_wait(2 * CONFIG_TRACING_FLIGHT_RECORDER_WINDOW_MS *
+		    USEC_PER_MSEC);
+	record(1);
+	tracing_flight_recorder_freeze();
+
+	/* Only the packet recorded within the window is kept */
+	zassert_equal(check_frozen(1, 1), 1, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(flight_recorder,
+			 ztest_unit_test(test_flight_recorder_overwrite),
+			 ztest_unit_test(test_flight_recorder_frozen),
+			 ztest_unit_test(test_flight_recorder_window));
+	ztest_run_test_suite(flight_recorder);
+}
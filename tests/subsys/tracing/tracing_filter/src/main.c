@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/tracing/tracing_filter.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_SEM_DEFINE(sem_a, 0, 1);
+static K_SEM_DEFINE(sem_b, 0, 1);
+static K_SEM_DEFINE(sem_c, 0, 1);
+
+static K_THREAD_STACK_DEFINE(stack, STACK_SIZE);
+static struct k_thread other_thread;
+static bool other_traced;
+
+/* Decision taken by the tracing hooks for a semaphore event */
+static bool sem_traced(struct k_sem *sem)
+{
+	return Z_TRACING_FILTER(k_sem, sem);
+}
+
+static bool thread_traced(void)
+{
+	return Z_TRACING_FILTER(k_thread, NULL);
+}
+
+static void test_filter_class(void)
+{
+	tracing_filter_reset();
+	zassert_equal(tracing_filter_class_get(), TRACING_CLASS_ALL, NULL);
+	zassert_true(sem_traced(&sem_a), NULL);
+	zassert_true(thread_traced(), NULL);
+
+	tracing_filter_class_set(BIT(TRACING_CLASS_THREAD));
+	zassert_false(sem_traced(&sem_a), NULL);
+	zassert_true(thread_traced(), NULL);
+
+	tracing_filter_class_set(0);
+	zassert_false(thread_traced(), NULL);
+
+	/* Unknown classes are ignored */
+	tracing_filter_class_set(UINT32_MAX);
+	zassert_equal(tracing_filter_class_get(), TRACING_CLASS_ALL, NULL);
+
+	zassert_equal(strcmp(tracing_filter_class_name(TRACING_CLASS_SEM),
+			     "sem"), 0, NULL);
+	zassert_is_null(tracing_filter_class_name(TRACING_CLASS_COUNT), NULL);
+}
+
+static void test_filter_object(void)
+{
+	tracing_filter_reset();
+
+	zassert_equal(tracing_filter_object_add(&sem_a), 0, NULL);
+	zassert_equal(tracing_filter_object_add(&sem_a), 0, NULL);
+	zassert_equal(tracing_filter_object_add(&sem_b), 0, NULL);
+	zassert_equal(tracing_filter_object_add(&sem_c), -ENOMEM, NULL);
+
+	zassert_true(sem_traced(&sem_a), NULL);
+	zassert_true(sem_traced(&sem_b), NULL);
+	zassert_false(sem_traced(&sem_c), NULL);
+
+	/* Events without an object are not filtered by object */
+	zassert_true(thread_traced(), NULL);
+
+	zassert_equal(tracing_filter_object_remove(&sem_a), 0, NULL);
+	zassert_equal(tracing_filter_object_remove(&sem_a), -ENOENT, NULL);
+	zassert_false(sem_traced(&sem_a), NULL);
+	zassert_true(sem_traced(&sem_b), NULL);
+
+	zassert_equal(tracing_filter_object_remove(&sem_b), 0, NULL);
+	zassert_true(sem_traced(&sem_c), NULL);
+}
+
+static void other_entry(void *p1, void *p2, void *p3)
+{
+	other_traced = sem_traced(&sem_a);
+}
+
+static void isr_check(const void *arg)
+{
+	*(bool *)arg = sem_traced(&sem_a);
+}
+
+static void test_filter_thread(void)
+{
+	bool isr_traced = true;
+
+	tracing_filter_reset();
+	zassert_equal(tracing_filter_thread_add(k_current_get()), 0, NULL);
+	zassert_true(sem_traced(&sem_a), NULL);
+
+	k_thread_create(&other_thread, stack, STACK_SIZE, other_entry, NULL,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_thread_join(&other_thread, K_FOREVER);
+	zassert_false(other_traced, NULL);
+
+	/* Events from ISRs are not traced once threads are selected */
+	irq_offload(isr_check, &isr_traced);
+	zassert_false(isr_traced, NULL);
+
+	zassert_equal(tracing_filter_thread_remove(k_current_get()), 0, NULL);
+	irq_offload(isr_check, &isr_traced);
+	zassert_true(isr_traced, NULL);
+}
+
+static int cmd(const char *str)
+{
+	return tracing_filter_cmd(str, strlen(str));
+}
+
+static void test_filter_cmd(void)
+{
+	char buf[32];
+
+	tracing_filter_reset();
+
+	zassert_equal(cmd("class 1"), 0, NULL);
+	zassert_equal(tracing_filter_class_get(), BIT(TRACING_CLASS_THREAD),
+		      NULL);
+
+	snprintk(buf, sizeof(buf), "object add %lx", (unsigned long)&sem_b);
+	zassert_equal(cmd(buf), 0, NULL);
+	tracing_filter_class_set(TRACING_CLASS_ALL);
+	zassert_false(sem_traced(&sem_a), NULL);
+	zassert_true(sem_traced(&sem_b), NULL);
+
+	snprintk(buf, sizeof(buf), "object remove %lx", (unsigned long)&sem_b);
+	zassert_equal(cmd(buf), 0, NULL);
+	zassert_true(sem_traced(&sem_a), NULL);
+
+	zassert_equal(cmd("object drop 1234"), -EINVAL, NULL);
+	zassert_equal(cmd("thread add xyz"), -EINVAL, NULL);
+	zassert_equal(cmd("class"), -EINVAL, NULL);
+
+	zassert_equal(cmd("class 0"), 0, NULL);
+	zassert_equal(cmd("reset\n"), 0, NULL);
+	zassert_equal(tracing_filter_class_get(), TRACING_CLASS_ALL, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(tracing_filter,
+			 ztest_unit_test(test_filter_class),
+			 ztest_unit_test(test_filter_object),
+			 ztest_unit_test(test_filter_thread),
+			 ztest_unit_test(test_filter_cmd));
+	ztest_run_test_suite(tracing_filter);
+}